@@ -0,0 +1,256 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Batch throughput over bench::BATCH elements (memory bound): array of structures loops against
+// soa_vector bulk operations (sequential and parallel), soa_matrix determinants and inverses against
+// per-matrix calls, the batched matrix<T, 4, 4> transforms and affine3 composition against 4x4 products,
+// soa_quaternion rotation and slerp against per-quaternion calls.
+
+#include "bench_common.h"
+
+#include "vectrix/core/vectrix_core.h"
+
+namespace {
+    template<typename T>
+    void benchSoA( ) {
+        const size_t n = bench::BATCH;
+        const auto a = bench::vectors<T, 3>(n, 1), b = bench::vectors<T, 3>(n, 2);
+        const vtx::soa_vector<T, 3> sa(a.data(), n), sb(b.data(), n);
+        std::vector<vtx::vector<T, 3>> r(n);
+        vtx::soa_vector<T, 3> sr(n);
+        std::vector<T> s(n);
+
+        BENCHMARK(bench::name<T>("aos3", "dot", n)) {
+            for (size_t i = 0; i < n; ++i)
+                s[i] = a[i].dot(b[i]);
+            return s[0];
+        };
+
+        BENCHMARK(bench::name<T>("soa3", "dot", n)) {
+            sa.dot(sb, s.data());
+            return s[0];
+        };
+
+        BENCHMARK(bench::name<T>("soa3", "dot par", n)) {
+            sa.dot(sb, s.data(), vtx::parallel::policy::par);
+            return s[0];
+        };
+
+        BENCHMARK(bench::name<T>("aos3", "normalized", n)) {
+            for (size_t i = 0; i < n; ++i)
+                r[i] = a[i].normalized();
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("soa3", "normalized", n)) {
+            sr = sa;
+            sr.normalize();
+            return sr.data(0)[0];
+        };
+
+        BENCHMARK(bench::name<T>("soa3", "normalized par", n)) {
+            sr = sa;
+            sr.normalize(vtx::parallel::policy::par);
+            return sr.data(0)[0];
+        };
+
+        BENCHMARK(bench::name<T>("aos3", "cross", n)) {
+            for (size_t i = 0; i < n; ++i)
+                r[i] = a[i].cross(b[i]);
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("soa3", "cross", n)) {
+            sa.cross(sb, sr);
+            return sr.data(0)[0];
+        };
+    }
+
+    template<typename T>
+    void benchTransformBatch( ) {
+        const size_t n = bench::BATCH;
+        const auto p = bench::vectors<T, 3>(n, 3);
+        const auto m = vtx::matrix<T, 4, 4>::rotateY(T(30)) * vtx::matrix<T, 4, 4>::translate({T(1), T(2), T(3)});
+        std::vector<vtx::vector<T, 3>> r(n);
+
+        BENCHMARK(bench::name<T>("mat4", "transformPoint loop", n)) {
+            for (size_t i = 0; i < n; ++i)
+                r[i] = m.transformPoint(p[i]);
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("mat4", "transformPoint batch seq", n)) {
+            m.transformPoint(p.data(), r.data(), n);
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("mat4", "transformPoint batch par", n)) {
+            m.transformPoint(p.data(), r.data(), n, vtx::parallel::policy::par);
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("mat4", "transformNormal batch seq", n)) {
+            m.transformNormal(p.data(), r.data(), n);
+            return r[0][0];
+        };
+    }
+
+    template<typename T, size_t N>
+    void benchInverseBatch( ) {
+        const size_t n = bench::BATCH / 16;
+        const std::string what = "mat" + std::to_string(N);
+        const auto m = bench::matrices<T, N, N>(n, 4);
+        const vtx::soa_matrix<T, N, N> sm(m.data(), n);
+        std::vector<vtx::matrix<T, N, N>> r(n);
+        vtx::soa_matrix<T, N, N> sr(n);
+        std::vector<T> d(n);
+        std::vector<std::uint8_t> singular(n);
+
+        BENCHMARK(bench::name<T>(what, "determinant loop", n)) {
+            for (size_t i = 0; i < n; ++i)
+                d[i] = m[i].determinant();
+            return d[0];
+        };
+
+        BENCHMARK(bench::name<T>(what, "determinant soa", n)) {
+            sm.determinant(d.data());
+            return d[0];
+        };
+
+        BENCHMARK(bench::name<T>(what, "inverse loop", n)) {
+            for (size_t i = 0; i < n; ++i)
+                r[i] = m[i].inverse();
+            return r[0](0, 0);
+        };
+
+        BENCHMARK(bench::name<T>(what, "inverse soa", n)) {
+            return sm.inverse(sr, singular.data());
+        };
+    }
+
+    template<typename T>
+    void benchComposeBatch( ) {
+        const size_t n = bench::BATCH / 16;
+        const auto m = bench::matrices<T, 4, 4>(n, 5), p = bench::matrices<T, 4, 4>(n, 6);
+        std::vector<vtx::affine3<T>> a(n), b(n), ra(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = vtx::affine3<T>(m[i]);
+            b[i] = vtx::affine3<T>(p[i]);
+        }
+        std::vector<vtx::matrix<T, 4, 4>> r(n);
+
+        BENCHMARK(bench::name<T>("mat4", "product loop", n)) {
+            for (size_t i = 0; i < n; ++i)
+                r[i] = m[i] * p[i];
+            return r[0](0, 0);
+        };
+
+        BENCHMARK(bench::name<T>("affine3", "product loop", n)) {
+            for (size_t i = 0; i < n; ++i)
+                ra[i] = a[i] * b[i];
+            return ra[0].elements[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("affine3", "compose batch seq", n)) {
+            vtx::affine3<T>::compose(a.data(), b.data(), ra.data(), n);
+            return ra[0].elements[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("affine3", "compose batch par", n)) {
+            vtx::affine3<T>::compose(a.data(), b.data(), ra.data(), n, vtx::parallel::policy::par);
+            return ra[0].elements[0][0];
+        };
+    }
+
+    template<typename T>
+    void benchQuaternionBatch( ) {
+        const size_t n = bench::BATCH / 16;
+        const auto p = bench::vectors<T, 4>(n, 7), s = bench::vectors<T, 4>(n, 8);
+        const auto v = bench::vectors<T, 3>(n, 9);
+        std::vector<vtx::quaternion<T>> a(n), b(n), r(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = vtx::quaternion<T>(p[i][0], p[i][1], p[i][2], p[i][3]).normalized();
+            b[i] = vtx::quaternion<T>(s[i][0], s[i][1], s[i][2], s[i][3]).normalized();
+        }
+        std::vector<vtx::vector<T, 3>> rv(n);
+        const vtx::soa_quaternion<T> sa(a.data(), n), sb(b.data(), n);
+        const vtx::soa_vector<T, 3> sv(v.data(), n);
+        vtx::soa_quaternion<T> sr(n);
+        vtx::soa_vector<T, 3> srv(n);
+
+        BENCHMARK(bench::name<T>("quat", "rotateMatr transform loop", n)) {
+            for (size_t i = 0; i < n; ++i)
+                rv[i] = a[i].rotateMatr().transformVector(v[i]);
+            return rv[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("quat", "rotateVector loop", n)) {
+            for (size_t i = 0; i < n; ++i)
+                rv[i] = a[i].rotateVector(v[i]);
+            return rv[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("soa_quaternion", "rotate", n)) {
+            sa.rotate(sv, srv);
+            return srv.data(0)[0];
+        };
+
+        BENCHMARK(bench::name<T>("quat", "slerp loop", n)) {
+            for (size_t i = 0; i < n; ++i)
+                r[i] = a[i].slerp(b[i], T(0.3));
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("soa_quaternion", "slerp seq", n)) {
+            sa.slerp(sb, T(0.3), sr);
+            return sr.data(0)[0];
+        };
+
+        BENCHMARK(bench::name<T>("soa_quaternion", "slerp par", n)) {
+            sa.slerp(sb, T(0.3), sr, vtx::parallel::policy::par);
+            return sr.data(0)[0];
+        };
+
+        BENCHMARK(bench::name<T>("soa_quaternion", "nlerp", n)) {
+            sa.nlerp(sb, T(0.3), sr);
+            return sr.data(0)[0];
+        };
+
+        BENCHMARK(bench::name<T>("soa_quaternion", "multiply", n)) {
+            sa.multiply(sb, sr);
+            return sr.data(0)[0];
+        };
+    }
+
+    template<typename T>
+    void benchFill( ) {
+        std::vector<vtx::vector<T, 4>> r(bench::BATCH);
+
+        BENCHMARK(bench::name<T>("vec4", "random fill seq", bench::BATCH)) {
+            vtx::random::fill(r, T(0), T(1), 7);
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("vec4", "random fill par", bench::BATCH)) {
+            vtx::random::fill(r, T(0), T(1), 7, 0, vtx::parallel::policy::par);
+            return r[0][0];
+        };
+    }
+} // namespace
+
+TEST_CASE("Batch throughput", "[benchmark][batch]") {
+    benchSoA<float>();
+    benchSoA<double>();
+    benchTransformBatch<float>();
+    benchTransformBatch<double>();
+    benchInverseBatch<float, 3>();
+    benchInverseBatch<float, 4>();
+    benchInverseBatch<double, 4>();
+    benchComposeBatch<float>();
+    benchComposeBatch<double>();
+    benchQuaternionBatch<float>();
+    benchQuaternionBatch<double>();
+    benchFill<float>();
+    benchFill<double>();
+}
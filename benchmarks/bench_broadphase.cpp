@@ -0,0 +1,161 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Broadphase of 200k moving bodies (unit-size boxes in a 150^3 cube, about one overlap per
+// body): the dynamic AABB tree built by inserts, one frame of per-body move() calls against
+// the batch refit, overlapping pair queries and closest-hit ray casts.
+// Frames alternate between two poses 0.3 apart per axis, so every frame moves every body.
+// Sweep and prune of 200k bodies along a 20000 long track: cold radix sort, a frame repaired by
+// insertion sort, and the pair sweep against a loop over the sorted boxes.
+// Bodies (rays) per second = bodies (rays) / mean time.
+
+#include "bench_common.h"
+
+#include "vectrix/geometry/dynamic_aabb_tree.h"
+#include "vectrix/geometry/sweep_and_prune.h"
+
+namespace {
+    template<typename T>
+    void benchDynamicTree( ) {
+        using vec = vtx::vector<T, 3>;
+        const size_t n = 200000, rayCount = 4096;
+        const auto c = bench::vectors<T, 3>(n, 1), v = bench::vectors<T, 3>(n, 2);
+        const auto e = bench::scalars<T>(n, T(0.2), T(0.6), 3);
+        std::vector<vtx::aabb<T>> poses[2] = {std::vector<vtx::aabb<T>>(n), std::vector<vtx::aabb<T>>(n)};
+        std::vector<vec> steps[2] = {std::vector<vec>(n), std::vector<vec>(n)};
+        for (size_t i = 0; i < n; ++i) {
+            const vec center = c[i] * T(75), step = v[i] * T(0.3);
+            poses[0][i] = vtx::aabb<T>::fromCenter(center, vec(e[i]));
+            poses[1][i] = vtx::aabb<T>::fromCenter(center + step, vec(e[i]));
+            steps[0][i] = -step;
+            steps[1][i] = step;
+        }
+
+        vtx::dynamic_aabb_tree<T> tree;
+        std::vector<std::uint32_t> ids(n);
+        BENCHMARK(bench::name<T>("dynamic tree", "insert build", n)) {
+            tree.clear();
+            tree.reserve(n);
+            for (size_t i = 0; i < n; ++i) ids[i] = tree.insert(poses[0][i], std::uint32_t(i));
+            return tree.height();
+        };
+
+        size_t frame = 0;
+        BENCHMARK(bench::name<T>("dynamic tree", "move frame", n)) {
+            const size_t p = ++frame & 1;
+            size_t moved = 0;
+            for (size_t i = 0; i < n; ++i) moved += tree.move(ids[i], poses[p][i], steps[p][i]);
+            return moved;
+        };
+
+        BENCHMARK(bench::name<T>("dynamic tree", "refit frame seq", n)) {
+            return tree.refit(ids.data(), poses[++frame & 1].data(), n);
+        };
+
+        BENCHMARK(bench::name<T>("dynamic tree", "refit frame par", n)) {
+            return tree.refit(ids.data(), poses[++frame & 1].data(), n, vtx::parallel::policy::par);
+        };
+
+        std::vector<typename vtx::dynamic_aabb_tree<T>::proxy_pair> pairs;
+        pairs.reserve(4 * n);
+        BENCHMARK(bench::name<T>("dynamic tree", "pairs seq", n)) {
+            pairs.clear();
+            tree.pairs(pairs);
+            return pairs.size();
+        };
+
+        BENCHMARK(bench::name<T>("dynamic tree", "pairs par", n)) {
+            pairs.clear();
+            tree.pairs(pairs, vtx::parallel::policy::par);
+            return pairs.size();
+        };
+
+        // Closest fat box along rays through the cube
+        const auto targets = bench::vectors<T, 3>(rayCount, 4);
+        const vec eye(T(10), T(-20), T(-200));
+        std::vector<vtx::ray<T>> rays(rayCount);
+        for (size_t k = 0; k < rayCount; ++k) rays[k] = vtx::ray<T>(eye, targets[k] * T(75) - eye);
+        BENCHMARK(bench::name<T>("dynamic tree", "raycast closest", rayCount)) {
+            size_t hits = 0;
+            for (const auto &r : rays) {
+                bool hit = false;
+                const T inf = std::numeric_limits<T>::infinity();
+                tree.raycast(r, inf, [&]( const std::uint32_t id, const T tMax ) {
+                    T t0, t1;
+                    r.intersect(tree.fatBounds(id), t0, t1);
+                    hit = true;
+                    return t0 < tMax ? t0 : tMax;
+                });
+                hits += hit;
+            }
+            return hits;
+        };
+    }
+
+    template<typename T>
+    void benchSweepAndPrune( ) {
+        using vec = vtx::vector<T, 3>;
+        const size_t n = 200000;
+        const auto c = bench::vectors<T, 3>(n, 5), v = bench::vectors<T, 3>(n, 6);
+        const auto e = bench::scalars<T>(n, T(0.2), T(0.6), 7);
+        vtx::soa_vector<T, 3> mins[2] = {vtx::soa_vector<T, 3>(n), vtx::soa_vector<T, 3>(n)};
+        vtx::soa_vector<T, 3> maxs[2] = {vtx::soa_vector<T, 3>(n), vtx::soa_vector<T, 3>(n)};
+        for (size_t i = 0; i < n; ++i) {
+            const vec center = c[i] * vec(T(10000), T(2), T(2)), step = v[i] * T(0.3);
+            for (size_t p = 0; p < 2; ++p) {
+                mins[p].set(i, center + step * T(p) - vec(e[i]));
+                maxs[p].set(i, center + step * T(p) + vec(e[i]));
+            }
+        }
+
+        vtx::sweep_and_prune<T> sap;
+        BENCHMARK(bench::name<T>("sweep and prune", "radix sort seq", n)) {
+            sap.rebuild(mins[0], maxs[0]);
+            return sap.size();
+        };
+
+        BENCHMARK(bench::name<T>("sweep and prune", "radix sort par", n)) {
+            sap.rebuild(mins[0], maxs[0], vtx::parallel::policy::par);
+            return sap.size();
+        };
+
+        size_t frame = 0;
+        BENCHMARK(bench::name<T>("sweep and prune", "insertion sort frame", n)) {
+            const size_t p = ++frame & 1;
+            return sap.update(mins[p], maxs[p]);
+        };
+
+        // Sorted boxes swept one by one
+        std::vector<vtx::aabb<T>> sorted(n);
+        std::vector<typename vtx::sweep_and_prune<T>::proxy_pair> pairs(4 * n);
+        BENCHMARK(bench::name<T>("sorted aabb", "sweep loop", n)) {
+            for (size_t k = 0; k < n; ++k) {
+                const std::uint32_t id = sap.order()[k];
+                sorted[k] = vtx::aabb<T>(mins[frame & 1].get(id), maxs[frame & 1].get(id));
+            }
+            size_t count = 0;
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = i + 1; j < n && sorted[j].min[0] <= sorted[i].max[0]; ++j)
+                    if (sorted[i].intersects(sorted[j]))
+                        pairs[count++] = std::make_pair(sap.order()[i], sap.order()[j]);
+            return count;
+        };
+
+        BENCHMARK(bench::name<T>("sweep and prune", "pairs seq", n)) {
+            return sap.pairs(pairs.data(), pairs.size());
+        };
+
+        BENCHMARK(bench::name<T>("sweep and prune", "pairs par", n)) {
+            return sap.pairs(pairs.data(), pairs.size(), vtx::parallel::policy::par);
+        };
+    }
+}
+
+TEST_CASE("Dynamic AABB tree benchmarks", "[benchmark][broadphase]") {
+    benchDynamicTree<float>();
+}
+
+TEST_CASE("Sweep and prune benchmarks", "[benchmark][broadphase]") {
+    benchSweepAndPrune<float>();
+}
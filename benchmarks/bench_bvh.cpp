@@ -0,0 +1,103 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Bounding volume hierarchy on a generated mesh: a bumpy sphere of 2 * 512 * 512 triangles.
+// Build time (sequential and parallel), then rays against it: 256 x 256 primary rays of a
+// camera (coherent, scanline order) and as many random rays crossing the mesh (incoherent),
+// single-ray traversal against SIMD packets. Rays per second = rays / mean time.
+
+#include "bench_common.h"
+
+#include "vectrix/geometry/bvh.h"
+
+namespace {
+    template<typename T>
+    struct bumpySphere {
+        static constexpr size_t SEGMENTS = 512;
+
+        std::vector<vtx::vector<T, 3>> vertices;
+        std::vector<std::uint32_t> indices;
+
+        bumpySphere( ) {
+            const size_t s = SEGMENTS;
+            for (size_t i = 0; i <= s; ++i)
+                for (size_t j = 0; j <= s; ++j) {
+                    const double theta = vtx::math::PI * double(i) / double(s);
+                    const double phi = 2 * vtx::math::PI * double(j) / double(s);
+                    const double r = 1 + 0.05 * std::sin(13 * theta) * std::sin(17 * phi);
+                    vertices.emplace_back(T(r * std::sin(theta) * std::cos(phi)), T(r * std::cos(theta)),
+                                          T(r * std::sin(theta) * std::sin(phi)));
+                }
+            for (size_t i = 0; i < s; ++i)
+                for (size_t j = 0; j < s; ++j) {
+                    const std::uint32_t a = std::uint32_t(i * (s + 1) + j), b = a + 1;
+                    const std::uint32_t c = std::uint32_t(a + s + 1), d = c + 1;
+                    indices.insert(indices.end(), {a, c, b, b, c, d});
+                }
+        }
+
+        size_t triangles( ) const { return indices.size() / 3; }
+    };
+
+    template<typename T>
+    void benchBvh( ) {
+        using vec = vtx::vector<T, 3>;
+        const bumpySphere<T> mesh;
+        const size_t tris = mesh.triangles(), side = 256, n = side * side;
+
+        BENCHMARK(bench::name<T>("bvh", "build seq", tris)) {
+            return vtx::bvh<T>(mesh.vertices.data(), mesh.indices.data(), tris).nodes().size();
+        };
+
+        BENCHMARK(bench::name<T>("bvh", "build par", tris)) {
+            return vtx::bvh<T>(mesh.vertices.data(), mesh.indices.data(), tris, vtx::parallel::policy::par)
+                .nodes().size();
+        };
+
+        const vtx::bvh<T> b(mesh.vertices.data(), mesh.indices.data(), tris, vtx::parallel::policy::par);
+        std::vector<vtx::ray<T>> primary(n), random(n);
+        const vec eye(T(0.3), T(0.4), T(-3));
+        for (size_t y = 0; y < side; ++y)
+            for (size_t x = 0; x < side; ++x) {
+                const vec target(T(x) / T(side) * T(2.4) - T(1.2), T(y) / T(side) * T(2.4) - T(1.2), T(0));
+                primary[y * side + x] = vtx::ray<T>(eye, target - eye);
+            }
+        const auto from = bench::vectors<T, 3>(n, 1), to = bench::vectors<T, 3>(n, 2);
+        for (size_t i = 0; i < n; ++i)
+            random[i] = vtx::ray<T>(from[i].normalized() * T(3), to[i] - from[i].normalized() * T(3));
+        std::vector<vtx::ray_hit<T>> hits(n);
+
+        const std::pair<const char *, const std::vector<vtx::ray<T>> *> sets[] = {
+            {"primary", &primary}, {"random", &random}};
+        for (const auto &set : sets) {
+            const std::vector<vtx::ray<T>> &rays = *set.second;
+            const std::string kind = set.first;
+
+            BENCHMARK(bench::name<T>("bvh", kind + " rays single", n)) {
+                for (size_t i = 0; i < n; ++i) {
+                    hits[i] = vtx::ray_hit<T>();
+                    b.intersect(rays[i], hits[i]);
+                }
+                return hits[0].t;
+            };
+
+            BENCHMARK(bench::name<T>("bvh", kind + " rays packet seq", n)) {
+                std::fill(hits.begin(), hits.end(), vtx::ray_hit<T>());
+                b.intersect(rays.data(), hits.data(), n);
+                return hits[0].t;
+            };
+
+            BENCHMARK(bench::name<T>("bvh", kind + " rays packet par", n)) {
+                std::fill(hits.begin(), hits.end(), vtx::ray_hit<T>());
+                b.intersect(rays.data(), hits.data(), n, vtx::parallel::policy::par);
+                return hits[0].t;
+            };
+        }
+    }
+} // namespace
+
+TEST_CASE("Bounding volume hierarchy throughput", "[benchmark][bvh]") {
+    benchBvh<float>();
+    benchBvh<double>();
+}
@@ -0,0 +1,75 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Shared inputs of the benchmarks. Every benchmark name is unique over the whole VTXBench run:
+// benchmarks/compare.py keys the results by name.
+
+#ifndef VECTRIX_BENCH_COMMON_H
+#define VECTRIX_BENCH_COMMON_H
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include "vectrix/math/random.h"
+
+namespace bench {
+    // Operands per iteration of the per-op benchmarks: enough to hide the loop and call
+    // overhead, small enough to stay in L1
+    constexpr size_t OPS = 256;
+
+    // Elements of the batch throughput benchmarks: well past the last level cache
+    constexpr size_t BATCH = size_t(1) << 20;
+
+    template<typename T>
+    const char *typeName( );
+
+    template<>
+    inline const char *typeName<float>( ) {
+        return "float";
+    }
+
+    template<>
+    inline const char *typeName<double>( ) {
+        return "double";
+    }
+
+    // "<what> <type> <op>", e.g. "vec3 float dot x256"
+    template<typename T>
+    std::string name( const std::string &what, const std::string &op, const size_t n = OPS ) {
+        return what + " " + typeName<T>() + " " + op + " x" + std::to_string(n);
+    }
+
+    // Uniform [-1, 1) vectors, the same for every run with the same seed
+    template<typename T, size_t N>
+    std::vector<vtx::vector<T, N>> vectors( const size_t n, const std::uint64_t seed ) {
+        std::vector<vtx::vector<T, N>> v(n);
+        vtx::random::fill(v, T(-1), T(1), seed);
+        return v;
+    }
+
+    // Uniform [-1, 1) matrices with N added to the diagonal (well conditioned for inversion)
+    template<typename T, size_t M, size_t N>
+    std::vector<vtx::matrix<T, M, N>> matrices( const size_t n, const std::uint64_t seed ) {
+        vtx::random::pcg32 engine(seed);
+        std::vector<vtx::matrix<T, M, N>> v(n);
+        for (auto &m : v)
+            for (size_t r = 0; r < M; ++r)
+                for (size_t c = 0; c < N; ++c)
+                    m(r, c) = vtx::random::uniform(engine, T(-1), T(1)) + (r == c ? T(N) : T(0));
+        return v;
+    }
+
+    template<typename T>
+    std::vector<T> scalars( const size_t n, const T min, const T max, const std::uint64_t seed ) {
+        vtx::random::pcg32 engine(seed);
+        std::vector<T> v(n);
+        for (auto &e : v)
+            e = vtx::random::uniform(engine, min, max);
+        return v;
+    }
+} // namespace bench
+
+#endif //VECTRIX_BENCH_COMMON_H
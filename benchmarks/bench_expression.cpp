@@ -0,0 +1,77 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Element-wise chains of the generic vector/matrix.
+// Build with -DVTX_EXPR_TEMPLATES=ON and OFF and compare "chain" against the other two:
+// with expression templates it matches the hand-fused single loop,
+// without them it matches the staged version (one pass and one temporary per operator).
+
+#include <string>
+
+#include <catch2/catch_all.hpp>
+
+#include "vectrix/core/base_matrix.h"
+
+namespace {
+    template<typename T, size_t N>
+    vtx::vector<T, N> ramp( const T start ) {
+        vtx::vector<T, N> v;
+        for (size_t i = 0; i < N; ++i)
+            v[i] = start + T(i) / T(N);
+        return v;
+    }
+
+    template<typename T, size_t N>
+    void benchVectorChain( const char *name ) {
+        const vtx::vector<T, N> a = ramp<T, N>(T(1)), b = ramp<T, N>(T(2)), c = ramp<T, N>(T(3));
+        const T s = T(0.5);
+        vtx::vector<T, N> r;
+
+        BENCHMARK(std::string(name) + " chain a + b * s - c") {
+            r = a + b * s - c;
+            return r[N - 1];
+        };
+
+        // Three passes, like eager operators
+        BENCHMARK(std::string(name) + " staged") {
+            vtx::vector<T, N> t = b;
+            t *= s;
+            r = a;
+            r += t;
+            r -= c;
+            return r[N - 1];
+        };
+
+        // One pass written by hand
+        BENCHMARK(std::string(name) + " fused loop") {
+            for (size_t i = 0; i < N; ++i)
+                r[i] = a[i] + b[i] * s - c[i];
+            return r[N - 1];
+        };
+    }
+} // namespace
+
+TEST_CASE("Vector expression chains", "[benchmark][expression]") {
+    benchVectorChain<double, 64>("vector<double, 64>");
+    benchVectorChain<float, 1024>("vector<float, 1024>");
+}
+
+TEST_CASE("Matrix expression chains", "[benchmark][expression]") {
+    vtx::matrix<double, 32, 32> a(1.0), b(2.0), c(3.0), r;
+
+    BENCHMARK("matrix<double, 32, 32> chain a * 2 + b - c / 4") {
+        r = a * 2.0 + b - c / 4.0;
+        return r(31, 31);
+    };
+
+    BENCHMARK("matrix<double, 32, 32> staged") {
+        vtx::matrix<double, 32, 32> t = a, u = c;
+        t *= 2.0;
+        u /= 4.0;
+        r = t;
+        r += b;
+        r -= u;
+        return r(31, 31);
+    };
+}
@@ -0,0 +1,123 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// vtx::math::fast approximations against the std:: functions over arrays.
+// The fast loops vectorize with -O3 -fno-math-errno -fno-trapping-math (see math/fast.h).
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include "vectrix/math/fast.h"
+
+namespace {
+    template<typename T>
+    std::vector<T> randomArray( const size_t n, const T min, const T max, const unsigned seed ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> dist(min, max);
+        std::vector<T> v(n);
+        for (auto &e : v)
+            e = dist(gen);
+        return v;
+    }
+
+    template<typename T>
+    void benchFastMath( const char *name ) {
+        using vtx::math::fast::accuracy;
+        namespace fast = vtx::math::fast;
+        const size_t n = 4096;
+        const auto angle = randomArray<T>(n, T(-10), T(10), 1);
+        const auto unit = randomArray<T>(n, T(-1), T(1), 2);
+        const auto positive = randomArray<T>(n, T(0.01), T(100), 3);
+        std::vector<T> s(n), c(n);
+
+        BENCHMARK(std::string(name) + " std sin+cos x4096") {
+            for (size_t i = 0; i < n; ++i) {
+                s[i] = std::sin(angle[i]);
+                c[i] = std::cos(angle[i]);
+            }
+            return s[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " fast sincos high x4096") {
+            for (size_t i = 0; i < n; ++i)
+                fast::sincos<accuracy::high>(angle[i], s[i], c[i]);
+            return s[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " fast sincos low x4096") {
+            for (size_t i = 0; i < n; ++i)
+                fast::sincos<accuracy::low>(angle[i], s[i], c[i]);
+            return s[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " std 1/sqrt x4096") {
+            for (size_t i = 0; i < n; ++i)
+                s[i] = T(1) / std::sqrt(positive[i]);
+            return s[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " fast rsqrt medium x4096") {
+            for (size_t i = 0; i < n; ++i)
+                s[i] = fast::rsqrt<accuracy::medium>(positive[i]);
+            return s[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " std acos x4096") {
+            for (size_t i = 0; i < n; ++i)
+                s[i] = std::acos(unit[i]);
+            return s[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " fast acos high x4096") {
+            for (size_t i = 0; i < n; ++i)
+                s[i] = fast::acos<accuracy::high>(unit[i]);
+            return s[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " std cbrt x4096") {
+            for (size_t i = 0; i < n; ++i)
+                s[i] = std::cbrt(unit[i]);
+            return s[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " fast cbrt high x4096") {
+            for (size_t i = 0; i < n; ++i)
+                s[i] = fast::cbrt<accuracy::high>(unit[i]);
+            return s[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " std exp x4096") {
+            for (size_t i = 0; i < n; ++i)
+                s[i] = std::exp(angle[i]);
+            return s[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " fast exp high x4096") {
+            for (size_t i = 0; i < n; ++i)
+                s[i] = fast::exp<accuracy::high>(angle[i]);
+            return s[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " std log x4096") {
+            for (size_t i = 0; i < n; ++i)
+                s[i] = std::log(positive[i]);
+            return s[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " fast log high x4096") {
+            for (size_t i = 0; i < n; ++i)
+                s[i] = fast::log<accuracy::high>(positive[i]);
+            return s[n - 1];
+        };
+    }
+} // namespace
+
+TEST_CASE("Fast approximate math", "[benchmark][fast]") {
+    benchFastMath<float>("float");
+    benchFastMath<double>("double");
+}
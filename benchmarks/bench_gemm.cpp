@@ -0,0 +1,72 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Square dmatrix products: the packed cache-blocked GEMM against the naive triple loop
+// (the only option of the stack-allocated matrix<T, M, N>), sequential and on the default pool.
+
+#include "bench_common.h"
+
+#include "vectrix/core/dmatrix.h"
+
+namespace {
+    template<typename T>
+    vtx::dmatrix<T> randomMatrix( const size_t n, const std::uint64_t seed ) {
+        const auto v = bench::scalars<T>(n * n, T(-1), T(1), seed);
+        vtx::dmatrix<T> a(n, n);
+        std::copy(v.begin(), v.end(), a.data());
+        return a;
+    }
+
+    template<typename T>
+    void benchGemm( const size_t n, const bool naive, const bool par ) {
+        const auto a = randomMatrix<T>(n, 1), b = randomMatrix<T>(n, 2);
+        vtx::dmatrix<T> c(n, n);
+        const std::string what = "dmat" + std::to_string(n);
+
+        BENCHMARK(bench::name<T>(what, "gemm", 1)) {
+            vtx::gemm(T(1), a, b, T(0), c);
+            return c(0, 0);
+        };
+
+        if (par) {
+            BENCHMARK(bench::name<T>(what, "gemm par", 1)) {
+                vtx::gemm(T(1), a, b, T(0), c, vtx::parallel::policy::par);
+                return c(0, 0);
+            };
+        }
+
+        if (!naive)
+            return;
+        BENCHMARK(bench::name<T>(what, "naive product", 1)) {
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = 0; j < n; ++j) {
+                    T sum = T(0);
+                    for (size_t p = 0; p < n; ++p)
+                        sum += a(i, p) * b(p, j);
+                    c(i, j) = sum;
+                }
+            return c(0, 0);
+        };
+    }
+} // namespace
+
+TEST_CASE("Dynamic matrix product", "[benchmark][dmatrix]") {
+    for (const size_t n : {64, 256, 512}) {
+        benchGemm<float>(n, n != 64, n == 512);
+        benchGemm<double>(n, n != 64, n == 512);
+    }
+    benchGemm<float>(2048, false, true);
+}
+
+TEST_CASE("Dynamic matrix transpose", "[benchmark][dmatrix]") {
+    const auto a = randomMatrix<float>(2048, 3);
+
+    BENCHMARK(bench::name<float>("dmat2048", "transpose", 1)) {
+        return a.transpose()(0, 1);
+    };
+
+    BENCHMARK(bench::name<float>("dmat2048", "transpose par", 1)) {
+        return a.transpose(vtx::parallel::policy::par)(0, 1);
+    };
+}
@@ -0,0 +1,77 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Frustum culling of 100k bounds scattered around a perspective camera: a loop over the scalar
+// frustum<T>::intersects against the batch culling (SoA streams and packed arrays, sequential
+// and parallel). Bounds per second = bounds / mean time.
+
+#include "bench_common.h"
+
+#include "vectrix/geometry/frustum.h"
+
+namespace {
+    template<typename T>
+    void benchCulling( ) {
+        using vec = vtx::vector<T, 3>;
+        const size_t n = 100000;
+        const vtx::frustum<T> f(vtx::mat4x4<T>::view(vec(1, 2, 10), vec(0), vec(0, 1, 0)) *
+                                vtx::mat4x4<T>::frustum(T(-1), T(1), T(0.75), T(-0.75), T(1), T(30)));
+
+        const auto c = bench::vectors<T, 3>(n, 1), e = bench::vectors<T, 3>(n, 2);
+        const auto radii = bench::scalars<T>(n, T(0), T(3), 3);
+        std::vector<vtx::aabb<T>> boxes(n);
+        std::vector<vtx::sphere<T>> spheres(n);
+        vtx::soa_vector<T, 3> mins(n), maxs(n), centers(n);
+        for (size_t i = 0; i < n; ++i) {
+            const vec center = c[i] * T(25), extent = (e[i] + vec(T(1))) * T(1.5);
+            boxes[i] = vtx::aabb<T>::fromCenter(center, extent);
+            spheres[i] = vtx::sphere<T>(center, radii[i]);
+            mins.set(i, boxes[i].min);
+            maxs.set(i, boxes[i].max);
+            centers.set(i, center);
+        }
+        std::vector<std::uint32_t> visible(n);
+
+        BENCHMARK(bench::name<T>("aabb", "frustum intersects loop", n)) {
+            size_t count = 0;
+            for (size_t i = 0; i < n; ++i)
+                if (f.intersects(boxes[i]))
+                    visible[count++] = std::uint32_t(i);
+            return count;
+        };
+
+        BENCHMARK(bench::name<T>("frustum", "cull soa aabb seq", n)) {
+            return f.cull(mins, maxs, visible.data());
+        };
+
+        BENCHMARK(bench::name<T>("frustum", "cull soa aabb par", n)) {
+            return f.cull(mins, maxs, visible.data(), vtx::parallel::policy::par);
+        };
+
+        BENCHMARK(bench::name<T>("frustum", "cull aabb array seq", n)) {
+            return f.cull(boxes.data(), n, visible.data());
+        };
+
+        BENCHMARK(bench::name<T>("sphere", "frustum intersects loop", n)) {
+            size_t count = 0;
+            for (size_t i = 0; i < n; ++i)
+                if (f.intersects(spheres[i]))
+                    visible[count++] = std::uint32_t(i);
+            return count;
+        };
+
+        BENCHMARK(bench::name<T>("frustum", "cull soa sphere seq", n)) {
+            return f.cull(centers, radii.data(), visible.data());
+        };
+
+        BENCHMARK(bench::name<T>("frustum", "cull sphere array seq", n)) {
+            return f.cull(spheres.data(), n, visible.data());
+        };
+    }
+} // namespace
+
+TEST_CASE("Frustum culling throughput", "[benchmark][geometry]") {
+    benchCulling<float>();
+    benchCulling<double>();
+}
@@ -0,0 +1,83 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// k-d tree of 1M and 4M uniform points in the [-1, 1) cube: median build, batches of 16384
+// nearest neighbour (k = 1, 8) and radius queries (about 30 points each), on the calling thread
+// and split across the pool. A linear scan of the cloud per query is the baseline for k = 1.
+// Queries per second = queries / mean time.
+
+#include "bench_common.h"
+
+#include "vectrix/geometry/kd_tree.h"
+
+namespace {
+    template<typename T>
+    void benchKdTree( const size_t n ) {
+        const size_t queryCount = 16384;
+        const auto points = bench::vectors<T, 3>(n, 1), queries = bench::vectors<T, 3>(queryCount, 2);
+        // Sphere holding 30 points on average
+        const T r = std::cbrt(T(30) * T(8) / (T(4.18879) * T(n)));
+        // Query benchmarks are named after the cloud size (unique over the run)
+        const std::string cloud = "kd tree " + std::to_string(n >> 20) + "M";
+
+        vtx::kd_tree<T> tree;
+        BENCHMARK(bench::name<T>("kd tree", "build seq", n)) {
+            tree.build(points.data(), n);
+            return tree.depth();
+        };
+
+        BENCHMARK(bench::name<T>("kd tree", "build par", n)) {
+            tree.build(points.data(), n, vtx::parallel::policy::par);
+            return tree.depth();
+        };
+
+        std::vector<std::uint32_t> ids(queryCount * 8);
+        std::vector<T> dist2(queryCount * 8);
+        const vtx::parallel::policy policies[] = {vtx::parallel::policy::seq, vtx::parallel::policy::par};
+        const char *names[] = {"seq", "par"};
+        for (size_t p = 0; p < 2; ++p) {
+            BENCHMARK(bench::name<T>(cloud, std::string("nearest k=1 ") + names[p], queryCount)) {
+                tree.nearest(queries.data(), queryCount, 1, ids.data(), dist2.data(), policies[p]);
+                return ids[0];
+            };
+
+            BENCHMARK(bench::name<T>(cloud, std::string("nearest k=8 ") + names[p], queryCount)) {
+                tree.nearest(queries.data(), queryCount, 8, ids.data(), dist2.data(), policies[p]);
+                return ids[0];
+            };
+        }
+
+        std::vector<std::uint32_t> found;
+        std::vector<size_t> offsets;
+        for (size_t p = 0; p < 2; ++p)
+            BENCHMARK(bench::name<T>(cloud, std::string("radius ") + names[p], queryCount)) {
+                tree.radius(queries.data(), queryCount, r, found, offsets, policies[p]);
+                return found.size();
+            };
+
+        // Every point against every query
+        const size_t bruteCount = 64;
+        BENCHMARK(bench::name<T>(cloud, "point loop nearest k=1", bruteCount)) {
+            std::uint32_t sum = 0;
+            for (size_t q = 0; q < bruteCount; ++q) {
+                T best = std::numeric_limits<T>::infinity();
+                std::uint32_t id = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    const T d = (points[i] - queries[q]).squaredLength();
+                    if (d < best) {
+                        best = d;
+                        id = std::uint32_t(i);
+                    }
+                }
+                sum += id;
+            }
+            return sum;
+        };
+    }
+}
+
+TEST_CASE("k-d tree benchmarks", "[benchmark][kd_tree]") {
+    benchKdTree<float>(1 << 20);
+    benchKdTree<float>(1 << 22);
+}
@@ -0,0 +1,147 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Per-op matrix benchmarks: matrix<T, 2, 2>, <T, 3, 3>, <T, 4, 4> specializations and the generic
+// matrix<T, 6, 6>, over bench::OPS operands per iteration.
+
+#include "bench_common.h"
+
+#include "vectrix/core/vectrix_core.h"
+
+namespace {
+    template<typename T, size_t N>
+    void benchMatrix( const char *what ) {
+        const auto a = bench::matrices<T, N, N>(bench::OPS, 1), b = bench::matrices<T, N, N>(bench::OPS, 2);
+        const auto v = bench::vectors<T, N>(bench::OPS, 3);
+        std::vector<vtx::matrix<T, N, N>> r(bench::OPS);
+        std::vector<vtx::vector<T, N>> rv(bench::OPS);
+        std::vector<T> s(bench::OPS);
+
+        BENCHMARK(bench::name<T>(what, "multiply")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = a[i] * b[i];
+            return r[0](0, 0);
+        };
+
+        BENCHMARK(bench::name<T>(what, "multiply vector")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                rv[i] = a[i] * v[i];
+            return rv[0][0];
+        };
+
+        BENCHMARK(bench::name<T>(what, "add")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = a[i] + b[i];
+            return r[0](0, 0);
+        };
+
+        BENCHMARK(bench::name<T>(what, "transpose")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = a[i].transpose();
+            return r[0](0, 0);
+        };
+
+        BENCHMARK(bench::name<T>(what, "determinant")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                s[i] = a[i].determinant();
+            return s[0];
+        };
+
+        BENCHMARK(bench::name<T>(what, "inverse")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = a[i].inverse();
+            return r[0](0, 0);
+        };
+    }
+
+    template<typename T>
+    void benchTransform( ) {
+        const auto angle = bench::scalars<T>(bench::OPS, T(-180), T(180), 4);
+        const auto p = bench::vectors<T, 3>(bench::OPS, 5);
+        const auto m = bench::matrices<T, 4, 4>(bench::OPS, 6);
+        std::vector<vtx::matrix<T, 4, 4>> r(bench::OPS);
+        std::vector<vtx::vector<T, 3>> rp(bench::OPS);
+
+        BENCHMARK(bench::name<T>("mat4", "rotateX")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = vtx::matrix<T, 4, 4>::rotateX(angle[i]);
+            return r[0](1, 1);
+        };
+
+        BENCHMARK(bench::name<T>("mat4", "rotate axis")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = vtx::matrix<T, 4, 4>::rotate(p[i], angle[i]);
+            return r[0](1, 1);
+        };
+
+        BENCHMARK(bench::name<T>("mat4", "transformPoint")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                rp[i] = m[i].transformPoint(p[i]);
+            return rp[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("mat4", "transformNormal")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                rp[i] = m[i].transformNormal(p[i]);
+            return rp[0][0];
+        };
+
+        // Normals of one object: normal matrix per call against the cache of vtx::transform
+        const vtx::transform<T> object(m[0]);
+        BENCHMARK(bench::name<T>("mat4", "transformNormal same matrix")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                rp[i] = m[0].transformNormal(p[i]);
+            return rp[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("transform", "transformNormal cached")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                rp[i] = object.transformNormal(p[i]);
+            return rp[0][0];
+        };
+
+        // Rigid matrices through the general and the kind-specific inverses
+        std::vector<vtx::matrix<T, 4, 4>> rigid(bench::OPS);
+        for (size_t i = 0; i < bench::OPS; ++i)
+            rigid[i] = vtx::matrix<T, 4, 4>::rotate(p[i].normalized(), angle[i]) *
+                       vtx::matrix<T, 4, 4>::translate(p[i]);
+
+        BENCHMARK(bench::name<T>("mat4 rigid", "inverse")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = rigid[i].inverse();
+            return r[0](0, 0);
+        };
+
+        BENCHMARK(bench::name<T>("mat4 rigid", "inverseAffine")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = rigid[i].inverseAffine();
+            return r[0](0, 0);
+        };
+
+        BENCHMARK(bench::name<T>("mat4 rigid", "inverseRigid")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = rigid[i].inverseRigid();
+            return r[0](0, 0);
+        };
+
+        BENCHMARK(bench::name<T>("mat4 rigid", "transformNormal rigid")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                rp[i] = rigid[i].transformNormal(p[i], vtx::transform_kind::rigid);
+            return rp[0][0];
+        };
+    }
+} // namespace
+
+TEST_CASE("Matrix operations", "[benchmark][matrix]") {
+    benchMatrix<float, 2>("mat2");
+    benchMatrix<double, 2>("mat2");
+    benchMatrix<float, 3>("mat3");
+    benchMatrix<double, 3>("mat3");
+    benchMatrix<float, 4>("mat4");
+    benchMatrix<double, 4>("mat4");
+    benchMatrix<float, 6>("mat6");
+    benchMatrix<double, 6>("mat6");
+    benchTransform<float>();
+    benchTransform<double>();
+}
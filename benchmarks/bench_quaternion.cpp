@@ -0,0 +1,63 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Per-op quaternion benchmarks over bench::OPS operands per iteration.
+
+#include "bench_common.h"
+
+#include "vectrix/core/vectrix_core.h"
+
+namespace {
+    template<typename T>
+    std::vector<vtx::quaternion<T>> quaternions( const size_t n, const std::uint64_t seed ) {
+        const auto v = bench::vectors<T, 4>(n, seed);
+        std::vector<vtx::quaternion<T>> q(n);
+        for (size_t i = 0; i < n; ++i)
+            q[i] = vtx::quaternion<T>(v[i][0], v[i][1], v[i][2], v[i][3]).normalized();
+        return q;
+    }
+
+    template<typename T>
+    void benchQuaternion( ) {
+        const auto a = quaternions<T>(bench::OPS, 1), b = quaternions<T>(bench::OPS, 2);
+        std::vector<vtx::quaternion<T>> r(bench::OPS);
+        std::vector<vtx::matrix<T, 4, 4>> m(bench::OPS);
+        std::vector<vtx::matrix<T, 3, 3>> m3(bench::OPS);
+
+        BENCHMARK(bench::name<T>("quat", "multiply")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = a[i] * b[i];
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("quat", "normalized")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = a[i].normalized();
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("quat", "lerp")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = a[i].lerp(b[i], T(0.25));
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("quat", "rotateMatr")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                m[i] = a[i].rotateMatr();
+            return m[0](0, 0);
+        };
+
+        BENCHMARK(bench::name<T>("quat", "rotateTensor")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                m3[i] = a[i].rotateTensor();
+            return m3[0](0, 0);
+        };
+    }
+} // namespace
+
+TEST_CASE("Quaternion operations", "[benchmark][quaternion]") {
+    benchQuaternion<float>();
+    benchQuaternion<double>();
+}
@@ -0,0 +1,63 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Random vector generation: per-call distributions over mt19937 (the old random::vector),
+// the engines of random.h one vector at a time, and the SIMD Philox bulk fill.
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include "vectrix/math/random.h"
+
+namespace {
+    template<typename T, size_t N>
+    void benchRandom( const char *name ) {
+        const size_t n = 4096;
+        std::vector<vtx::vector<T, N>> out(n);
+
+        BENCHMARK(std::string(name) + " mt19937 + distribution x4096") {
+            static thread_local std::mt19937 gen(1);
+            for (auto &v : out) {
+                std::uniform_real_distribution<T> dist(T(-1), T(1));
+                for (size_t i = 0; i < N; ++i)
+                    v[i] = dist(gen);
+            }
+            return out[n - 1][0];
+        };
+
+        vtx::random::xoshiro256pp xoshiro(1);
+        BENCHMARK(std::string(name) + " xoshiro256++ x4096") {
+            for (auto &v : out)
+                v = vtx::random::vector<T, N>(xoshiro, T(-1), T(1));
+            return out[n - 1][0];
+        };
+
+        vtx::random::pcg32 pcg(1);
+        BENCHMARK(std::string(name) + " pcg32 x4096") {
+            for (auto &v : out)
+                v = vtx::random::vector<T, N>(pcg, T(-1), T(1));
+            return out[n - 1][0];
+        };
+
+        vtx::random::philox4x32 philox(1);
+        BENCHMARK(std::string(name) + " philox4x32 x4096") {
+            for (auto &v : out)
+                v = vtx::random::vector<T, N>(philox, T(-1), T(1));
+            return out[n - 1][0];
+        };
+
+        BENCHMARK(std::string(name) + " philox bulk fill x4096") {
+            vtx::random::fill(out, T(-1), T(1), 1);
+            return out[n - 1][0];
+        };
+    }
+} // namespace
+
+TEST_CASE("Random vector generation", "[benchmark][random]") {
+    benchRandom<float, 4>("vec4<float>");
+    benchRandom<double, 3>("vec3<double>");
+}
@@ -0,0 +1,72 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Batch polynomial solvers against a loop of the scalar ones.
+// Coefficients are random, so the scalar solvers branch unpredictably between cases.
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include "vectrix/math/solvers.h"
+
+namespace {
+    template<typename T>
+    std::vector<T> randomStream( const size_t n, const unsigned seed ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> dist(T(-1), T(1));
+        std::vector<T> v(n);
+        for (auto &e : v)
+            e = dist(gen);
+        return v;
+    }
+
+    template<typename T>
+    void benchRoots( const char *name ) {
+        const size_t n = 4096;
+        const auto a = randomStream<T>(n, 1), b = randomStream<T>(n, 2);
+        const auto c = randomStream<T>(n, 3), d = randomStream<T>(n, 4);
+        std::vector<T> r0(n), r1(n), r2(n);
+        std::vector<std::uint8_t> count(n);
+
+        BENCHMARK(std::string(name) + " Square scalar loop x4096") {
+            for (size_t i = 0; i < n; ++i) {
+                const auto res = vtx::solver::Square(a[i], b[i], c[i]);
+                r0[i] = res.first[0];
+                r1[i] = res.first[1];
+                count[i] = std::uint8_t(res.second);
+            }
+            return r0[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " Square batch x4096") {
+            vtx::solver::Square(a.data(), b.data(), c.data(), n, r0.data(), r1.data(), count.data());
+            return r0[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " Cubic scalar loop x4096") {
+            for (size_t i = 0; i < n; ++i) {
+                const auto res = vtx::solver::Cubic(a[i], b[i], c[i], d[i]);
+                r0[i] = res.first[0];
+                r1[i] = res.first[1];
+                r2[i] = res.first[2];
+                count[i] = std::uint8_t(res.second);
+            }
+            return r0[n - 1];
+        };
+
+        BENCHMARK(std::string(name) + " Cubic batch x4096") {
+            vtx::solver::Cubic(a.data(), b.data(), c.data(), d.data(), n,
+                               r0.data(), r1.data(), r2.data(), count.data());
+            return r0[n - 1];
+        };
+    }
+} // namespace
+
+TEST_CASE("Batch polynomial roots", "[benchmark][solver]") {
+    benchRoots<float>("float");
+    benchRoots<double>("double");
+}
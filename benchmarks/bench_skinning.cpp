@@ -0,0 +1,132 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Skinning throughput of a mesh of bench::BATCH / 16 vertices, 4 influences each, 64 bones:
+// per-vertex loops over the scalar types against the vtx::skinning kernels (sequential and parallel),
+// dual quaternion blending and linear blending of matrix<T, 4, 4> and affine3<T> palettes.
+// Vertices per second = vertices / mean time.
+
+#include "bench_common.h"
+
+#include "vectrix/core/skinning.h"
+
+namespace {
+    template<typename T>
+    struct skinMesh {
+        static constexpr size_t INFLUENCES = 4, BONES = 64;
+
+        std::vector<vtx::dual_quaternion<T>> dq;
+        std::vector<vtx::mat4x4<T>> matrices;
+        std::vector<vtx::affine3<T>> affine;
+        std::vector<std::uint32_t> bones;
+        std::vector<T> weights;
+        std::vector<vtx::vector<T, 3>> positions, normals;
+
+        explicit skinMesh( const size_t n ) : bones(n * INFLUENCES) {
+            const auto q = bench::vectors<T, 4>(BONES, 1), t = bench::vectors<T, 3>(BONES, 2);
+            for (size_t b = 0; b < BONES; ++b)
+                dq.emplace_back(vtx::quaternion<T>(q[b][0], q[b][1], q[b][2], q[b][3]).normalized(), t[b]);
+            matrices = bench::matrices<T, 4, 4>(BONES, 7);
+            for (auto &b : matrices) {
+                for (size_t c = 0; c < 3; ++c) b(c, c) += T(2);
+                b(0, 3) = b(1, 3) = b(2, 3) = T(0);
+                b(3, 3) = T(1);
+                affine.emplace_back(b);
+            }
+
+            const auto w = bench::scalars<T>(n * INFLUENCES, T(0.1), T(1), 3);
+            weights = w;
+            vtx::random::pcg32 engine(4);
+            for (size_t v = 0; v < n; ++v) {
+                T sum = T(0);
+                for (size_t k = 0; k < INFLUENCES; ++k) {
+                    bones[v * INFLUENCES + k] = std::uint32_t(engine() % BONES);
+                    sum += weights[v * INFLUENCES + k];
+                }
+                for (size_t k = 0; k < INFLUENCES; ++k)
+                    weights[v * INFLUENCES + k] /= sum;
+            }
+            positions = bench::vectors<T, 3>(n, 5);
+            normals = bench::vectors<T, 3>(n, 6);
+        }
+    };
+
+    template<typename T>
+    void benchSkinning( ) {
+        const size_t n = bench::BATCH / 16, K = skinMesh<T>::INFLUENCES;
+        const skinMesh<T> m(n);
+        const vtx::soa_vector<T, 3> pos(m.positions.data(), n), nrm(m.normals.data(), n);
+        vtx::soa_vector<T, 3> outPos(n), outNrm(n);
+        std::vector<vtx::vector<T, 3>> rp(n), rn(n);
+
+        BENCHMARK(bench::name<T>("dual_quaternion", "skin loop", n)) {
+            for (size_t v = 0; v < n; ++v) {
+                const auto &first = m.dq[m.bones[v * K]];
+                vtx::dual_quaternion<T> s = first * m.weights[v * K];
+                for (size_t k = 1; k < K; ++k) {
+                    const auto &b = m.dq[m.bones[v * K + k]];
+                    const T d = first.real.X * b.real.X + first.real.Y * b.real.Y + first.real.Z * b.real.Z +
+                                first.real.W * b.real.W;
+                    s = s + b * (d < T(0) ? -m.weights[v * K + k] : m.weights[v * K + k]);
+                }
+                s.normalize();
+                rp[v] = s.transformPoint(m.positions[v]);
+                rn[v] = s.transformVector(m.normals[v]);
+            }
+            return rp[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("skinning", "dualQuaternion seq", n)) {
+            vtx::skinning::dualQuaternion(m.dq.data(), m.bones.data(), m.weights.data(), K, pos, nrm,
+                                          outPos, outNrm);
+            return outPos.data(0)[0];
+        };
+
+        BENCHMARK(bench::name<T>("skinning", "dualQuaternion par", n)) {
+            vtx::skinning::dualQuaternion(m.dq.data(), m.bones.data(), m.weights.data(), K, pos, nrm,
+                                          outPos, outNrm, vtx::parallel::policy::par);
+            return outPos.data(0)[0];
+        };
+
+        BENCHMARK(bench::name<T>("mat4", "skin loop", n)) {
+            for (size_t v = 0; v < n; ++v) {
+                vtx::mat4x4<T> s = m.matrices[m.bones[v * K]] * m.weights[v * K];
+                for (size_t k = 1; k < K; ++k)
+                    s = s + m.matrices[m.bones[v * K + k]] * m.weights[v * K + k];
+                rp[v] = s.transformPoint(m.positions[v]);
+                rn[v] = s.transformNormal(m.normals[v]).normalized();
+            }
+            return rp[0][0];
+        };
+
+        BENCHMARK(bench::name<T>("skinning", "linear mat4 seq", n)) {
+            vtx::skinning::linear(m.matrices.data(), m.bones.data(), m.weights.data(), K, pos, nrm, outPos,
+                                  outNrm);
+            return outPos.data(0)[0];
+        };
+
+        BENCHMARK(bench::name<T>("skinning", "linear mat4 par", n)) {
+            vtx::skinning::linear(m.matrices.data(), m.bones.data(), m.weights.data(), K, pos, nrm, outPos,
+                                  outNrm, vtx::parallel::policy::par);
+            return outPos.data(0)[0];
+        };
+
+        BENCHMARK(bench::name<T>("skinning", "linear affine3 seq", n)) {
+            vtx::skinning::linear(m.affine.data(), m.bones.data(), m.weights.data(), K, pos, nrm, outPos,
+                                  outNrm);
+            return outPos.data(0)[0];
+        };
+
+        BENCHMARK(bench::name<T>("skinning", "linear affine3 par", n)) {
+            vtx::skinning::linear(m.affine.data(), m.bones.data(), m.weights.data(), K, pos, nrm, outPos,
+                                  outNrm, vtx::parallel::policy::par);
+            return outPos.data(0)[0];
+        };
+    }
+} // namespace
+
+TEST_CASE("Skinning throughput", "[benchmark][skinning]") {
+    benchSkinning<float>();
+    benchSkinning<double>();
+}
@@ -0,0 +1,50 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Per-op linear solver benchmarks: solver::linSystem on augmented matrices and lu
+// factorization / solve, over bench::OPS systems per iteration.
+// Polynomial solvers are in bench_roots.cpp.
+
+#include "bench_common.h"
+
+#include "vectrix/core/vectrix_core.h"
+#include "vectrix/math/solvers.h"
+
+namespace {
+    template<typename T, size_t N>
+    void benchLinear( const char *what ) {
+        const auto a = bench::matrices<T, N, N + 1>(bench::OPS, 1);
+        const auto sq = bench::matrices<T, N, N>(bench::OPS, 2);
+        const auto rhs = bench::vectors<T, N>(bench::OPS, 3);
+        std::vector<vtx::vector<T, N>> x(bench::OPS);
+        std::vector<T> s(bench::OPS);
+
+        BENCHMARK(bench::name<T>(what, "linSystem")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                s[i] = vtx::solver::linSystem(a[i]).x(0, 0);
+            return s[0];
+        };
+
+        BENCHMARK(bench::name<T>(what, "lu solve")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                x[i] = vtx::lu<T, N>(sq[i]).solve(rhs[i]);
+            return x[0][0];
+        };
+
+        BENCHMARK(bench::name<T>(what, "lu determinant")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                s[i] = vtx::lu<T, N>(sq[i]).determinant();
+            return s[0];
+        };
+    }
+} // namespace
+
+TEST_CASE("Linear solvers", "[benchmark][solver]") {
+    benchLinear<float, 3>("sys3");
+    benchLinear<double, 3>("sys3");
+    benchLinear<float, 4>("sys4");
+    benchLinear<double, 4>("sys4");
+    benchLinear<float, 8>("sys8");
+    benchLinear<double, 8>("sys8");
+}
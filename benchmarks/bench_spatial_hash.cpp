@@ -0,0 +1,72 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Spatial hash of 1M particles uniform in the [-1, 1) cube, the cell size the radius holding 30
+// particles on average (an SPH smoothing length): rebuild from an array of vectors and from SoA
+// streams, all neighbour pairs (about 15M), and a batch of 16384 radius queries against the same
+// queries on a k-d tree of the particles.
+// Particles (queries) per second = particles (queries) / mean time.
+
+#include "bench_common.h"
+
+#include "vectrix/geometry/kd_tree.h"
+#include "vectrix/geometry/spatial_hash.h"
+
+namespace {
+    template<typename T>
+    void benchSpatialHash( ) {
+        const size_t n = size_t(1) << 20, queryCount = 16384;
+        const auto points = bench::vectors<T, 3>(n, 1), queries = bench::vectors<T, 3>(queryCount, 2);
+        const T h = std::cbrt(T(30) * T(8) / (T(4.18879) * T(n)));
+        vtx::soa_vector<T, 3> soa(n);
+        for (size_t i = 0; i < n; ++i) soa.set(i, points[i]);
+
+        vtx::spatial_hash<T> grid(h);
+        BENCHMARK(bench::name<T>("spatial hash", "build seq", n)) {
+            grid.build(points.data(), n);
+            return grid.bits();
+        };
+
+        BENCHMARK(bench::name<T>("spatial hash", "build par", n)) {
+            grid.build(points.data(), n, vtx::parallel::policy::par);
+            return grid.bits();
+        };
+
+        BENCHMARK(bench::name<T>("spatial hash", "build soa par", n)) {
+            grid.build(soa, vtx::parallel::policy::par);
+            return grid.bits();
+        };
+
+        std::vector<typename vtx::spatial_hash<T>::proxy_pair> pairs(20 * n);
+        BENCHMARK(bench::name<T>("spatial hash", "pairs seq", n)) {
+            return grid.pairs(h, pairs.data(), pairs.size());
+        };
+
+        BENCHMARK(bench::name<T>("spatial hash", "pairs par", n)) {
+            return grid.pairs(h, pairs.data(), pairs.size(), vtx::parallel::policy::par);
+        };
+
+        std::vector<std::uint32_t> found;
+        std::vector<size_t> offsets;
+        BENCHMARK(bench::name<T>("spatial hash", "radius seq", queryCount)) {
+            grid.radius(queries.data(), queryCount, h, found, offsets);
+            return found.size();
+        };
+
+        BENCHMARK(bench::name<T>("spatial hash", "radius par", queryCount)) {
+            grid.radius(queries.data(), queryCount, h, found, offsets, vtx::parallel::policy::par);
+            return found.size();
+        };
+
+        const vtx::kd_tree<T> tree(points.data(), n, vtx::parallel::policy::par);
+        BENCHMARK(bench::name<T>("spatial hash", "kd tree radius seq", queryCount)) {
+            tree.radius(queries.data(), queryCount, h, found, offsets);
+            return found.size();
+        };
+    }
+}
+
+TEST_CASE("Spatial hash benchmarks", "[benchmark][spatial_hash]") {
+    benchSpatialHash<float>();
+}
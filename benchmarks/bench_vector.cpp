@@ -0,0 +1,80 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Per-op vector benchmarks: vector<T, 2>, <T, 3>, <T, 4> specializations and the generic
+// vector<T, N>, over bench::OPS operand pairs per iteration.
+
+#include "bench_common.h"
+
+#include "vectrix/core/vectrix_core.h"
+
+namespace {
+    template<typename T, size_t N>
+    void benchVector( const char *what ) {
+        const auto a = bench::vectors<T, N>(bench::OPS, 1), b = bench::vectors<T, N>(bench::OPS, 2);
+        std::vector<vtx::vector<T, N>> r(bench::OPS);
+        std::vector<T> s(bench::OPS);
+
+        BENCHMARK(bench::name<T>(what, "add")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = a[i] + b[i];
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>(what, "scale")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = a[i] * T(1.5);
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>(what, "dot")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                s[i] = a[i].dot(b[i]);
+            return s[0];
+        };
+
+        BENCHMARK(bench::name<T>(what, "length")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                s[i] = a[i].length();
+            return s[0];
+        };
+
+        BENCHMARK(bench::name<T>(what, "normalized")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = a[i].normalized();
+            return r[0][0];
+        };
+
+        BENCHMARK(bench::name<T>(what, "lerp")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = a[i].lerp(b[i], T(0.25));
+            return r[0][0];
+        };
+    }
+
+    template<typename T>
+    void benchCross( ) {
+        const auto a = bench::vectors<T, 3>(bench::OPS, 1), b = bench::vectors<T, 3>(bench::OPS, 2);
+        std::vector<vtx::vector<T, 3>> r(bench::OPS);
+
+        BENCHMARK(bench::name<T>("vec3", "cross")) {
+            for (size_t i = 0; i < bench::OPS; ++i)
+                r[i] = a[i].cross(b[i]);
+            return r[0][0];
+        };
+    }
+} // namespace
+
+TEST_CASE("Vector operations", "[benchmark][vector]") {
+    benchVector<float, 2>("vec2");
+    benchVector<double, 2>("vec2");
+    benchVector<float, 3>("vec3");
+    benchVector<double, 3>("vec3");
+    benchVector<float, 4>("vec4");
+    benchVector<double, 4>("vec4");
+    benchVector<float, 8>("vec8");
+    benchVector<double, 8>("vec8");
+    benchCross<float>();
+    benchCross<double>();
+}
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+#
+# Created by Timmimin on 17.10.2026.
+#
+
+"""VTXBench results as JSON, and regression check against a stored baseline.
+
+Run the benchmarks with the XML reporter (the JSON below keeps the numbers of every
+BenchmarkResults entry):
+
+    VTXBench "[benchmark]" -r xml -o bench.xml
+    compare.py export bench.xml -o baseline.json
+    compare.py compare baseline.json bench.xml --threshold 0.10
+
+'compare' accepts XML or exported JSON on both sides, prints the ratio current / baseline of
+every benchmark present in both and exits with 1 when one is slower than 1 + threshold and
+its confidence interval does not overlap the baseline one (so noisy runs are not flagged).
+"""
+
+import argparse
+import json
+import platform
+import sys
+import xml.etree.ElementTree as ET
+
+
+def load_xml(path):
+    results = {}
+    for bench in ET.parse(path).getroot().iter('BenchmarkResults'):
+        mean = bench.find('mean')
+        std = bench.find('standardDeviation')
+        results[bench.get('name')] = {
+            'mean_ns': float(mean.get('value')),
+            'lower_ns': float(mean.get('lowerBound')),
+            'upper_ns': float(mean.get('upperBound')),
+            'stddev_ns': float(std.get('value')) if std is not None else 0.0,
+            'samples': int(bench.get('samples')),
+        }
+    return results
+
+
+def load(path):
+    if path.endswith('.json'):
+        with open(path) as f:
+            return {b['name']: b for b in json.load(f)['benchmarks']}
+    return load_xml(path)
+
+
+def export(args):
+    results = load(args.input)
+    doc = {
+        'context': {
+            'machine': platform.machine(),
+            'system': platform.system(),
+            'processor': platform.processor(),
+        },
+        'benchmarks': [dict(name=name, **values) for name, values in sorted(results.items())],
+    }
+    text = json.dumps(doc, indent=2) + '\n'
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    return 0
+
+
+def compare(args):
+    base, cur = load(args.baseline), load(args.current)
+    regressions = 0
+    width = max([len(n) for n in cur] + [4])
+    print('%-*s %14s %14s %8s' % (width, 'name', 'baseline ns', 'current ns', 'ratio'))
+    for name in sorted(cur):
+        if name not in base:
+            print('%-*s %14s %14.1f %8s' % (width, name, '-', cur[name]['mean_ns'], 'new'))
+            continue
+        b, c = base[name], cur[name]
+        ratio = c['mean_ns'] / b['mean_ns'] if b['mean_ns'] > 0 else float('inf')
+        slower = ratio > 1 + args.threshold and c['lower_ns'] > b['upper_ns']
+        regressions += slower
+        print('%-*s %14.1f %14.1f %8.3f%s' % (width, name, b['mean_ns'], c['mean_ns'], ratio,
+                                            '  REGRESSION' if slower else ''))
+    for name in sorted(set(base) - set(cur)):
+        print('%-*s %14.1f %14s %8s' % (width, name, base[name]['mean_ns'], '-', 'missing'))
+
+    if regressions:
+        print('%d benchmark(s) slower than the baseline by more than %.0f%%'
+              % (regressions, args.threshold * 100))
+        return 1
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest='command')
+    sub.required = True
+
+    p = sub.add_parser('export', help='convert Catch2 XML results to JSON')
+    p.add_argument('input')
+    p.add_argument('-o', '--output', help='JSON file (default: stdout)')
+    p.set_defaults(run=export)
+
+    p = sub.add_parser('compare', help='check current results against a baseline')
+    p.add_argument('baseline')
+    p.add_argument('current')
+    p.add_argument('--threshold', type=float, default=0.10,
+                   help='allowed relative slowdown (default: 0.10)')
+    p.set_defaults(run=compare)
+
+    args = parser.parse_args()
+    return args.run(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
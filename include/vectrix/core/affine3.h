@@ -0,0 +1,373 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_AFFINE3_H
+#define VECTRIX_AFFINE3_H
+
+#include <cstdint>
+
+#include "matrix3x3.h"
+#include "matrix4x4.h"
+#include "quaternion.h"
+#include "vector3.h"
+
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/simd/dispatch.h"
+
+namespace vtx {
+	// Affine transform of 3D space in 3x4 storage: matrix<T, 4, 4> without its constant last
+	// column (0, 0, 0, 1), 12 elements instead of 16 and 36 multiplications per product instead of 64.
+	// Same convention as matrix<T, 4, 4>: row vectors, p' = p * L + t, a * b applies a first.
+	// Row c of 'elements' is column c of the equivalent 4x4 matrix (x, y, z coefficients and
+	// translation of output c), so every transformed coordinate is one 4-element dot product.
+	template <typename T>
+	class affine3 {
+	public:
+		// Transforms per task when a batch composition is split across threads
+		static constexpr size_t COMPOSE_GRAIN = 4096;
+
+		T elements[3][4];
+
+		// Class default constructor
+		constexpr affine3() = default;
+
+		// Linear part (as the upper 3x3 of matrix<T, 4, 4>) and translation
+		constexpr explicit affine3(
+		    const matrix<T, 3, 3> &linear, const vector<T, 3> &translation = vector<T, 3>(T(0))) noexcept {
+			for (size_t c = 0; c < 3; ++c) {
+				for (size_t r = 0; r < 3; ++r) {
+					elements[c][r] = linear.elements[r][c];
+				}
+				elements[c][3] = translation[c];
+			}
+		}
+
+		// 4x4 matrix with last column (0, 0, 0, 1), the column is dropped
+		constexpr explicit affine3(const matrix<T, 4, 4> &m) noexcept {
+			for (size_t c = 0; c < 3; ++c) {
+				for (size_t r = 0; r < 4; ++r) {
+					elements[c][r] = m.elements[r][c];
+				}
+			}
+		}
+
+		// Rotation by unit quaternion (as quaternion::rotateMatr), then translation
+		constexpr explicit affine3(
+		    const quaternion<T> &q, const vector<T, 3> &translation = vector<T, 3>(T(0))) noexcept {
+			const T x = q[0], y = q[1], z = q[2], w = q[3];
+			const T x2 = 2 * x * x, y2 = 2 * y * y, z2 = 2 * z * z, xy = 2 * x * y, xz = 2 * x * z,
+			        yz = 2 * y * z, wx = 2 * w * x, wy = 2 * w * y, wz = 2 * w * z;
+			elements[0][0] = 1 - y2 - z2;
+			elements[0][1] = xy - wz;
+			elements[0][2] = xz + wy;
+			elements[1][0] = xy + wz;
+			elements[1][1] = 1 - x2 - z2;
+			elements[1][2] = yz - wx;
+			elements[2][0] = xz - wy;
+			elements[2][1] = yz + wx;
+			elements[2][2] = 1 - x2 - y2;
+			for (size_t c = 0; c < 3; ++c) elements[c][3] = translation[c];
+		}
+
+		// Identity transform
+		static constexpr affine3 identity() noexcept { return scale(vector<T, 3>(T(1))); }
+
+		// Translation transform
+		static constexpr affine3 translate(const vector<T, 3> &v) noexcept {
+			affine3 result = identity();
+			for (size_t c = 0; c < 3; ++c) result.elements[c][3] = v[c];
+			return result;
+		}
+
+		// Scale transform
+		static constexpr affine3 scale(const vector<T, 3> &v) noexcept {
+			affine3 result;
+			for (size_t c = 0; c < 3; ++c) {
+				for (size_t k = 0; k < 4; ++k) {
+					result.elements[c][k] = c == k ? v[c] : T(0);
+				}
+			}
+			return result;
+		}
+
+		// Element of the equivalent matrix<T, 4, 4> (row < 4, col < 3)
+		constexpr T operator()(const size_t row, const size_t col) const {
+#ifdef _DEBUG
+			assert(row < 4 && col < 3);
+#endif  // _DEBUG
+			return elements[col][row];
+		}
+
+		constexpr T &operator()(const size_t row, const size_t col) {
+#ifdef _DEBUG
+			assert(row < 4 && col < 3);
+#endif  // _DEBUG
+			return elements[col][row];
+		}
+
+		// Pointer to data (12 elements)
+		constexpr T *data() noexcept { return elements[0]; }
+		constexpr const T *data() const noexcept { return elements[0]; }
+
+		// Transforms equality operator
+		constexpr bool operator==(const affine3 &a) const noexcept {
+			for (size_t c = 0; c < 3; ++c) {
+				for (size_t k = 0; k < 4; ++k) {
+					if (elements[c][k] != a.elements[c][k]) return false;
+				}
+			}
+			return true;
+		}
+
+		// Transforms inequality operator
+		constexpr bool operator!=(const affine3 &a) const noexcept { return !(*this == a); }
+
+		// Linear part (upper 3x3 of the equivalent 4x4 matrix)
+		constexpr matrix<T, 3, 3> linear() const noexcept {
+			matrix<T, 3, 3> result;
+			for (size_t r = 0; r < 3; ++r) {
+				for (size_t c = 0; c < 3; ++c) {
+					result.elements[r][c] = elements[c][r];
+				}
+			}
+			return result;
+		}
+
+		// Translation part
+		constexpr vector<T, 3> translation() const noexcept {
+			return vector<T, 3>(elements[0][3], elements[1][3], elements[2][3]);
+		}
+
+		// Equivalent 4x4 matrix
+		constexpr matrix<T, 4, 4> toMatrix() const noexcept {
+			matrix<T, 4, 4> result;
+			for (size_t r = 0; r < 4; ++r) {
+				for (size_t c = 0; c < 3; ++c) {
+					result.elements[r][c] = elements[c][r];
+				}
+				result.elements[r][3] = r == 3 ? T(1) : T(0);
+			}
+			return result;
+		}
+
+		// Rotation of the linear part (must be orthonormal with determinant 1) as unit quaternion
+		constexpr quaternion<T> toQuaternion() const noexcept {
+			const T (&e)[3][4] = elements;
+			const T trace = e[0][0] + e[1][1] + e[2][2];
+			if (trace > T(0)) {
+				const T s = vtx::math::sqrt(trace + T(1)) * 2;
+				return quaternion<T>(
+				    (e[2][1] - e[1][2]) / s, (e[0][2] - e[2][0]) / s, (e[1][0] - e[0][1]) / s, s / 4);
+			}
+			if (e[0][0] > e[1][1] && e[0][0] > e[2][2]) {
+				const T s = vtx::math::sqrt(T(1) + e[0][0] - e[1][1] - e[2][2]) * 2;
+				return quaternion<T>(s / 4, (e[0][1] + e[1][0]) / s, (e[0][2] + e[2][0]) / s,
+				    (e[2][1] - e[1][2]) / s);
+			}
+			if (e[1][1] > e[2][2]) {
+				const T s = vtx::math::sqrt(T(1) + e[1][1] - e[0][0] - e[2][2]) * 2;
+				return quaternion<T>((e[0][1] + e[1][0]) / s, s / 4, (e[1][2] + e[2][1]) / s,
+				    (e[0][2] - e[2][0]) / s);
+			}
+			const T s = vtx::math::sqrt(T(1) + e[2][2] - e[0][0] - e[1][1]) * 2;
+			return quaternion<T>((e[0][2] + e[2][0]) / s, (e[1][2] + e[2][1]) / s, s / 4,
+			    (e[1][0] - e[0][1]) / s);
+		}
+
+		// Composition: 'this' first, then b (as the product of the equivalent 4x4 matrices)
+		constexpr affine3 operator*(const affine3 &b) const noexcept {
+			affine3 result;
+			if (simd::affine<T>::enabled && !VTX_IS_CONSTANT_EVALUATED()) {
+				if (simd::affine<T>::compose(data(), b.data(), nullptr, result.data(), 1)) return result;
+			}
+
+			for (size_t c = 0; c < 3; ++c) {
+				const T (&row)[4] = b.elements[c];
+				for (size_t k = 0; k < 4; ++k) {
+					result.elements[c][k] =
+					    row[0] * elements[0][k] + row[1] * elements[1][k] + row[2] * elements[2][k];
+				}
+				result.elements[c][3] += row[3];
+			}
+			return result;
+		}
+
+		// Composition with current
+		constexpr affine3 &operator*=(const affine3 &b) noexcept {
+			*this = *this * b;
+			return *this;
+		}
+
+		// Determinant of the linear part
+		constexpr T determinant() const noexcept {
+			const T (&e)[3][4] = elements;
+			return e[0][0] * (e[1][1] * e[2][2] - e[1][2] * e[2][1]) -
+			    e[0][1] * (e[1][0] * e[2][2] - e[1][2] * e[2][0]) +
+			    e[0][2] * (e[1][0] * e[2][1] - e[1][1] * e[2][0]);
+		}
+
+		// Inverse transform (identity if the linear part is singular)
+		constexpr affine3 inverse() const noexcept {
+			const T (&e)[3][4] = elements;
+			affine3 result;
+			T (&r)[3][4] = result.elements;
+			r[0][0] = e[1][1] * e[2][2] - e[1][2] * e[2][1];
+			r[0][1] = e[0][2] * e[2][1] - e[0][1] * e[2][2];
+			r[0][2] = e[0][1] * e[1][2] - e[0][2] * e[1][1];
+			r[1][0] = e[1][2] * e[2][0] - e[1][0] * e[2][2];
+			r[1][1] = e[0][0] * e[2][2] - e[0][2] * e[2][0];
+			r[1][2] = e[0][2] * e[1][0] - e[0][0] * e[1][2];
+			r[2][0] = e[1][0] * e[2][1] - e[1][1] * e[2][0];
+			r[2][1] = e[0][1] * e[2][0] - e[0][0] * e[2][1];
+			r[2][2] = e[0][0] * e[1][1] - e[0][1] * e[1][0];
+			const T det = e[0][0] * r[0][0] + e[0][1] * r[1][0] + e[0][2] * r[2][0];
+			if (det == T(0)) return identity();
+
+			const T inv = T(1) / det;
+			for (size_t c = 0; c < 3; ++c) {
+				for (size_t k = 0; k < 3; ++k) {
+					r[c][k] *= inv;
+				}
+			}
+			for (size_t c = 0; c < 3; ++c) {
+				r[c][3] = -(r[c][0] * e[0][3] + r[c][1] * e[1][3] + r[c][2] * e[2][3]);
+			}
+			return result;
+		}
+
+		// Inverse of a rigid transform (orthonormal linear part): transposed rotation,
+		// translation negated and rotated back
+		constexpr affine3 inverseRigid() const noexcept {
+			const T (&e)[3][4] = elements;
+			affine3 result;
+			for (size_t c = 0; c < 3; ++c) {
+				for (size_t k = 0; k < 3; ++k) {
+					result.elements[c][k] = e[k][c];
+				}
+				result.elements[c][3] = -(e[0][c] * e[0][3] + e[1][c] * e[1][3] + e[2][c] * e[2][3]);
+			}
+			return result;
+		}
+
+		// Inverse by the known kind of the transform (general is treated as affine)
+		constexpr affine3 inverse(const transform_kind kind) const noexcept {
+			return kind == transform_kind::rigid ? inverseRigid() : inverse();
+		}
+
+		// Normal transform: inverse transpose of the linear part, no translation
+		// (a rigid transform keeps its own linear part)
+		constexpr affine3 normalMatrix(const transform_kind kind = transform_kind::affine) const noexcept {
+			affine3 result;
+			if (kind == transform_kind::rigid) {
+				result = *this;
+			} else {
+				const affine3 inv = inverse();
+				for (size_t c = 0; c < 3; ++c) {
+					for (size_t k = 0; k < 3; ++k) {
+						result.elements[c][k] = inv.elements[k][c];
+					}
+				}
+			}
+			for (size_t c = 0; c < 3; ++c) result.elements[c][3] = T(0);
+			return result;
+		}
+
+		// Transform point (w = 1)
+		constexpr vector<T, 3> transformPoint(const vector<T, 3> &v) const noexcept {
+			return vector<T, 3>{
+			    v[0] * elements[0][0] + v[1] * elements[0][1] + v[2] * elements[0][2] + elements[0][3],
+			    v[0] * elements[1][0] + v[1] * elements[1][1] + v[2] * elements[1][2] + elements[1][3],
+			    v[0] * elements[2][0] + v[1] * elements[2][1] + v[2] * elements[2][2] + elements[2][3]};
+		}
+
+		// Transform vector (w = 0)
+		constexpr vector<T, 3> transformVector(const vector<T, 3> &v) const noexcept {
+			return vector<T, 3>{v[0] * elements[0][0] + v[1] * elements[0][1] + v[2] * elements[0][2],
+			    v[0] * elements[1][0] + v[1] * elements[1][1] + v[2] * elements[1][2],
+			    v[0] * elements[2][0] + v[1] * elements[2][1] + v[2] * elements[2][2]};
+		}
+
+		// Transform normal (compute normalMatrix() once when transforming many normals)
+		constexpr vector<T, 3> transformNormal(
+		    const vector<T, 3> &v, const transform_kind kind = transform_kind::affine) const noexcept {
+			return normalMatrix(kind).transformVector(v);
+		}
+
+		// Batch transforms of 'count' 3-element items at byte strides, in == out allowed
+		// (the kernels of matrix<T, 4, 4>, see transform_kernels.inl)
+		void transformPoint(const T *in, const size_t inStride, T *out, const size_t outStride,
+		    const size_t count, const parallel::policy pol = parallel::policy::seq) const {
+			toMatrix().transformPoint(in, inStride, out, outStride, count, pol);
+		}
+
+		void transformVector(const T *in, const size_t inStride, T *out, const size_t outStride,
+		    const size_t count, const parallel::policy pol = parallel::policy::seq) const {
+			toMatrix().transformVector(in, inStride, out, outStride, count, pol);
+		}
+
+		void transformNormal(const T *in, const size_t inStride, T *out, const size_t outStride,
+		    const size_t count, const transform_kind kind = transform_kind::affine,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			normalMatrix(kind).transformVector(in, inStride, out, outStride, count, pol);
+		}
+
+		void transformPoint(const vector<T, 3> *in, vector<T, 3> *out, const size_t count,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			toMatrix().transformPoint(in, out, count, pol);
+		}
+
+		void transformVector(const vector<T, 3> *in, vector<T, 3> *out, const size_t count,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			toMatrix().transformVector(in, out, count, pol);
+		}
+
+		void transformNormal(const vector<T, 3> *in, vector<T, 3> *out, const size_t count,
+		    const transform_kind kind = transform_kind::affine,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			normalMatrix(kind).transformVector(in, out, count, pol);
+		}
+
+		// Batch composition out[i] = a[i] * b[i] (a[i] first), out may alias a or b
+		static void compose(const affine3 *a, const affine3 *b, affine3 *out, const size_t count,
+		    const parallel::policy pol = parallel::policy::seq) {
+			composeBatch(a, b, nullptr, out, count, pol);
+		}
+
+		// Scene graph level update world[i] = local[i] * parents[parent[i]].
+		// Nodes of one level go in one call (out must not alias the parents of the same call)
+		static void compose(const affine3 *local, const affine3 *parents, const std::uint32_t *parent,
+		    affine3 *world, const size_t count, const parallel::policy pol = parallel::policy::seq) {
+			composeBatch(local, parents, parent, world, count, pol);
+		}
+
+	private:
+		// Composition of one chunk: SIMD kernel of the active backend, or the scalar product
+		static void composeRange(const affine3 *a, const affine3 *b, const std::uint32_t *index,
+		    affine3 *out, const size_t count) {
+			if (simd::affine<T>::compose(reinterpret_cast<const T *>(a), reinterpret_cast<const T *>(b),
+			        index, reinterpret_cast<T *>(out), count))
+				return;
+			for (size_t i = 0; i < count; ++i) out[i] = a[i] * b[index ? size_t(index[i]) : i];
+		}
+
+		static void composeBatch(const affine3 *a, const affine3 *b, const std::uint32_t *index,
+		    affine3 *out, const size_t count, const parallel::policy pol) {
+			if (pol == parallel::policy::seq) {
+				composeRange(a, b, index, out, count);
+				return;
+			}
+			parallel::parallel_for(0, count, COMPOSE_GRAIN, [&](const size_t i, const size_t e) {
+				if (index)
+					composeRange(a + i, b, index + i, out + i, e - i);
+				else
+					composeRange(a + i, b + i, nullptr, out + i, e - i);
+			});
+		}
+	};
+
+	static_assert(sizeof(affine3<float>) == 12 * sizeof(float), "affine3 must be 12 packed elements");
+	static_assert(sizeof(affine3<double>) == 12 * sizeof(double), "affine3 must be 12 packed elements");
+}  // namespace vtx
+
+#endif //VECTRIX_AFFINE3_H
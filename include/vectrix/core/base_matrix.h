@@ -9,10 +9,16 @@
 #include "vectrix/math/common.h"
 
 namespace vtx {
+	template <typename T, size_t N>
+	class lu;
 
 	template <typename T, size_t M, size_t N>
 	class matrix {
 	public:
+		// Generic matrices take part in expression templates (row-major flat order)
+		static constexpr bool expression_leaf = true;
+		static constexpr size_t flat_size = M * N;
+
 #ifndef VTX_NO_ZERO_INIT
 		constexpr matrix() noexcept : elements{} {}
 #else
@@ -142,18 +148,6 @@ namespace vtx {
 		constexpr T* data() noexcept { return &elements[0][0]; }
 		constexpr const T* data() const noexcept { return &elements[0][0]; }
 
-		// Negation operator
-		constexpr matrix operator-() const noexcept {
-			matrix result;
-			for (size_t i = 0; i < M; ++i) {
-				for (size_t j = 0; j < N; ++j) {
-					result.elements[i][j] = -elements[i][j];
-				}
-			}
-
-			return result;
-		}
-
 		// Addition to current operator
 		constexpr matrix& operator+=(const matrix& m) noexcept {
 			for (size_t i = 0; i < M; ++i) {
@@ -165,13 +159,6 @@ namespace vtx {
 			return *this;
 		}
 
-		// Addition operator
-		constexpr matrix operator+(matrix m) const noexcept {
-			matrix result = *this;
-			result += m;
-			return result;
-		}
-
 		// Subtraction from current operator
 		constexpr matrix& operator-=(const matrix& m) noexcept {
 			for (size_t i = 0; i < M; ++i) {
@@ -183,13 +170,6 @@ namespace vtx {
 			return *this;
 		}
 
-		// Subtraction operator
-		constexpr matrix operator-(const matrix& m) const noexcept {
-			matrix result = *this;
-			result -= m;
-			return result;
-		}
-
 		// Scalar multiplication with current operator
 		constexpr matrix& operator*=(T scalar) noexcept {
 			for (size_t i = 0; i < M; ++i) {
@@ -201,13 +181,6 @@ namespace vtx {
 			return *this;
 		}
 
-		// Scalar multiplication operator
-		constexpr matrix operator*(T scalar) const noexcept {
-			matrix result = *this;
-			result *= scalar;
-			return result;
-		}
-
 		// Scalar division with current operator
 		constexpr matrix& operator/=(T scalar) noexcept {
 			for (size_t i = 0; i < M; ++i) {
@@ -219,12 +192,77 @@ namespace vtx {
 			return *this;
 		}
 
+#ifndef VTX_EXPR_TEMPLATES
+		// Negation operator
+		constexpr matrix operator-() const noexcept {
+			matrix result;
+			for (size_t i = 0; i < M; ++i) {
+				for (size_t j = 0; j < N; ++j) {
+					result.elements[i][j] = -elements[i][j];
+				}
+			}
+
+			return result;
+		}
+
+		// Addition operator
+		constexpr matrix operator+(matrix m) const noexcept {
+			matrix result = *this;
+			result += m;
+			return result;
+		}
+
+		// Subtraction operator
+		constexpr matrix operator-(const matrix& m) const noexcept {
+			matrix result = *this;
+			result -= m;
+			return result;
+		}
+
+		// Scalar multiplication operator
+		constexpr matrix operator*(T scalar) const noexcept {
+			matrix result = *this;
+			result *= scalar;
+			return result;
+		}
+
 		// Scalar division operator
 		constexpr matrix operator/(T scalar) const noexcept {
 			matrix result = *this;
 			result /= scalar;
 			return result;
 		}
+#else
+		// Expression evaluation constructor (see expression.h)
+		template <typename E,
+		    typename = typename std::enable_if<expr::is_expression<E>::value &&
+		                                       std::is_same<typename E::result_type, matrix>::value>::type>
+		constexpr matrix(const E& e) noexcept {
+			expr::assign(data(), e);
+		}
+
+		// Expression assignment operator
+		template <typename E>
+		constexpr matrix& operator=(const expr::expression<E>& e) noexcept {
+			static_assert(std::is_same<typename E::result_type, matrix>::value, "Expression shape mismatch");
+			expr::assign(data(), e);
+			return *this;
+		}
+
+		// Expression addition to current operator
+		template <typename E>
+		constexpr matrix& operator+=(const expr::expression<E>& e) noexcept {
+			expr::update<expr::add>(data(), e);
+			return *this;
+		}
+
+		// Expression subtraction from current operator
+		template <typename E>
+		constexpr matrix& operator-=(const expr::expression<E>& e) noexcept {
+			expr::update<expr::sub>(data(), e);
+			return *this;
+		}
+#endif  // VTX_EXPR_TEMPLATES
 
 		// Matrix multiplication (for compatible matrices)
 		template <size_t P>
@@ -296,23 +334,8 @@ namespace vtx {
 				    elements[0][2] *
 				    (elements[1][0] * elements[2][1] - elements[1][1] * elements[2][0]);
 			} else {
-				// General case for NxN matrices (using Laplace expansion)
-				// Note: This is not the most efficient method for large matrices
-				// TODO: Move to high-level methods module?
-				T det = T(0);
-				for (size_t i = 0; i < N; ++i) {
-					matrix<T, M - 1, N - 1> minor;
-					for (size_t j = 1; j < M; ++j) {
-						size_t col = 0;
-						for (size_t k = 0; k < N; ++k) {
-							if (k == i) continue;
-							minor[j - 1][col] = elements[j][k];
-							++col;
-						}
-					}
-					det += (i % 2 == 0 ? 1 : -1) * elements[0][i] * minor.determinant();
-				}
-				return det;
+				// General case: LU decomposition (fraction-free elimination for integers)
+				return determinantImpl(std::is_floating_point<T>());
 			}
 		}
 
@@ -337,42 +360,8 @@ namespace vtx {
 				    (elements[0][1] * elements[2][0] - elements[0][0] * elements[2][1]) / det,
 				    (elements[0][0] * elements[1][1] - elements[0][1] * elements[1][0]) / det);
 			} else {
-				// General case for NxN matrices (using adjugate matrix)
-				// Note: This is not the most efficient method for large matrices
-				// TODO: Move to high-level methods module?
-				T det = determinant();
-				if (det == T(0)) return identity();
-
-				matrix result;
-				matrix<T, M - 1, N - 1> minor;
-
-				for (size_t i = 0; i < M; ++i) {
-					for (size_t j = 0; j < N; ++j) {
-						// Create minor matrix
-						size_t minor_row = 0;
-						for (size_t k = 0; k < M; ++k) {
-							if (k == i) continue;
-							size_t minor_col = 0;
-							for (size_t l = 0; l < N; ++l) {
-								if (l == j) continue;
-								minor[minor_row][minor_col] = elements[k][l];
-								++minor_col;
-							}
-							++minor_row;
-						}
-
-						// Calculate cofactor
-						T cofactor = minor.determinant();
-						if ((i + j) % 2 != 0) {
-							cofactor = -cofactor;
-						}
-
-						// Transpose (adjugate)
-						result[j][i] = cofactor / det;
-					}
-				}
-
-				return result;
+				// General case: LU decomposition with partial pivoting
+				return lu<T, N>(*this).inverse();
 			}
 		}
 
@@ -423,6 +412,13 @@ namespace vtx {
 
 	private:
 		T elements[M][N];
+
+		constexpr T determinantImpl(std::true_type /* floating point */) const noexcept {
+			return lu<T, N>(*this).determinant();
+		}
+		constexpr T determinantImpl(std::false_type /* integral */) const noexcept {
+			return lu<T, N>::exactDeterminant(*this);
+		}
 		static_assert(M > 0 && N > 0, "Matrix dimensions M and N must be greater than zero");
 
 		template <typename, size_t, size_t>
@@ -446,4 +442,7 @@ namespace vtx {
 
 }  // namespace vtx
 
+// Used by determinant() and inverse() of the general case
+#include "lu.h"
+
 #endif  // VECTRIX_BASE_MATRIX_H
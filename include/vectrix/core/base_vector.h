@@ -6,6 +6,8 @@
 #define VECTRIX_BASE_VECTOR_H
 
 #include "vectrix/math/common.h"
+#include "vectrix/math/fast.h"
+#include "expression.h"
 
 // vtx namespace
 namespace vtx
@@ -28,6 +30,10 @@ namespace vtx
                         all_convertible<Rest...>::value> {};
 
     public:
+        // Generic vectors take part in expression templates
+        static constexpr bool expression_leaf = true;
+        static constexpr size_t flat_size = N;
+
         T elements[N];
 
         // Class default constructor
@@ -126,109 +132,119 @@ namespace vtx
             return elements[ind];
         }
 
-        // Negation operator
-        constexpr vector operator-( ) const noexcept {
-            vector result;
+        // Addition to current operator
+        constexpr vector& operator+=( const vector &v ) noexcept {
             for (size_t i = 0; i < N; ++i) {
-                result.elements[i] = -elements[i];
+                elements[i] += v.elements[i];
             }
 
-            return result;
+            return *this;
         }
 
-        // Addition operator
-        constexpr vector operator+( const vector &v ) const noexcept {
-            vector result;
+        // Subtraction from current operator
+        constexpr vector& operator-=( const vector &v ) noexcept {
             for (size_t i = 0; i < N; ++i) {
-                result.elements[i] = elements[i] + v.elements[i];
+                elements[i] -= v.elements[i];
             }
 
-            return result;
+            return *this;
         }
 
-        // Addition to current operator
-        constexpr vector& operator+=( const vector &v ) noexcept {
+        // Multiplication with current operator
+        constexpr vector& operator*=( const vector &v ) noexcept {
             for (size_t i = 0; i < N; ++i) {
-                elements[i] += v.elements[i];
+                elements[i] *= v.elements[i];
             }
 
             return *this;
         }
 
-        // Subtraction operator
-        constexpr vector operator-( const vector &v ) const noexcept {
-            vector result;
+        // Multiplication with current operator
+        constexpr vector& operator*=( const T n ) noexcept {
             for (size_t i = 0; i < N; ++i) {
-                result.elements[i] = elements[i] - v.elements[i];
+                elements[i] *= n;
             }
 
-            return result;
+            return *this;
         }
 
-        // Subtraction from current operator
-        constexpr vector& operator-=( const vector &v ) noexcept {
+        // Division from current operator
+        constexpr vector& operator/=( const vector &v ) noexcept {
             for (size_t i = 0; i < N; ++i) {
-                elements[i] -= v.elements[i];
+                elements[i] /= v.elements[i];
             }
 
             return *this;
         }
 
-        // Multiplication operator
-        constexpr vector operator*( const vector &v ) const noexcept {
+        // Division from current operator
+        constexpr vector& operator/=( const T n ) noexcept {
+            for (size_t i = 0; i < N; ++i) {
+                elements[i] /= n;
+            }
+
+            return *this;
+        }
+
+#ifndef VTX_EXPR_TEMPLATES
+        // Negation operator
+        constexpr vector operator-( ) const noexcept {
             vector result;
             for (size_t i = 0; i < N; ++i) {
-                result.elements[i] = elements[i] * v.elements[i];
+                result.elements[i] = -elements[i];
             }
 
             return result;
         }
 
-        // Multiplication with current operator
-        constexpr vector& operator*=( const vector &v ) noexcept {
+        // Addition operator
+        constexpr vector operator+( const vector &v ) const noexcept {
+            vector result;
             for (size_t i = 0; i < N; ++i) {
-                elements[i] *= v.elements[i];
+                result.elements[i] = elements[i] + v.elements[i];
             }
 
-            return *this;
+            return result;
         }
 
-        // Multiplication operator
-        constexpr vector operator*( const T n ) const noexcept {
+        // Subtraction operator
+        constexpr vector operator-( const vector &v ) const noexcept {
             vector result;
             for (size_t i = 0; i < N; ++i) {
-                result.elements[i] = elements[i] * n;
+                result.elements[i] = elements[i] - v.elements[i];
             }
 
             return result;
         }
 
-        // Multiplication with current operator
-        constexpr vector& operator*=( const T n ) noexcept {
+        // Multiplication operator
+        constexpr vector operator*( const vector &v ) const noexcept {
+            vector result;
             for (size_t i = 0; i < N; ++i) {
-                elements[i] *= n;
+                result.elements[i] = elements[i] * v.elements[i];
             }
 
-            return *this;
+            return result;
         }
 
-        // Division operator
-        constexpr vector operator/( const vector &v ) const noexcept {
+        // Multiplication operator
+        constexpr vector operator*( const T n ) const noexcept {
             vector result;
             for (size_t i = 0; i < N; ++i) {
-                result.elements[i] = elements[i] / v.elements[i];
+                result.elements[i] = elements[i] * n;
             }
 
             return result;
         }
 
-        // Division from current operator
-        constexpr vector& operator/=( const vector &v ) noexcept {
+        // Division operator
+        constexpr vector operator/( const vector &v ) const noexcept {
+            vector result;
             for (size_t i = 0; i < N; ++i) {
-                elements[i] /= v.elements[i];
+                result.elements[i] = elements[i] / v.elements[i];
             }
 
-            return *this;
+            return result;
         }
 
         // Division operator
@@ -240,15 +256,38 @@ namespace vtx
 
             return result;
         }
+#else
+        // Expression evaluation constructor (see expression.h)
+        template<typename E, typename = typename std::enable_if<
+                expr::is_expression<E>::value &&
+                std::is_same<typename E::result_type, vector>::value>::type>
+        constexpr vector( const E &e ) noexcept {
+            expr::assign(elements, e);
+        }
+
+        // Expression assignment operator
+        template<typename E>
+        constexpr vector& operator=( const expr::expression<E> &e ) noexcept {
+            static_assert(std::is_same<typename E::result_type, vector>::value,
+                    "Expression shape mismatch");
+            expr::assign(elements, e);
+            return *this;
+        }
 
-        // Division from current operator
-        constexpr vector& operator/=( const T n ) noexcept {
-            for (size_t i = 0; i < N; ++i) {
-                elements[i] /= n;
-            }
+        // Expression addition to current operator
+        template<typename E>
+        constexpr vector& operator+=( const expr::expression<E> &e ) noexcept {
+            expr::update<expr::add>(elements, e);
+            return *this;
+        }
 
+        // Expression subtraction from current operator
+        template<typename E>
+        constexpr vector& operator-=( const expr::expression<E> &e ) noexcept {
+            expr::update<expr::sub>(elements, e);
             return *this;
         }
+#endif // VTX_EXPR_TEMPLATES
 
         // Dot product function
         constexpr T dot( const vector& v ) const noexcept {
@@ -282,20 +321,12 @@ namespace vtx
 
         // Normalized vector
         constexpr vector normalized( ) const noexcept {
-            T len = length();
-#ifdef _DEBUG
-            assert(len != T(0));
-#endif // _DEBUG
-            return *this / len;
+            return vtx::math::policy::normalized(*this, squaredLength());
         }
 
         // Normalize current vector
         constexpr vector& normalize( ) noexcept {
-            T len = length();
-#ifdef _DEBUG
-            assert(len != T(0));
-#endif // _DEBUG
-            return *this /= len;
+            return *this = vtx::math::policy::normalized(*this, squaredLength());
         }
 
         // Maximal component
@@ -0,0 +1,217 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Packed, cache-blocked matrix multiplication C = alpha * A * B + beta * C (row-major).
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// Loop structure of BLIS: B is packed per KC x NC block into NR-column micro-panels (L3 / L2),
+// A per MC x KC block into MR-row micro-panels (L2), and an MR x NR register tile of batch<T>
+// accumulators walks the KC dimension (L1). Panels are zero padded, so the micro-kernel has
+// no edge cases; partial tiles are written back through a small buffer.
+// Threads share the packed B block and split its block rows (and their column groups):
+// every thread packs its own A block.
+// No include guard on purpose.
+
+namespace gemm_detail {
+	// Tile and block sizes of the backend for T
+	template <typename T>
+	struct blocking {
+		using W = typename batch_for<T>::type;
+
+		// Batches per tile row: the scalar backend takes 4 one-lane batches
+		static constexpr size_t NB = W::size == 1 ? 4 : 2;
+		static constexpr size_t NR = NB * W::size;
+
+		// Tile rows: MR * NB accumulators fit the register file (32 registers on AVX-512)
+		static constexpr size_t MR = W::size == 1 ? 4 : (W::size * sizeof(T) == 64 ? 12 : 6);
+
+		// Depth of a block (A and B micro-panels of this depth stay in L1), A block rows (L2),
+		// B block columns (L3)
+		static constexpr size_t KC = 256;
+		static constexpr size_t MC = MR * (120 / MR);
+		static constexpr size_t NC = 2048;
+	};
+
+	// Rows [0, mc) x columns [0, kc) of a into MR-row panels: element (i * MR + r, p)
+	// goes to panel i at p * MR + r. Rows past mc are zero.
+	template <typename T, size_t MR>
+	inline void packA(const T *a, const size_t lda, const size_t mc, const size_t kc, T *out) noexcept {
+		for (size_t i = 0; i < mc; i += MR) {
+			const size_t rows = mc - i < MR ? mc - i : MR;
+			for (size_t p = 0; p < kc; ++p) {
+				for (size_t r = 0; r < rows; ++r) out[p * MR + r] = a[(i + r) * lda + p];
+				for (size_t r = rows; r < MR; ++r) out[p * MR + r] = T(0);
+			}
+			out += MR * kc;
+		}
+	}
+
+	// Rows [0, kc) x columns [0, nc) of b into NR-column panels: element (p, j * NR + c)
+	// goes to panel j at p * NR + c. Columns past nc are zero.
+	template <typename T, size_t NR>
+	inline void packB(const T *b, const size_t ldb, const size_t kc, const size_t nc, T *out) noexcept {
+		for (size_t j = 0; j < nc; j += NR) {
+			const size_t cols = nc - j < NR ? nc - j : NR;
+			for (size_t p = 0; p < kc; ++p) {
+				const T *row = b + p * ldb + j;
+				for (size_t c = 0; c < cols; ++c) out[p * NR + c] = row[c];
+				for (size_t c = cols; c < NR; ++c) out[p * NR + c] = T(0);
+			}
+			out += NR * kc;
+		}
+	}
+
+	// MR x NR tile of C (mr x nr of it inside the matrix) = alpha * Ap * Bp + beta * C.
+	// beta == 0 does not read C.
+	template <typename T>
+	VTX_FORCEINLINE void microKernel(const size_t kc, const T *a, const T *b, const T alpha, const T beta,
+	    T *c, const size_t ldc, const size_t mr, const size_t nr) noexcept {
+		using B = blocking<T>;
+		using W = typename B::W;
+		constexpr size_t MR = B::MR, NB = B::NB, NR = B::NR;
+
+		W acc[MR][NB];
+		for (size_t r = 0; r < MR; ++r)
+			for (size_t j = 0; j < NB; ++j) acc[r][j] = W::zero();
+
+		for (size_t p = 0; p < kc; ++p) {
+			W bv[NB];
+			for (size_t j = 0; j < NB; ++j) bv[j] = W::load(b + j * W::size);
+			for (size_t r = 0; r < MR; ++r) {
+				const W av = W::set1(a[r]);
+				for (size_t j = 0; j < NB; ++j) acc[r][j] = W::fmadd(av, bv[j], acc[r][j]);
+			}
+			a += MR;
+			b += NR;
+		}
+
+		const W va = W::set1(alpha), vb = W::set1(beta);
+		if (mr == MR && nr == NR) {
+			for (size_t r = 0; r < MR; ++r)
+				for (size_t j = 0; j < NB; ++j) {
+					T *dst = c + r * ldc + j * W::size;
+					const W v = acc[r][j] * va;
+					(beta == T(0) ? v : W::fmadd(vb, W::load(dst), v)).store(dst);
+				}
+			return;
+		}
+
+		// Partial tile at the right or bottom edge
+		T tile[MR * NR];
+		for (size_t r = 0; r < MR; ++r)
+			for (size_t j = 0; j < NB; ++j) (acc[r][j] * va).store(tile + r * NR + j * W::size);
+		for (size_t r = 0; r < mr; ++r)
+			for (size_t j = 0; j < nr; ++j) {
+				T &dst = c[r * ldc + j];
+				dst = beta == T(0) ? tile[r * NR + j] : tile[r * NR + j] + beta * dst;
+			}
+	}
+	// Operands and the current block of one product, shared by the tasks below
+	template <typename T>
+	struct job {
+		const T *a, *b;
+		T *c;
+		size_t m, lda, ldb, ldc;
+		T alpha, beta;
+		// Current B block (columns [jc, jc + nc), depth [pc, pc + kc)) and its packed copy
+		size_t jc, nc, pc, kc;
+		T *packedB;
+		// Tasks of a block: MC rows times 'groupCols' columns, 'groups' per block row
+		size_t groups, groupCols;
+	};
+
+	// Pack NR-column panels [begin, end) of the current B block
+	template <typename T>
+	void packBTask(void *ctx, const size_t begin, const size_t end) {
+		const job<T> &j = *static_cast<const job<T> *>(ctx);
+		constexpr size_t NR = blocking<T>::NR;
+		for (size_t panel = begin; panel < end; ++panel) {
+			const size_t col = panel * NR;
+			packB<T, NR>(j.b + j.pc * j.ldb + j.jc + col, j.ldb, j.kc, j.nc - col < NR ? j.nc - col : NR,
+			    j.packedB + col * j.kc);
+		}
+	}
+
+	// Tasks [begin, end) of the current block: task t is block row t / groups, column group
+	// t % groups. A is packed once per block row into a buffer of the running thread.
+	template <typename T>
+	void blockTask(void *ctx, const size_t begin, const size_t end) {
+		const job<T> &j = *static_cast<const job<T> *>(ctx);
+		using B = blocking<T>;
+		constexpr size_t MR = B::MR, NR = B::NR, KC = B::KC, MC = B::MC;
+
+		static thread_local std::vector<T, aligned_allocator<T>> packedA;
+		if (packedA.size() < MC * KC) packedA.resize(MC * KC);
+
+		// Only the first depth block applies beta, the others accumulate
+		const T beta = j.pc == 0 ? j.beta : T(1);
+		size_t packedRow = ~size_t(0);
+		for (size_t t = begin; t < end; ++t) {
+			const size_t ic = t / j.groups * MC, mc = j.m - ic < MC ? j.m - ic : MC;
+			if (ic != packedRow) {
+				packA<T, MR>(j.a + ic * j.lda + j.pc, j.lda, mc, j.kc, packedA.data());
+				packedRow = ic;
+			}
+
+			const size_t j0 = t % j.groups * j.groupCols;
+			const size_t j1 = j.nc - j0 < j.groupCols ? j.nc : j0 + j.groupCols;
+			for (size_t jr = j0; jr < j1; jr += NR)
+				for (size_t ir = 0; ir < mc; ir += MR)
+					microKernel<T>(j.kc, packedA.data() + ir * j.kc, j.packedB + jr * j.kc, j.alpha, beta,
+					    j.c + (ic + ir) * j.ldc + j.jc + jr, j.ldc, mc - ir < MR ? mc - ir : MR,
+					    j1 - jr < NR ? j1 - jr : NR);
+		}
+	}
+}  // namespace gemm_detail
+
+// C (m x n, row stride ldc) = alpha * A (m x k) * B (k x n) + beta * C.
+// Packing and block tasks go through 'run' (sequential or split across threads), and are
+// sized for 'threads' workers.
+template <typename T>
+inline void gemm(const size_t m, const size_t n, const size_t k, const T alpha, const T *a, const size_t lda,
+    const T *b, const size_t ldb, const T beta, T *c, const size_t ldc, const size_t threads,
+    const dmatrix_detail::range_runner run) {
+	using B = gemm_detail::blocking<T>;
+	constexpr size_t NR = B::NR, KC = B::KC, MC = B::MC, NC = B::NC;
+
+	// Empty inner dimension: C = beta * C
+	if (k == 0) {
+		for (size_t i = 0; i < m; ++i)
+			for (size_t j = 0; j < n; ++j) c[i * ldc + j] = beta == T(0) ? T(0) : beta * c[i * ldc + j];
+		return;
+	}
+
+	// Packed B sized to the actual block (small products do not allocate a full one)
+	const size_t kcMax = k < KC ? k : KC, ncMax = n < NC ? n : NC;
+	std::vector<T, aligned_allocator<T>> packedB(((ncMax + NR - 1) / NR) * NR * kcMax);
+
+	gemm_detail::job<T> j;
+	j.a = a;
+	j.b = b;
+	j.c = c;
+	j.m = m;
+	j.lda = lda;
+	j.ldb = ldb;
+	j.ldc = ldc;
+	j.alpha = alpha;
+	j.beta = beta;
+	j.packedB = packedB.data();
+
+	const size_t rowBlocks = (m + MC - 1) / MC;
+	for (j.jc = 0; j.jc < n; j.jc += NC) {
+		j.nc = n - j.jc < NC ? n - j.jc : NC;
+		const size_t panels = (j.nc + NR - 1) / NR;
+
+		// Split block rows into column groups until there are ~4 tasks per thread
+		const size_t wanted = (4 * threads + rowBlocks - 1) / rowBlocks;
+		const size_t groups = wanted < panels ? wanted : panels;
+		j.groupCols = (panels + groups - 1) / groups * NR;
+		j.groups = (j.nc + j.groupCols - 1) / j.groupCols;
+
+		for (j.pc = 0; j.pc < k; j.pc += KC) {
+			j.kc = k - j.pc < KC ? k - j.pc : KC;
+			run(panels, gemm_detail::packBTask<T>, &j);
+			run(rowBlocks * j.groups, gemm_detail::blockTask<T>, &j);
+		}
+	}
+}
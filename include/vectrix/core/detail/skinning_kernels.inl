@@ -0,0 +1,194 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Stream kernels of vtx::skinning.
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// One vertex per lane: full batches with batch_for<T>::type, the remainder with scalar::batch<T>.
+// Bones are 'stride' consecutive elements of 'palette' (see the layouts below); bones and weights
+// hold K influences per vertex (vertex-major). The batches have no gather, so influence k of the
+// batch goes through an aligned lane buffer; everything after it runs in registers.
+// Positions and normals are x, y, z streams; outputs may alias inputs, normals may be null.
+// No include guard on purpose.
+
+namespace skin_detail {
+	// Bone layouts: blended element c is element offset(c) of the bone
+	struct dual_quaternion_layout {
+		static constexpr size_t size = 8, stride = 8;
+		static constexpr size_t offset(const size_t c) noexcept { return c; }
+	};
+
+	// affine3<T>: row c = coefficients and translation of output c
+	struct affine_layout {
+		static constexpr size_t size = 12, stride = 12;
+		static constexpr size_t offset(const size_t c) noexcept { return c; }
+	};
+
+	// matrix<T, 4, 4> read in affine3<T> order (columns 0..2), the last column is skipped
+	struct mat4_layout {
+		static constexpr size_t size = 12, stride = 16;
+		static constexpr size_t offset(const size_t c) noexcept { return c % 4 * 4 + c / 4; }
+	};
+
+	// Elements of the bones of influence k of vertices i.., and their weights
+	template <typename B, typename L>
+	VTX_FORCEINLINE void gather(const typename B::value_type *palette, const std::uint32_t *bones,
+	    const typename B::value_type *weights, const size_t K, const size_t k, const size_t i,
+	    B (&e)[L::size], B &w) noexcept {
+		using T = typename B::value_type;
+		alignas(64) T lanes[L::size + 1][B::size];
+		for (size_t l = 0; l < B::size; ++l) {
+			const size_t v = (i + l) * K + k;
+			const T *bone = palette + size_t(bones[v]) * L::stride;
+			for (size_t c = 0; c < L::size; ++c) lanes[c][l] = bone[L::offset(c)];
+			lanes[L::size][l] = weights[v];
+		}
+		for (size_t c = 0; c < L::size; ++c) e[c] = B::load(lanes[c]);
+		w = B::load(lanes[L::size]);
+	}
+
+	template <typename B>
+	VTX_FORCEINLINE void cross(const B *a, const B *b, B (&r)[3]) noexcept {
+		r[0] = B::fnmadd(a[2], b[1], a[1] * b[2]);
+		r[1] = B::fnmadd(a[0], b[2], a[2] * b[0]);
+		r[2] = B::fnmadd(a[1], b[0], a[0] * b[1]);
+	}
+
+	// v + w t + u x t, t = 2 (u x v) for the unit quaternion q = (u, w)
+	template <typename B>
+	VTX_FORCEINLINE void rotate(const B *q, const B (&v)[3], B (&r)[3]) noexcept {
+		const B tx = B::fnmadd(q[2], v[1], q[1] * v[2]), ty = B::fnmadd(q[0], v[2], q[2] * v[0]),
+		        tz = B::fnmadd(q[1], v[0], q[0] * v[1]);
+		const B sx = tx + tx, sy = ty + ty, sz = tz + tz;
+		r[0] = B::fmadd(q[3], sx, v[0] + B::fnmadd(q[2], sy, q[1] * sz));
+		r[1] = B::fmadd(q[3], sy, v[1] + B::fnmadd(q[0], sz, q[2] * sx));
+		r[2] = B::fmadd(q[3], sz, v[2] + B::fnmadd(q[1], sx, q[0] * sy));
+	}
+
+	template <typename B>
+	VTX_FORCEINLINE void load3(const typename B::value_type *const *p, const size_t i, B (&v)[3]) noexcept {
+		for (size_t c = 0; c < 3; ++c) v[c] = B::load(p[c] + i);
+	}
+
+	template <typename B>
+	VTX_FORCEINLINE void store3(const B (&v)[3], typename B::value_type *const *p, const size_t i) noexcept {
+		for (size_t c = 0; c < 3; ++c) v[c].store(p[c] + i);
+	}
+
+	// Dual quaternion linear blending: the weighted sum of the bones (each flipped into the
+	// hemisphere of the first influence), normalized by the length of its real part
+	template <typename B>
+	VTX_FORCEINLINE void dualQuaternionStep(const typename B::value_type *palette,
+	    const std::uint32_t *bones, const typename B::value_type *weights, const size_t K,
+	    const typename B::value_type *const *pos, const typename B::value_type *const *nrm,
+	    typename B::value_type *const *outPos, typename B::value_type *const *outNrm,
+	    const size_t i) noexcept {
+		using T = typename B::value_type;
+		B e[8], w, first[4], s[8];
+		gather<B, dual_quaternion_layout>(palette, bones, weights, K, 0, i, e, w);
+		for (size_t c = 0; c < 4; ++c) first[c] = e[c];
+		for (size_t c = 0; c < 8; ++c) s[c] = w * e[c];
+
+		for (size_t k = 1; k < K; ++k) {
+			gather<B, dual_quaternion_layout>(palette, bones, weights, K, k, i, e, w);
+			const B d =
+			    B::fmadd(first[3], e[3], B::fmadd(first[2], e[2], B::fmadd(first[1], e[1], first[0] * e[0])));
+			w = B::select(d < B::zero(), -w, w);
+			for (size_t c = 0; c < 8; ++c) s[c] = B::fmadd(w, e[c], s[c]);
+		}
+
+		const B len2 = B::fmadd(s[3], s[3], B::fmadd(s[2], s[2], B::fmadd(s[1], s[1], s[0] * s[0])));
+		const B inv = B::set1(T(1)) / B::sqrt(len2);
+		for (size_t c = 0; c < 8; ++c) s[c] = s[c] * inv;
+
+		// Translation: vector part of 2 * dual * conjugate(real)
+		const B *r = s, *d = s + 4;
+		const B tx = B::fnmadd(r[2], d[1], B::fmadd(r[1], d[2], B::fnmadd(d[3], r[0], r[3] * d[0])));
+		const B ty = B::fnmadd(r[0], d[2], B::fmadd(r[2], d[0], B::fnmadd(d[3], r[1], r[3] * d[1])));
+		const B tz = B::fnmadd(r[1], d[0], B::fmadd(r[0], d[1], B::fnmadd(d[3], r[2], r[3] * d[2])));
+
+		B v[3], out[3];
+		load3(pos, i, v);
+		rotate(r, v, out);
+		out[0] = out[0] + (tx + tx);
+		out[1] = out[1] + (ty + ty);
+		out[2] = out[2] + (tz + tz);
+		store3(out, outPos, i);
+
+		if (nrm) {
+			load3(nrm, i, v);
+			rotate(r, v, out);
+			store3(out, outNrm, i);
+		}
+	}
+
+	// Linear blend skinning: the weighted sum of the affine bones. Normals go through the
+	// cofactor matrix of the blended linear part (its inverse transpose up to the determinant)
+	// and are renormalized
+	template <typename B, typename L>
+	VTX_FORCEINLINE void linearStep(const typename B::value_type *palette, const std::uint32_t *bones,
+	    const typename B::value_type *weights, const size_t K, const typename B::value_type *const *pos,
+	    const typename B::value_type *const *nrm, typename B::value_type *const *outPos,
+	    typename B::value_type *const *outNrm, const size_t i) noexcept {
+		using T = typename B::value_type;
+		B e[12], w, s[12];
+		gather<B, L>(palette, bones, weights, K, 0, i, e, w);
+		for (size_t c = 0; c < 12; ++c) s[c] = w * e[c];
+		for (size_t k = 1; k < K; ++k) {
+			gather<B, L>(palette, bones, weights, K, k, i, e, w);
+			for (size_t c = 0; c < 12; ++c) s[c] = B::fmadd(w, e[c], s[c]);
+		}
+
+		B v[3], out[3];
+		load3(pos, i, v);
+		for (size_t c = 0; c < 3; ++c) {
+			const B *row = s + 4 * c;
+			out[c] = B::fmadd(v[0], row[0], B::fmadd(v[1], row[1], B::fmadd(v[2], row[2], row[3])));
+		}
+		store3(out, outPos, i);
+
+		if (nrm) {
+			B cof[3][3];
+			cross(s + 4, s + 8, cof[0]);
+			cross(s + 8, s, cof[1]);
+			cross(s, s + 4, cof[2]);
+			const B det = B::fmadd(s[2], cof[0][2], B::fmadd(s[1], cof[0][1], s[0] * cof[0][0]));
+
+			load3(nrm, i, v);
+			for (size_t c = 0; c < 3; ++c)
+				out[c] = B::fmadd(v[2], cof[c][2], B::fmadd(v[1], cof[c][1], v[0] * cof[c][0]));
+			const B len2 = B::fmadd(out[2], out[2], B::fmadd(out[1], out[1], out[0] * out[0]));
+			const B one = B::set1(T(1));
+			const B scale = B::select(det < B::zero(), -one, one) / B::sqrt(len2);
+			for (size_t c = 0; c < 3; ++c) out[c] = out[c] * scale;
+			store3(out, outNrm, i);
+		}
+	}
+}  // namespace skin_detail
+
+// Dual quaternion skinning of n vertices, palette of 8 elements (real, dual) per bone
+template <typename T>
+inline void skinDualQuaternion(const T *palette, const std::uint32_t *bones, const T *weights, const size_t K,
+    const T *const *pos, const T *const *nrm, T *const *outPos, T *const *outNrm, const size_t n) noexcept {
+	using W = typename batch_for<T>::type;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size)
+		skin_detail::dualQuaternionStep<W>(palette, bones, weights, K, pos, nrm, outPos, outNrm, i);
+	for (; i < n; ++i)
+		skin_detail::dualQuaternionStep<scalar::batch<T>>(
+		    palette, bones, weights, K, pos, nrm, outPos, outNrm, i);
+}
+
+// Linear blend skinning of n vertices, palette of affine3<T> or matrix<T, 4, 4> (Mat4) bones
+template <typename T, bool Mat4>
+inline void skinLinear(const T *palette, const std::uint32_t *bones, const T *weights, const size_t K,
+    const T *const *pos, const T *const *nrm, T *const *outPos, T *const *outNrm, const size_t n) noexcept {
+	using W = typename batch_for<T>::type;
+	using L = typename std::conditional<Mat4, skin_detail::mat4_layout, skin_detail::affine_layout>::type;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size)
+		skin_detail::linearStep<W, L>(palette, bones, weights, K, pos, nrm, outPos, outNrm, i);
+	for (; i < n; ++i)
+		skin_detail::linearStep<scalar::batch<T>, L>(
+		    palette, bones, weights, K, pos, nrm, outPos, outNrm, i);
+}
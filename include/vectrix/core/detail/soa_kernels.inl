@@ -0,0 +1,160 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Stream kernels of soa_vector<T, N>.
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// Every kernel takes N component pointers per operand and n elements,
+// runs full batches with batch_for<T>::type and the remainder with scalar::batch<T>.
+// Outputs may alias inputs element for element (in-place operations).
+// Per-batch steps live in soa_detail and are called qualified (no ADL between backends).
+// No include guard on purpose.
+
+namespace soa_detail {
+	template <typename B, size_t N>
+	VTX_FORCEINLINE void soaDotStep(
+	    const typename B::value_type *const *a, const typename B::value_type *const *b, size_t i,
+	    typename B::value_type *out) noexcept {
+		B s = B::load(a[0] + i) * B::load(b[0] + i);
+		for (size_t k = 1; k < N; ++k) s = B::fmadd(B::load(a[k] + i), B::load(b[k] + i), s);
+		s.store(out + i);
+	}
+
+	template <typename B, size_t N>
+	VTX_FORCEINLINE void soaDotVecStep(const typename B::value_type *const *a, const B *v, size_t i,
+	    typename B::value_type *out) noexcept {
+		B s = B::load(a[0] + i) * v[0];
+		for (size_t k = 1; k < N; ++k) s = B::fmadd(B::load(a[k] + i), v[k], s);
+		s.store(out + i);
+	}
+
+	template <typename B, size_t N>
+	VTX_FORCEINLINE void soaSquaredLengthStep(
+	    const typename B::value_type *const *a, size_t i, typename B::value_type *out) noexcept {
+		B x = B::load(a[0] + i);
+		B s = x * x;
+		for (size_t k = 1; k < N; ++k) {
+			x = B::load(a[k] + i);
+			s = B::fmadd(x, x, s);
+		}
+		s.store(out + i);
+	}
+
+	template <typename B, size_t N>
+	VTX_FORCEINLINE void soaNormalizeStep(
+	    const typename B::value_type *const *a, typename B::value_type *const *r, size_t i) noexcept {
+		B x[N];
+		x[0] = B::load(a[0] + i);
+		B s = x[0] * x[0];
+		for (size_t k = 1; k < N; ++k) {
+			x[k] = B::load(a[k] + i);
+			s = B::fmadd(x[k], x[k], s);
+		}
+
+		const B inv = B::set1(typename B::value_type(1)) / B::sqrt(s);
+		for (size_t k = 0; k < N; ++k) (x[k] * inv).store(r[k] + i);
+	}
+
+	template <typename B, size_t N>
+	VTX_FORCEINLINE void soaLerpStep(const typename B::value_type *const *a,
+	    const typename B::value_type *const *b, B t, typename B::value_type *const *r,
+	    size_t i) noexcept {
+		for (size_t k = 0; k < N; ++k) {
+			const B x = B::load(a[k] + i);
+			B::fmadd(t, B::load(b[k] + i) - x, x).store(r[k] + i);
+		}
+	}
+
+	template <typename B, size_t N, bool Max>
+	VTX_FORCEINLINE void soaMinMaxStep(const typename B::value_type *const *a,
+	    const typename B::value_type *const *b, typename B::value_type *const *r, size_t i) noexcept {
+		for (size_t k = 0; k < N; ++k) {
+			const B x = B::load(a[k] + i), y = B::load(b[k] + i);
+			(Max ? B::max(x, y) : B::min(x, y)).store(r[k] + i);
+		}
+	}
+
+	template <typename B>
+	VTX_FORCEINLINE void soaCrossStep(const typename B::value_type *const *a,
+	    const typename B::value_type *const *b, typename B::value_type *const *r, size_t i) noexcept {
+		const B ax = B::load(a[0] + i), ay = B::load(a[1] + i), az = B::load(a[2] + i);
+		const B bx = B::load(b[0] + i), by = B::load(b[1] + i), bz = B::load(b[2] + i);
+		B::fnmadd(az, by, ay * bz).store(r[0] + i);
+		B::fnmadd(ax, bz, az * bx).store(r[1] + i);
+		B::fnmadd(ay, bx, ax * by).store(r[2] + i);
+	}
+}  // namespace soa_detail
+
+// Element-wise dot product of two streams
+template <typename T, size_t N>
+inline void soaDot(const T *const *a, const T *const *b, const size_t n, T *out) noexcept {
+	using W = typename batch_for<T>::type;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) soa_detail::soaDotStep<W, N>(a, b, i, out);
+	for (; i < n; ++i) soa_detail::soaDotStep<scalar::batch<T>, N>(a, b, i, out);
+}
+
+// Dot product of every element with one vector
+template <typename T, size_t N>
+inline void soaDotVec(const T *const *a, const T *v, const size_t n, T *out) noexcept {
+	using W = typename batch_for<T>::type;
+	W wv[N];
+	scalar::batch<T> sv[N];
+	for (size_t k = 0; k < N; ++k) {
+		wv[k] = W::set1(v[k]);
+		sv[k] = scalar::batch<T>::set1(v[k]);
+	}
+
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) soa_detail::soaDotVecStep<W, N>(a, wv, i, out);
+	for (; i < n; ++i) soa_detail::soaDotVecStep<scalar::batch<T>, N>(a, sv, i, out);
+}
+
+// Squared length of every element
+template <typename T, size_t N>
+inline void soaSquaredLength(const T *const *a, const size_t n, T *out) noexcept {
+	using W = typename batch_for<T>::type;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) soa_detail::soaSquaredLengthStep<W, N>(a, i, out);
+	for (; i < n; ++i) soa_detail::soaSquaredLengthStep<scalar::batch<T>, N>(a, i, out);
+}
+
+// Normalize every element (one square root and one division per element)
+template <typename T, size_t N>
+inline void soaNormalize(const T *const *a, T *const *r, const size_t n) noexcept {
+	using W = typename batch_for<T>::type;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) soa_detail::soaNormalizeStep<W, N>(a, r, i);
+	for (; i < n; ++i) soa_detail::soaNormalizeStep<scalar::batch<T>, N>(a, r, i);
+}
+
+// Linear interpolation a + t * (b - a)
+template <typename T, size_t N>
+inline void soaLerp(
+    const T *const *a, const T *const *b, const T t, T *const *r, const size_t n) noexcept {
+	using W = typename batch_for<T>::type;
+	const W wt = W::set1(t);
+	const scalar::batch<T> st = scalar::batch<T>::set1(t);
+
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) soa_detail::soaLerpStep<W, N>(a, b, wt, r, i);
+	for (; i < n; ++i) soa_detail::soaLerpStep<scalar::batch<T>, N>(a, b, st, r, i);
+}
+
+// Component-wise minimum / maximum
+template <typename T, size_t N, bool Max>
+inline void soaMinMax(const T *const *a, const T *const *b, T *const *r, const size_t n) noexcept {
+	using W = typename batch_for<T>::type;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) soa_detail::soaMinMaxStep<W, N, Max>(a, b, r, i);
+	for (; i < n; ++i) soa_detail::soaMinMaxStep<scalar::batch<T>, N, Max>(a, b, r, i);
+}
+
+// Cross product of 3-component streams
+template <typename T>
+inline void soaCross(const T *const *a, const T *const *b, T *const *r, const size_t n) noexcept {
+	using W = typename batch_for<T>::type;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) soa_detail::soaCrossStep<W>(a, b, r, i);
+	for (; i < n; ++i) soa_detail::soaCrossStep<scalar::batch<T>>(a, b, r, i);
+}
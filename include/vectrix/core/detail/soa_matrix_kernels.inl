@@ -0,0 +1,159 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Stream kernels of soa_matrix<T, N, N> determinants and inverses (N = 3, 4).
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// Every kernel takes N * N element pointers (row-major order) per operand and n matrices, one
+// matrix per lane: full batches with batch_for<T>::type, the remainder with scalar::batch<T>.
+// The 4x4 forms share the twelve 2x2 sub-determinants of the row pairs (0, 1) and (2, 3)
+// between the determinant and all sixteen cofactors.
+// Outputs may alias inputs (every matrix is loaded before it is written).
+// No include guard on purpose.
+
+namespace soa_matrix_detail {
+	// Adjugate of a 3x3 matrix into r, returns the determinant
+	template <typename B>
+	VTX_FORCEINLINE B adjugate(const B (&m)[9], B (&r)[9]) noexcept {
+		r[0] = m[4] * m[8] - m[5] * m[7];
+		r[1] = m[2] * m[7] - m[1] * m[8];
+		r[2] = m[1] * m[5] - m[2] * m[4];
+		r[3] = m[5] * m[6] - m[3] * m[8];
+		r[4] = m[0] * m[8] - m[2] * m[6];
+		r[5] = m[2] * m[3] - m[0] * m[5];
+		r[6] = m[3] * m[7] - m[4] * m[6];
+		r[7] = m[1] * m[6] - m[0] * m[7];
+		r[8] = m[0] * m[4] - m[1] * m[3];
+		return m[0] * r[0] + m[1] * r[3] + m[2] * r[6];
+	}
+
+	template <typename B>
+	VTX_FORCEINLINE B determinant(const B (&m)[9]) noexcept {
+		return m[0] * (m[4] * m[8] - m[5] * m[7]) - m[1] * (m[3] * m[8] - m[5] * m[6]) +
+		    m[2] * (m[3] * m[7] - m[4] * m[6]);
+	}
+
+	// 2x2 sub-determinants of rows 0, 1 (s) and rows 2, 3 (c) of a 4x4 matrix
+	template <typename B>
+	VTX_FORCEINLINE void subDeterminants(const B (&m)[16], B (&s)[6], B (&c)[6]) noexcept {
+		s[0] = m[0] * m[5] - m[4] * m[1];
+		s[1] = m[0] * m[6] - m[4] * m[2];
+		s[2] = m[0] * m[7] - m[4] * m[3];
+		s[3] = m[1] * m[6] - m[5] * m[2];
+		s[4] = m[1] * m[7] - m[5] * m[3];
+		s[5] = m[2] * m[7] - m[6] * m[3];
+
+		c[0] = m[8] * m[13] - m[12] * m[9];
+		c[1] = m[8] * m[14] - m[12] * m[10];
+		c[2] = m[8] * m[15] - m[12] * m[11];
+		c[3] = m[9] * m[14] - m[13] * m[10];
+		c[4] = m[9] * m[15] - m[13] * m[11];
+		c[5] = m[10] * m[15] - m[14] * m[11];
+	}
+
+	template <typename B>
+	VTX_FORCEINLINE B determinant(const B (&s)[6], const B (&c)[6]) noexcept {
+		return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+	}
+
+	template <typename B>
+	VTX_FORCEINLINE B determinant(const B (&m)[16]) noexcept {
+		B s[6], c[6];
+		subDeterminants(m, s, c);
+		return determinant(s, c);
+	}
+
+	// Adjugate of a 4x4 matrix into r, returns the determinant
+	template <typename B>
+	VTX_FORCEINLINE B adjugate(const B (&m)[16], B (&r)[16]) noexcept {
+		B s[6], c[6];
+		subDeterminants(m, s, c);
+
+		r[0] = m[5] * c[5] - m[6] * c[4] + m[7] * c[3];
+		r[1] = m[2] * c[4] - m[1] * c[5] - m[3] * c[3];
+		r[2] = m[13] * s[5] - m[14] * s[4] + m[15] * s[3];
+		r[3] = m[10] * s[4] - m[9] * s[5] - m[11] * s[3];
+
+		r[4] = m[6] * c[2] - m[4] * c[5] - m[7] * c[1];
+		r[5] = m[0] * c[5] - m[2] * c[2] + m[3] * c[1];
+		r[6] = m[14] * s[2] - m[12] * s[5] - m[15] * s[1];
+		r[7] = m[8] * s[5] - m[10] * s[2] + m[11] * s[1];
+
+		r[8] = m[4] * c[4] - m[5] * c[2] + m[7] * c[0];
+		r[9] = m[1] * c[2] - m[0] * c[4] - m[3] * c[0];
+		r[10] = m[12] * s[4] - m[13] * s[2] + m[15] * s[0];
+		r[11] = m[9] * s[2] - m[8] * s[4] - m[11] * s[0];
+
+		r[12] = m[5] * c[1] - m[4] * c[3] - m[6] * c[0];
+		r[13] = m[0] * c[3] - m[1] * c[1] + m[2] * c[0];
+		r[14] = m[13] * s[1] - m[12] * s[3] - m[14] * s[0];
+		r[15] = m[8] * s[3] - m[9] * s[1] + m[10] * s[0];
+		return determinant(s, c);
+	}
+
+	template <typename B, size_t K>
+	VTX_FORCEINLINE void load(const typename B::value_type *const *a, const size_t i, B (&m)[K]) noexcept {
+		for (size_t k = 0; k < K; ++k) m[k] = B::load(a[k] + i);
+	}
+
+	template <typename B, size_t N>
+	VTX_FORCEINLINE void determinantStep(
+	    const typename B::value_type *const *a, const size_t i, typename B::value_type *out) noexcept {
+		B m[N * N];
+		load(a, i, m);
+		determinant(m).store(out + i);
+	}
+
+	// Inverse of B::size matrices, identity in the lanes with |det| <= epsilon (and NaN).
+	// Returns the bits of the singular lanes
+	template <typename B, size_t N>
+	VTX_FORCEINLINE unsigned inverseStep(const typename B::value_type *const *a,
+	    typename B::value_type *const *r, const size_t i, const B epsilon) noexcept {
+		using T = typename B::value_type;
+		B m[N * N], adj[N * N];
+		load(a, i, m);
+		const B det = adjugate(m, adj);
+
+		const auto singular = !(B::abs(det) > epsilon);
+		const B one = B::set1(T(1)), zero = B::zero();
+		const B inv = one / B::select(singular, one, det);
+		for (size_t k = 0; k < N * N; ++k)
+			B::select(singular, k % (N + 1) == 0 ? one : zero, adj[k] * inv).store(r[k] + i);
+		return singular.bits();
+	}
+}  // namespace soa_matrix_detail
+
+// Determinants of n N x N matrices
+template <typename T, size_t N>
+inline void soaDeterminant(const T *const *a, const size_t n, T *out) noexcept {
+	using W = typename batch_for<T>::type;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) soa_matrix_detail::determinantStep<W, N>(a, i, out);
+	for (; i < n; ++i) soa_matrix_detail::determinantStep<scalar::batch<T>, N>(a, i, out);
+}
+
+// Inverses of n N x N matrices. singular[i] (when not null) is 1 for the matrices with
+// |det| <= epsilon, whose inverse is set to identity, and 0 for the others.
+// Returns the singular matrices count
+template <typename T, size_t N>
+inline size_t soaInverse(const T *const *a, T *const *r, const size_t n, const T epsilon,
+    std::uint8_t *singular) noexcept {
+	using W = typename batch_for<T>::type;
+	using S = scalar::batch<T>;
+	const W we = W::set1(epsilon);
+	size_t count = 0, i = 0;
+	for (; i + W::size <= n; i += W::size) {
+		const unsigned bits = soa_matrix_detail::inverseStep<W, N>(a, r, i, we);
+		for (size_t l = 0; l < W::size; ++l) {
+			const unsigned bad = (bits >> l) & 1u;
+			count += bad;
+			if (singular) singular[i + l] = static_cast<std::uint8_t>(bad);
+		}
+	}
+	for (; i < n; ++i) {
+		const unsigned bad = soa_matrix_detail::inverseStep<S, N>(a, r, i, S::set1(epsilon));
+		count += bad;
+		if (singular) singular[i] = static_cast<std::uint8_t>(bad);
+	}
+	return count;
+}
@@ -0,0 +1,179 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Stream kernels of soa_quaternion<T>.
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// Every kernel takes the x, y, z, w stream pointers per quaternion operand (x, y, z per vector)
+// and n elements, one quaternion per lane: full batches with batch_for<T>::type, the remainder
+// with scalar::batch<T>. Outputs may alias inputs element for element.
+// slerp evaluates acos and sin with the polynomials of vtx::math::fast (high accuracy) on the
+// ranges it needs only: cosines in [0, 1] and angles in [0, pi / 2]. No branches, the nlerp
+// fallback of close quaternions is a select.
+// No include guard on purpose.
+
+namespace soa_quaternion_detail {
+	// c[0] + c[1] * x + ... + c[K - 1] * x^(K - 1), Horner scheme
+	template <typename B, size_t K>
+	VTX_FORCEINLINE B poly(const B x, const double (&c)[K]) noexcept {
+		using T = typename B::value_type;
+		B r = B::set1(T(c[K - 1]));
+		for (size_t i = K - 1; i-- > 0;) r = B::fmadd(r, x, B::set1(T(c[i])));
+		return r;
+	}
+
+	// sin(x), x in [0, pi / 2]: sin(x) up to pi / 4, cos(pi / 2 - x) above
+	template <typename B>
+	VTX_FORCEINLINE B sinHalfPi(const B x) noexcept {
+		using T = typename B::value_type;
+		namespace fd = math::fast::fast_detail;
+		const auto big = x > B::set1(T(math::PI / 4));
+		const B r = B::select(big, B::set1(T(math::PI / 2)) - x, x);
+		const B z = r * r;
+		const bool single = sizeof(T) == 4;
+		const B s = B::fmadd(r * z, single ? poly(z, fd::sinF) : poly(z, fd::sinD), r);
+		const B c = B::fmadd(z * z, single ? poly(z, fd::cosF) : poly(z, fd::cosD),
+		    B::fnmadd(B::set1(T(0.5)), z, B::set1(T(1))));
+		return B::select(big, c, s);
+	}
+
+	// acos(x), x in [0, 1]: asin polynomial on [0, 0.5], acos(x) = 2 asin(sqrt((1 - x) / 2)) above
+	template <typename B>
+	VTX_FORCEINLINE B acosUnit(const B x) noexcept {
+		using T = typename B::value_type;
+		namespace fd = math::fast::fast_detail;
+		const auto big = x > B::set1(T(0.5));
+		const B z = B::select(big, (B::set1(T(1)) - x) * B::set1(T(0.5)), x * x);
+		const B s = B::select(big, B::sqrt(z), x);
+		const B rz = sizeof(T) == 4 ? poly(z, fd::asinF) : poly(z, fd::asinNum) / poly(z, fd::asinDen);
+		const B p = B::fmadd(s * z, rz, s);
+		return B::select(big, p + p, B::set1(T(math::PI / 2)) - p);
+	}
+
+	template <typename B>
+	VTX_FORCEINLINE void loadQuat(
+	    const typename B::value_type *const *a, const size_t i, B (&q)[4]) noexcept {
+		for (size_t k = 0; k < 4; ++k) q[k] = B::load(a[k] + i);
+	}
+
+	template <typename B>
+	VTX_FORCEINLINE B dot(const B (&a)[4], const B (&b)[4]) noexcept {
+		return B::fmadd(a[3], b[3], B::fmadd(a[2], b[2], B::fmadd(a[1], b[1], a[0] * b[0])));
+	}
+
+	// Hamilton product a * b (as quaternion<T>::operator*)
+	template <typename B>
+	VTX_FORCEINLINE void multiplyStep(const typename B::value_type *const *a,
+	    const typename B::value_type *const *b, typename B::value_type *const *r,
+	    const size_t i) noexcept {
+		B p[4], q[4];
+		loadQuat(a, i, p);
+		loadQuat(b, i, q);
+		const B x = B::fnmadd(p[2], q[1], B::fmadd(p[1], q[2], B::fmadd(p[0], q[3], p[3] * q[0])));
+		const B y = B::fmadd(p[2], q[0], B::fmadd(p[1], q[3], B::fnmadd(p[0], q[2], p[3] * q[1])));
+		const B z = B::fmadd(p[2], q[3], B::fnmadd(p[1], q[0], B::fmadd(p[0], q[1], p[3] * q[2])));
+		const B w = B::fnmadd(p[2], q[2], B::fnmadd(p[1], q[1], B::fnmadd(p[0], q[0], p[3] * q[3])));
+		x.store(r[0] + i);
+		y.store(r[1] + i);
+		z.store(r[2] + i);
+		w.store(r[3] + i);
+	}
+
+	// v' = v + w t + u x t, t = 2 (u x v) for the unit quaternion (u, w)
+	template <typename B>
+	VTX_FORCEINLINE void rotateStep(const typename B::value_type *const *q,
+	    const typename B::value_type *const *v, typename B::value_type *const *r,
+	    const size_t i) noexcept {
+		B u[4];
+		loadQuat(q, i, u);
+		const B vx = B::load(v[0] + i), vy = B::load(v[1] + i), vz = B::load(v[2] + i);
+		const B tx = B::fnmadd(u[2], vy, u[1] * vz), ty = B::fnmadd(u[0], vz, u[2] * vx),
+		        tz = B::fnmadd(u[1], vx, u[0] * vy);
+		const B sx = tx + tx, sy = ty + ty, sz = tz + tz;
+		B::fmadd(u[3], sx, vx + B::fnmadd(u[2], sy, u[1] * sz)).store(r[0] + i);
+		B::fmadd(u[3], sy, vy + B::fnmadd(u[0], sz, u[2] * sx)).store(r[1] + i);
+		B::fmadd(u[3], sz, vz + B::fnmadd(u[1], sx, u[0] * sy)).store(r[2] + i);
+	}
+
+	template <typename B>
+	VTX_FORCEINLINE void normalizeStep(const typename B::value_type *const *a,
+	    typename B::value_type *const *r, const size_t i) noexcept {
+		using T = typename B::value_type;
+		B q[4];
+		loadQuat(a, i, q);
+		const B inv = B::set1(T(1)) / B::sqrt(dot(q, q));
+		for (size_t k = 0; k < 4; ++k) (q[k] * inv).store(r[k] + i);
+	}
+
+	// wa * a + wb * b' with b' = +-b on the shortest arc, renormalized in the nlerp lanes.
+	// Slerp lanes with cos > SLERP_NLERP_COS take the nlerp weights too
+	template <typename B, bool Slerp>
+	VTX_FORCEINLINE void interpolateStep(const typename B::value_type *const *a,
+	    const typename B::value_type *const *b, const B t, typename B::value_type *const *r,
+	    const size_t i) noexcept {
+		using T = typename B::value_type;
+		B p[4], q[4];
+		loadQuat(a, i, p);
+		loadQuat(b, i, q);
+		B d = dot(p, q);
+		const auto flip = d < B::zero();
+		for (size_t k = 0; k < 4; ++k) q[k] = B::select(flip, -q[k], q[k]);
+		d = B::abs(d);
+
+		const B one = B::set1(T(1)), nlerpCos = B::set1(quaternion<T>::SLERP_NLERP_COS);
+		B wa = one - t, wb = t;
+		if VTX_CONSTEXPR_IF (Slerp) {
+			const auto linear = d > nlerpCos;
+			const B alpha = acosUnit(d);
+			const B inv = one / sinHalfPi(alpha);
+			wa = B::select(linear, wa, sinHalfPi(wa * alpha) * inv);
+			wb = B::select(linear, wb, sinHalfPi(wb * alpha) * inv);
+		}
+
+		for (size_t k = 0; k < 4; ++k) p[k] = B::fmadd(wb, q[k], wa * p[k]);
+		B scale = one / B::sqrt(dot(p, p));
+		if VTX_CONSTEXPR_IF (Slerp) scale = B::select(d > nlerpCos, scale, one);
+		for (size_t k = 0; k < 4; ++k) (p[k] * scale).store(r[k] + i);
+	}
+}  // namespace soa_quaternion_detail
+
+// Hamilton products a[i] * b[i]
+template <typename T>
+inline void soaQuatMultiply(const T *const *a, const T *const *b, T *const *r, const size_t n) noexcept {
+	using W = typename batch_for<T>::type;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) soa_quaternion_detail::multiplyStep<W>(a, b, r, i);
+	for (; i < n; ++i) soa_quaternion_detail::multiplyStep<scalar::batch<T>>(a, b, r, i);
+}
+
+// Vectors v[i] rotated by unit quaternions q[i]
+template <typename T>
+inline void soaQuatRotate(const T *const *q, const T *const *v, T *const *r, const size_t n) noexcept {
+	using W = typename batch_for<T>::type;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) soa_quaternion_detail::rotateStep<W>(q, v, r, i);
+	for (; i < n; ++i) soa_quaternion_detail::rotateStep<scalar::batch<T>>(q, v, r, i);
+}
+
+template <typename T>
+inline void soaQuatNormalize(const T *const *a, T *const *r, const size_t n) noexcept {
+	using W = typename batch_for<T>::type;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) soa_quaternion_detail::normalizeStep<W>(a, r, i);
+	for (; i < n; ++i) soa_quaternion_detail::normalizeStep<scalar::batch<T>>(a, r, i);
+}
+
+// nlerp / slerp of unit quaternions, t in [0, 1]: one factor (tStride 0) or a stream of n
+template <typename T, bool Slerp>
+inline void soaQuatInterpolate(const T *const *a, const T *const *b, const T *t, const size_t tStride,
+    T *const *r, const size_t n) noexcept {
+	using W = typename batch_for<T>::type;
+	using S = scalar::batch<T>;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) {
+		const W wt = tStride ? W::load(t + i) : W::set1(*t);
+		soa_quaternion_detail::interpolateStep<W, Slerp>(a, b, wt, r, i);
+	}
+	for (; i < n; ++i)
+		soa_quaternion_detail::interpolateStep<S, Slerp>(a, b, S::set1(t[i * tStride]), r, i);
+}
@@ -0,0 +1,76 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Stream kernels of matrix<T, 4, 4> batch transforms (row vectors: r = v * M).
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// Elements are 3 consecutive T at byte strides, so interleaved vertex buffers work as is.
+// Every block is gathered before it is written, in == out is allowed.
+// Kind: 0 - point (w = 1), 1 - vector (w = 0), 2 - point with perspective divide.
+// No include guard on purpose.
+
+namespace transform_detail {
+	// Elements deinterleaved into stack buffers per step (multiple of every batch size)
+	constexpr size_t BLOCK = 128;
+
+	template <typename B, int Kind>
+	VTX_FORCEINLINE void transformBatch(const B *m, typename B::value_type *x,
+	    typename B::value_type *y, typename B::value_type *z) noexcept {
+		using T = typename B::value_type;
+		const B X = B::load(x), Y = B::load(y), Z = B::load(z);
+		B r[3];
+		for (int c = 0; c < 3; ++c) {
+			const B zc = Kind == 1 ? Z * m[8 + c] : B::fmadd(Z, m[8 + c], m[12 + c]);
+			r[c] = B::fmadd(X, m[c], B::fmadd(Y, m[4 + c], zc));
+		}
+		if (Kind == 2) {
+			const B w = B::fmadd(X, m[3], B::fmadd(Y, m[7], B::fmadd(Z, m[11], m[15])));
+			const B inv = B::set1(T(1)) / w;
+			for (int c = 0; c < 3; ++c) r[c] = r[c] * inv;
+		}
+		r[0].store(x);
+		r[1].store(y);
+		r[2].store(z);
+	}
+}  // namespace transform_detail
+
+// Transform n elements by row-major matrix m (16 elements).
+// Blocks are deinterleaved to SoA buffers first, so batch loads never wait on scalar stores.
+template <typename T, int Kind>
+inline void transformStream(const T *m, const BYTE *in, const size_t inStride, BYTE *out,
+    const size_t outStride, const size_t n) noexcept {
+	using W = typename batch_for<T>::type;
+	using S = scalar::batch<T>;
+	W wm[16];
+	S sm[16];
+	for (int k = 0; k < 16; ++k) {
+		wm[k] = W::set1(m[k]);
+		sm[k] = S::set1(m[k]);
+	}
+
+	constexpr size_t BLOCK = transform_detail::BLOCK;
+	alignas(64) T x[BLOCK], y[BLOCK], z[BLOCK];
+	for (size_t b = 0; b < n; b += BLOCK) {
+		const size_t cnt = n - b < BLOCK ? n - b : BLOCK;
+		const BYTE *src = in + b * inStride;
+		for (size_t l = 0; l < cnt; ++l) {
+			const T *p = reinterpret_cast<const T *>(src + l * inStride);
+			x[l] = p[0];
+			y[l] = p[1];
+			z[l] = p[2];
+		}
+
+		size_t i = 0;
+		for (; i + W::size <= cnt; i += W::size)
+			transform_detail::transformBatch<W, Kind>(wm, x + i, y + i, z + i);
+		for (; i < cnt; ++i) transform_detail::transformBatch<S, Kind>(sm, x + i, y + i, z + i);
+
+		BYTE *dst = out + b * outStride;
+		for (size_t l = 0; l < cnt; ++l) {
+			T *p = reinterpret_cast<T *>(dst + l * outStride);
+			p[0] = x[l];
+			p[1] = y[l];
+			p[2] = z[l];
+		}
+	}
+}
@@ -0,0 +1,386 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_DMATRIX_H
+#define VECTRIX_DMATRIX_H
+
+#include <cassert>
+#include <initializer_list>
+#include <vector>
+
+#include "base_matrix.h"
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/simd/dispatch.h"
+#include "vectrix/utils/memory.h"
+
+namespace vtx {
+	namespace dmatrix_detail {
+		// Runs task(ctx, b, e) over [0, n) in one or more calls (see gemm_kernels.inl)
+		using range_runner = void (*)(size_t n, void (*task)(void *, size_t, size_t), void *ctx);
+	}  // namespace dmatrix_detail
+}  // namespace vtx
+
+#define VTX_SIMD_KERNELS "vectrix/core/detail/gemm_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
+
+namespace vtx {
+	namespace dmatrix_detail {
+		// Products up to this many multiply-adds skip packing (plain i-k-j loops)
+		constexpr size_t SMALL_GEMM = 32 * 32 * 32;
+
+		// Products below this many multiply-adds stay on the calling thread under policy::par
+		constexpr size_t PARALLEL_GEMM = 96 * 96 * 96;
+
+		// Square tile of the blocked transpose
+		constexpr size_t TRANSPOSE_TILE = 32;
+
+		// Matrices below this many elements are transposed on the calling thread under policy::par
+		constexpr size_t PARALLEL_TRANSPOSE = 256 * 256;
+
+		template <typename T>
+		void gemmSmall(const size_t m, const size_t n, const size_t k, const T alpha, const T *a,
+		    const size_t lda, const T *b, const size_t ldb, const T beta, T *c, const size_t ldc) noexcept {
+			for (size_t i = 0; i < m; ++i) {
+				T *row = c + i * ldc;
+				for (size_t j = 0; j < n; ++j) row[j] = beta == T(0) ? T(0) : beta * row[j];
+				for (size_t p = 0; p < k; ++p) {
+					const T s = alpha * a[i * lda + p];
+					const T *brow = b + p * ldb;
+					for (size_t j = 0; j < n; ++j) row[j] += s * brow[j];
+				}
+			}
+		}
+
+		inline void runSeq(const size_t n, void (*task)(void *, size_t, size_t), void *ctx) {
+			task(ctx, 0, n);
+		}
+
+		inline void runPar(const size_t n, void (*task)(void *, size_t, size_t), void *ctx) {
+			parallel::parallel_for(0, n, 1, [&](const size_t b, const size_t e) { task(ctx, b, e); });
+		}
+	}  // namespace dmatrix_detail
+
+	// C (m x n, row stride ldc) = alpha * A (m x k) * B (k x n) + beta * C, row-major pointers.
+	// beta == 0 does not read C. Large products use the packed cache-blocked kernel of the
+	// active SIMD backend (see core/detail/gemm_kernels.inl); policy::par splits them across
+	// the default thread pool.
+	template <typename T>
+	void gemm(const size_t m, const size_t n, const size_t k, const T alpha, const T *a, const size_t lda,
+	    const T *b, const size_t ldb, const T beta, T *c, const size_t ldc,
+	    const parallel::policy pol = parallel::policy::seq) {
+		if (m == 0 || n == 0) return;
+		const size_t work = m * n * k;
+		if (work <= dmatrix_detail::SMALL_GEMM) {
+			dmatrix_detail::gemmSmall(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+			return;
+		}
+
+		const auto kernel = simd::select(VTX_SIMD_FN(gemm<T>));
+		if (pol == parallel::policy::seq || work < dmatrix_detail::PARALLEL_GEMM)
+			kernel(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, 1, dmatrix_detail::runSeq);
+		else
+			kernel(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, parallel::defaultPool().size() + 1,
+			    dmatrix_detail::runPar);
+	}
+
+	// Vector of runtime size, heap storage aligned to CACHE_LINE
+	template <typename T>
+	class dvector {
+	public:
+		using value_type = T;
+		using storage_type = std::vector<T, aligned_allocator<T>>;
+
+		// Class default constructor (empty vector)
+		dvector() = default;
+
+		// n copies of value
+		explicit dvector(const size_t n, const T value = T(0)) : elements(n, value) {}
+
+		// Initializer list constructor
+		dvector(std::initializer_list<T> list) : elements(list) {}
+
+		// Copy of a fixed-size vector
+		template <size_t N>
+		explicit dvector(const vector<T, N> &v) : elements(N) {
+			for (size_t i = 0; i < N; ++i) elements[i] = v[i];
+		}
+
+		size_t size() const noexcept { return elements.size(); }
+		bool empty() const noexcept { return elements.empty(); }
+		void resize(const size_t n, const T value = T(0)) { elements.resize(n, value); }
+
+		// Element access
+		T &operator[](const size_t i) noexcept { return elements[i]; }
+		const T &operator[](const size_t i) const noexcept { return elements[i]; }
+
+		T *data() noexcept { return elements.data(); }
+		const T *data() const noexcept { return elements.data(); }
+		T *begin() noexcept { return elements.data(); }
+		const T *begin() const noexcept { return elements.data(); }
+		T *end() noexcept { return elements.data() + elements.size(); }
+		const T *end() const noexcept { return elements.data() + elements.size(); }
+
+		// Fixed-size segment starting at element i
+		template <size_t a>
+		vector<T, a> block(const size_t i) const noexcept {
+			assert(i + a <= size());
+			vector<T, a> v;
+			for (size_t j = 0; j < a; ++j) v[j] = elements[i + j];
+			return v;
+		}
+
+		// Overwrite the segment starting at element i
+		template <size_t a>
+		dvector &setBlock(const size_t i, const vector<T, a> &v) noexcept {
+			assert(i + a <= size());
+			for (size_t j = 0; j < a; ++j) elements[i + j] = v[j];
+			return *this;
+		}
+
+		bool operator==(const dvector &v) const noexcept { return elements == v.elements; }
+		bool operator!=(const dvector &v) const noexcept { return !(*this == v); }
+
+		dvector &operator+=(const dvector &v) noexcept {
+			assert(v.size() == size());
+			for (size_t i = 0; i < size(); ++i) elements[i] += v.elements[i];
+			return *this;
+		}
+
+		dvector &operator-=(const dvector &v) noexcept {
+			assert(v.size() == size());
+			for (size_t i = 0; i < size(); ++i) elements[i] -= v.elements[i];
+			return *this;
+		}
+
+		dvector &operator*=(const T s) noexcept {
+			for (auto &e : elements) e *= s;
+			return *this;
+		}
+
+		dvector &operator/=(const T s) noexcept {
+			for (auto &e : elements) e /= s;
+			return *this;
+		}
+
+		dvector operator-() const {
+			dvector r(*this);
+			for (auto &e : r.elements) e = -e;
+			return r;
+		}
+
+		dvector operator+(const dvector &v) const { return dvector(*this) += v; }
+		dvector operator-(const dvector &v) const { return dvector(*this) -= v; }
+		dvector operator*(const T s) const { return dvector(*this) *= s; }
+		dvector operator/(const T s) const { return dvector(*this) /= s; }
+
+		// Dot product
+		T dot(const dvector &v) const noexcept {
+			assert(v.size() == size());
+			T sum = T(0);
+			for (size_t i = 0; i < size(); ++i) sum += elements[i] * v.elements[i];
+			return sum;
+		}
+
+		T squaredLength() const noexcept { return dot(*this); }
+		T length() const noexcept { return vtx::math::sqrt(squaredLength()); }
+
+	private:
+		storage_type elements;
+	};
+
+	// Row-major matrix of runtime size, heap storage aligned to CACHE_LINE.
+	// Products go through vtx::gemm.
+	template <typename T>
+	class dmatrix {
+	public:
+		using value_type = T;
+		using storage_type = std::vector<T, aligned_allocator<T>>;
+
+		// Class default constructor (0 x 0 matrix)
+		dmatrix() = default;
+
+		// rows x cols matrix filled with value
+		dmatrix(const size_t rows, const size_t cols, const T value = T(0))
+		    : elements(rows * cols, value), m(rows), n(cols) {}
+
+		// Rows initializer list constructor (all rows of the same length)
+		dmatrix(std::initializer_list<std::initializer_list<T>> list)
+		    : m(list.size()), n(list.size() ? list.begin()->size() : 0) {
+			elements.reserve(m * n);
+			for (const auto &row : list) {
+				assert(row.size() == n);
+				elements.insert(elements.end(), row.begin(), row.end());
+			}
+		}
+
+		// Copy of a fixed-size matrix
+		template <size_t M, size_t N>
+		explicit dmatrix(const matrix<T, M, N> &a) : elements(M * N), m(M), n(N) {
+			setBlock(0, 0, a);
+		}
+
+		static dmatrix identity(const size_t size) {
+			dmatrix r(size, size);
+			for (size_t i = 0; i < size; ++i) r(i, i) = T(1);
+			return r;
+		}
+
+		size_t rows() const noexcept { return m; }
+		size_t cols() const noexcept { return n; }
+
+		// Reshape (contents are not kept)
+		void resize(const size_t rows, const size_t cols, const T value = T(0)) {
+			elements.assign(rows * cols, value);
+			m = rows;
+			n = cols;
+		}
+
+		// Element access
+		T &operator()(const size_t row, const size_t col) noexcept { return elements[row * n + col]; }
+		const T &operator()(const size_t row, const size_t col) const noexcept {
+			return elements[row * n + col];
+		}
+
+		// Row pointer
+		T *operator[](const size_t row) noexcept { return elements.data() + row * n; }
+		const T *operator[](const size_t row) const noexcept { return elements.data() + row * n; }
+
+		T *data() noexcept { return elements.data(); }
+		const T *data() const noexcept { return elements.data(); }
+
+		// Fixed-size a x b block with top left corner (row, col)
+		template <size_t a, size_t b>
+		matrix<T, a, b> block(const size_t row, const size_t col) const noexcept {
+			assert(row + a <= m && col + b <= n);
+			matrix<T, a, b> r;
+			for (size_t i = 0; i < a; ++i)
+				for (size_t j = 0; j < b; ++j) r(i, j) = elements[(row + i) * n + col + j];
+			return r;
+		}
+
+		// Overwrite the block with top left corner (row, col)
+		template <size_t a, size_t b>
+		dmatrix &setBlock(const size_t row, const size_t col, const matrix<T, a, b> &v) noexcept {
+			assert(row + a <= m && col + b <= n);
+			for (size_t i = 0; i < a; ++i)
+				for (size_t j = 0; j < b; ++j) elements[(row + i) * n + col + j] = v(i, j);
+			return *this;
+		}
+
+		bool operator==(const dmatrix &a) const noexcept {
+			return m == a.m && n == a.n && elements == a.elements;
+		}
+		bool operator!=(const dmatrix &a) const noexcept { return !(*this == a); }
+
+		dmatrix &operator+=(const dmatrix &a) noexcept {
+			assert(a.m == m && a.n == n);
+			for (size_t i = 0; i < elements.size(); ++i) elements[i] += a.elements[i];
+			return *this;
+		}
+
+		dmatrix &operator-=(const dmatrix &a) noexcept {
+			assert(a.m == m && a.n == n);
+			for (size_t i = 0; i < elements.size(); ++i) elements[i] -= a.elements[i];
+			return *this;
+		}
+
+		dmatrix &operator*=(const T s) noexcept {
+			for (auto &e : elements) e *= s;
+			return *this;
+		}
+
+		dmatrix &operator/=(const T s) noexcept {
+			for (auto &e : elements) e /= s;
+			return *this;
+		}
+
+		dmatrix operator-() const {
+			dmatrix r(*this);
+			for (auto &e : r.elements) e = -e;
+			return r;
+		}
+
+		dmatrix operator+(const dmatrix &a) const { return dmatrix(*this) += a; }
+		dmatrix operator-(const dmatrix &a) const { return dmatrix(*this) -= a; }
+		dmatrix operator*(const T s) const { return dmatrix(*this) *= s; }
+		dmatrix operator/(const T s) const { return dmatrix(*this) /= s; }
+
+		// Matrix product
+		dmatrix operator*(const dmatrix &a) const {
+			assert(n == a.m);
+			dmatrix r(m, a.n);
+			gemm(m, a.n, n, T(1), data(), n, a.data(), a.n, T(0), r.data(), a.n);
+			return r;
+		}
+
+		dmatrix &operator*=(const dmatrix &a) { return *this = *this * a; }
+
+		// Matrix by column vector product
+		dvector<T> operator*(const dvector<T> &v) const {
+			assert(v.size() == n);
+			dvector<T> r(m);
+			for (size_t i = 0; i < m; ++i) {
+				const T *row = (*this)[i];
+				T sum = T(0);
+				for (size_t j = 0; j < n; ++j) sum += row[j] * v[j];
+				r[i] = sum;
+			}
+			return r;
+		}
+
+		// Transposed copy (tiled: both matrices are walked in cache-sized blocks; policy::par
+		// splits the tile rows across the default thread pool)
+		dmatrix transpose(const parallel::policy pol = parallel::policy::seq) const {
+			constexpr size_t TILE = dmatrix_detail::TRANSPOSE_TILE;
+			dmatrix r(n, m);
+			auto tileRows = [&](const size_t tb, const size_t te) {
+				for (size_t i0 = tb * TILE; i0 < vtx::math::min(m, te * TILE); i0 += TILE)
+					for (size_t j0 = 0; j0 < n; j0 += TILE) {
+						const size_t i1 = vtx::math::min(m, i0 + TILE), j1 = vtx::math::min(n, j0 + TILE);
+						for (size_t i = i0; i < i1; ++i)
+							for (size_t j = j0; j < j1; ++j) r.elements[j * m + i] = elements[i * n + j];
+					}
+			};
+
+			const size_t tiles = (m + TILE - 1) / TILE;
+			if (pol == parallel::policy::seq || m * n < dmatrix_detail::PARALLEL_TRANSPOSE)
+				tileRows(0, tiles);
+			else
+				parallel::parallel_for(0, tiles, 1, tileRows);
+			return r;
+		}
+
+		T trace() const noexcept {
+			T sum = T(0);
+			for (size_t i = 0; i < vtx::math::min(m, n); ++i) sum += elements[i * n + i];
+			return sum;
+		}
+
+		T frobeniusNorm() const noexcept {
+			T sum = T(0);
+			for (const auto e : elements) sum += e * e;
+			return vtx::math::sqrt(sum);
+		}
+
+	private:
+		storage_type elements;
+		size_t m = 0, n = 0;
+	};
+
+	// c = alpha * a * b + beta * c (c keeps its storage when the shape matches)
+	template <typename T>
+	void gemm(const T alpha, const dmatrix<T> &a, const dmatrix<T> &b, const T beta, dmatrix<T> &c,
+	    const parallel::policy pol = parallel::policy::seq) {
+		assert(a.cols() == b.rows());
+		assert(&c != &a && &c != &b);
+		if (c.rows() != a.rows() || c.cols() != b.cols()) {
+			assert(beta == T(0));
+			c.resize(a.rows(), b.cols());
+		}
+		gemm(a.rows(), b.cols(), a.cols(), alpha, a.data(), a.cols(), b.data(), b.cols(), beta, c.data(),
+		    c.cols(), pol);
+	}
+}  // namespace vtx
+
+#endif  // VECTRIX_DMATRIX_H
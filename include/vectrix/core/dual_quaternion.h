@@ -0,0 +1,124 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_DUAL_QUATERNION_H
+#define VECTRIX_DUAL_QUATERNION_H
+
+#include "affine3.h"
+#include "matrix4x4.h"
+#include "quaternion.h"
+#include "vector3.h"
+
+namespace vtx {
+	// Dual quaternion real + eps * dual. A unit one is a rigid transform of 3D space: rotation by
+	// the unit quaternion 'real', then translation t, with dual = (t, 0) * real / 2. 8 elements
+	// instead of 16, and weighted sums of unit dual quaternions blend rigid transforms without
+	// the volume loss of blended matrices (see vtx::skinning).
+	// Products are quaternion products: a * b applies b first (as quaternion<T>), so
+	// (a * b).toMatrix() == b.toMatrix() * a.toMatrix() in the row-vector convention of matrix<T, 4, 4>.
+	template <typename T>
+	class dual_quaternion {
+	public:
+		quaternion<T> real, dual;
+
+		// Class default constructor
+		constexpr dual_quaternion() = default;
+
+		// Real and dual parts
+		constexpr dual_quaternion(const quaternion<T> &r, const quaternion<T> &d) noexcept
+		    : real(r), dual(d) {}
+
+		// Rotation by unit quaternion, then translation
+		constexpr explicit dual_quaternion(
+		    const quaternion<T> &rotation, const vector<T, 3> &translation = vector<T, 3>(T(0))) noexcept
+		    : real(rotation),
+		      dual(quaternion<T>(translation[0], translation[1], translation[2], T(0)) * rotation * T(0.5)) {}
+
+		// Rigid matrix<T, 4, 4>: rotation in the upper 3x3, translation in row 3
+		constexpr explicit dual_quaternion(const matrix<T, 4, 4> &m) noexcept
+		    : dual_quaternion(affine3<T>(m).toQuaternion(), vector<T, 3>(m(3, 0), m(3, 1), m(3, 2))) {}
+
+		// Identity transform
+		static constexpr dual_quaternion identity() noexcept {
+			return dual_quaternion(quaternion<T>(T(0), T(0), T(0), T(1)), quaternion<T>(T(0)));
+		}
+
+		// Translation transform
+		static constexpr dual_quaternion translate(const vector<T, 3> &v) noexcept {
+			return dual_quaternion(quaternion<T>(T(0), T(0), T(0), T(1)), v);
+		}
+
+		// Pointer to data (8 elements: real, then dual)
+		constexpr T *data() noexcept { return real.data(); }
+		constexpr const T *data() const noexcept { return real.data(); }
+
+		// Dual quaternions equality operator
+		constexpr bool operator==(const dual_quaternion &q) const noexcept {
+			return real == q.real && dual == q.dual;
+		}
+
+		// Dual quaternions inequality operator
+		constexpr bool operator!=(const dual_quaternion &q) const noexcept { return !(*this == q); }
+
+		// Product: 'q' first, then 'this'
+		constexpr dual_quaternion operator*(const dual_quaternion &q) const noexcept {
+			return dual_quaternion(real * q.real, real * q.dual + dual * q.real);
+		}
+
+		constexpr dual_quaternion &operator*=(const dual_quaternion &q) noexcept { return *this = *this * q; }
+
+		// Weighted sums (blending)
+		constexpr dual_quaternion operator+(const dual_quaternion &q) const noexcept {
+			return dual_quaternion(real + q.real, dual + q.dual);
+		}
+
+		constexpr dual_quaternion operator*(const T n) const noexcept {
+			return dual_quaternion(real * n, dual * n);
+		}
+
+		// Inverse of a unit dual quaternion (conjugates of both parts)
+		constexpr dual_quaternion inverse() const noexcept {
+			return dual_quaternion(quaternion<T>(-real.X, -real.Y, -real.Z, real.W),
+			    quaternion<T>(-dual.X, -dual.Y, -dual.Z, dual.W));
+		}
+
+		// Unit dual quaternion: real scaled to unit length, dual scaled alike and made orthogonal
+		// to real. Blended dual quaternions need it before transformPoint
+		dual_quaternion normalized() const noexcept {
+			const T inv = T(1) / real.length();
+			const quaternion<T> r = real * inv, d = dual * inv;
+			const T rd = r.X * d.X + r.Y * d.Y + r.Z * d.Z + r.W * d.W;
+			return dual_quaternion(r, d - r * rd);
+		}
+
+		dual_quaternion &normalize() noexcept { return *this = normalized(); }
+
+		// Translation of a unit dual quaternion: vector part of 2 * dual * conjugate(real)
+		constexpr vector<T, 3> translation() const noexcept {
+			const quaternion<T> &r = real, &d = dual;
+			return vector<T, 3>(2 * (r.W * d.X - d.W * r.X + r.Y * d.Z - r.Z * d.Y),
+			    2 * (r.W * d.Y - d.W * r.Y + r.Z * d.X - r.X * d.Z),
+			    2 * (r.W * d.Z - d.W * r.Z + r.X * d.Y - r.Y * d.X));
+		}
+
+		// Equivalent matrix<T, 4, 4>
+		constexpr matrix<T, 4, 4> toMatrix() const noexcept {
+			matrix<T, 4, 4> result = real.rotateMatr();
+			const vector<T, 3> t = translation();
+			for (size_t c = 0; c < 3; ++c) result(3, c) = t[c];
+			return result;
+		}
+
+		// Transforms by a unit dual quaternion (as matrix<T, 4, 4>)
+		constexpr vector<T, 3> transformPoint(const vector<T, 3> &v) const noexcept {
+			return real.rotateVector(v) + translation();
+		}
+
+		constexpr vector<T, 3> transformVector(const vector<T, 3> &v) const noexcept {
+			return real.rotateVector(v);
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_DUAL_QUATERNION_H
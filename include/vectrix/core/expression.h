@@ -0,0 +1,267 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_EXPRESSION_H
+#define VECTRIX_EXPRESSION_H
+
+#include <type_traits>
+
+#include "vectrix/math/common.h"
+
+// Element-wise expression templates (opt-in with VTX_EXPR_TEMPLATES).
+// With the macro defined, +, -, unary -, element-wise * and /, and scaling of the generic
+// vector<T, N> and matrix<T, M, N> build lightweight expression objects instead of
+// temporaries. The whole chain is evaluated in one loop when it is assigned to (or used to
+// construct) a vector or matrix. The 2/3/4 specializations stay eager: their temporaries
+// live in registers anyway.
+//
+// Expressions keep references to their vector/matrix operands, so do not store them
+// ('auto e = a + b;') past the lifetime of the operands.
+// The macro changes class layouts of operators, define it for every translation unit.
+
+namespace vtx {
+	template <typename T, size_t N>
+	class vector;
+
+	namespace expr {
+		// Base of every expression node. Derived provides:
+		//   result_type - vector or matrix produced by evaluation
+		//   value_type  - element type
+		//   size        - flat element count
+		//   operator[](i) - element i of the flat (row-major) result
+		template <typename E>
+		struct expression {
+			constexpr const E &self() const noexcept { return static_cast<const E &>(*this); }
+
+			// Evaluate into a new container (template: E is incomplete here)
+			template <typename D = E>
+			constexpr typename D::result_type eval() const noexcept {
+				return typename D::result_type(self());
+			}
+		};
+
+		template <typename C>
+		struct is_expression : std::is_base_of<expression<C>, C> {};
+
+		// Containers taking part in expressions: generic vector/matrix (declare expression_leaf
+		// and flat_size), not the small specializations
+		template <typename C, typename = void>
+		struct is_leaf : std::false_type {};
+
+		template <typename C>
+		struct is_leaf<C, typename std::enable_if<C::expression_leaf>::type> : std::true_type {};
+
+		// Container operand (stored by reference)
+		template <typename C>
+		class leaf : public expression<leaf<C>> {
+		public:
+			using result_type = C;
+			using value_type = typename std::remove_cv<
+			    typename std::remove_reference<decltype(*std::declval<const C &>().data())>::type>::type;
+			static constexpr size_t size = C::flat_size;
+
+			constexpr explicit leaf(const C &c) noexcept : container(c) {}
+			constexpr value_type operator[](const size_t i) const noexcept { return container.data()[i]; }
+
+		private:
+			const C &container;
+		};
+
+		// Wrap operand: containers become leaves, expressions are kept by value
+		template <typename X, bool = is_expression<X>::value>
+		struct node {
+			using type = X;
+			static constexpr const X &wrap(const X &x) noexcept { return x; }
+		};
+
+		template <typename X>
+		struct node<X, false> {
+			using type = leaf<X>;
+			static constexpr leaf<X> wrap(const X &x) noexcept { return leaf<X>(x); }
+		};
+
+		template <typename X>
+		using node_t = typename node<X>::type;
+
+		// Element operations
+		struct add {
+			template <typename T>
+			static constexpr T apply(const T a, const T b) noexcept { return a + b; }
+		};
+		struct sub {
+			template <typename T>
+			static constexpr T apply(const T a, const T b) noexcept { return a - b; }
+		};
+		struct mul {
+			template <typename T>
+			static constexpr T apply(const T a, const T b) noexcept { return a * b; }
+		};
+		struct div {
+			template <typename T>
+			static constexpr T apply(const T a, const T b) noexcept { return a / b; }
+		};
+
+		// Element-wise binary operation of two expressions of the same shape
+		template <typename L, typename R, typename Op>
+		class binary : public expression<binary<L, R, Op>> {
+		public:
+			using result_type = typename L::result_type;
+			using value_type = typename L::value_type;
+			static constexpr size_t size = L::size;
+
+			constexpr binary(const L &l, const R &r) noexcept : lhs(l), rhs(r) {}
+			constexpr value_type operator[](const size_t i) const noexcept {
+				return Op::apply(lhs[i], rhs[i]);
+			}
+
+		private:
+			L lhs;
+			R rhs;
+		};
+
+		// Operation with a scalar right operand
+		template <typename L, typename Op>
+		class scalar_binary : public expression<scalar_binary<L, Op>> {
+		public:
+			using result_type = typename L::result_type;
+			using value_type = typename L::value_type;
+			static constexpr size_t size = L::size;
+
+			constexpr scalar_binary(const L &l, const value_type s) noexcept : lhs(l), scalar(s) {}
+			constexpr value_type operator[](const size_t i) const noexcept {
+				return Op::apply(lhs[i], scalar);
+			}
+
+		private:
+			L lhs;
+			value_type scalar;
+		};
+
+		// Negation
+		template <typename L>
+		class negate : public expression<negate<L>> {
+		public:
+			using result_type = typename L::result_type;
+			using value_type = typename L::value_type;
+			static constexpr size_t size = L::size;
+
+			constexpr explicit negate(const L &l) noexcept : operand(l) {}
+			constexpr value_type operator[](const size_t i) const noexcept { return -operand[i]; }
+
+		private:
+			L operand;
+		};
+
+		// Operand of an expression operator: expression or generic container
+		template <typename X>
+		struct is_operand
+		    : std::integral_constant<bool, is_expression<X>::value || is_leaf<X>::value> {};
+
+		// Traits below are false (or empty) for non-operands, so the operators drop out of
+		// overload resolution for unrelated types
+		template <typename X, bool = is_operand<X>::value>
+		struct traits {};
+
+		template <typename X>
+		struct traits<X, true> {
+			using result_type = typename node_t<X>::result_type;
+			using value_type = typename node_t<X>::value_type;
+		};
+
+		// Both operands valid and of the same shape
+		template <typename L, typename R, bool = is_operand<L>::value && is_operand<R>::value>
+		struct same_shape : std::false_type {};
+
+		template <typename L, typename R>
+		struct same_shape<L, R, true>
+		    : std::is_same<typename traits<L>::result_type, typename traits<R>::result_type> {};
+
+		// Element-wise product/quotient only exist for vectors (matrix * is a matrix product)
+		template <typename C>
+		struct is_vector : std::false_type {};
+
+		template <typename T, size_t N>
+		struct is_vector<vector<T, N>> : std::true_type {};
+
+		template <typename L, typename R, bool = same_shape<L, R>::value>
+		struct same_vector_shape : std::false_type {};
+
+		template <typename L, typename R>
+		struct same_vector_shape<L, R, true> : is_vector<typename traits<L>::result_type> {};
+
+		// Evaluate expression e into flat storage dst
+		template <typename E, typename T>
+		constexpr void assign(T *dst, const expression<E> &e) noexcept {
+			for (size_t i = 0; i < E::size; ++i) dst[i] = e.self()[i];
+		}
+
+		// Apply dst[i] = Op(dst[i], e[i])
+		template <typename Op, typename E, typename T>
+		constexpr void update(T *dst, const expression<E> &e) noexcept {
+			for (size_t i = 0; i < E::size; ++i) dst[i] = Op::apply(dst[i], e.self()[i]);
+		}
+	}  // namespace expr
+
+#ifdef VTX_EXPR_TEMPLATES
+	template <typename L, typename R,
+	    typename = typename std::enable_if<expr::same_shape<L, R>::value>::type>
+	constexpr expr::binary<expr::node_t<L>, expr::node_t<R>, expr::add> operator+(
+	    const L &l, const R &r) noexcept {
+		return {expr::node<L>::wrap(l), expr::node<R>::wrap(r)};
+	}
+
+	template <typename L, typename R,
+	    typename = typename std::enable_if<expr::same_shape<L, R>::value>::type>
+	constexpr expr::binary<expr::node_t<L>, expr::node_t<R>, expr::sub> operator-(
+	    const L &l, const R &r) noexcept {
+		return {expr::node<L>::wrap(l), expr::node<R>::wrap(r)};
+	}
+
+	template <typename L, typename R,
+	    typename = typename std::enable_if<expr::same_vector_shape<L, R>::value>::type>
+	constexpr expr::binary<expr::node_t<L>, expr::node_t<R>, expr::mul> operator*(
+	    const L &l, const R &r) noexcept {
+		return {expr::node<L>::wrap(l), expr::node<R>::wrap(r)};
+	}
+
+	template <typename L, typename R,
+	    typename = typename std::enable_if<expr::same_vector_shape<L, R>::value>::type>
+	constexpr expr::binary<expr::node_t<L>, expr::node_t<R>, expr::div> operator/(
+	    const L &l, const R &r) noexcept {
+		return {expr::node<L>::wrap(l), expr::node<R>::wrap(r)};
+	}
+
+	template <typename L>
+	constexpr expr::scalar_binary<expr::node_t<L>, expr::mul> operator*(
+	    const L &l, const typename expr::traits<L>::value_type s) noexcept {
+		return {expr::node<L>::wrap(l), s};
+	}
+
+	template <typename L>
+	constexpr expr::scalar_binary<expr::node_t<L>, expr::div> operator/(
+	    const L &l, const typename expr::traits<L>::value_type s) noexcept {
+		return {expr::node<L>::wrap(l), s};
+	}
+
+	template <typename L, typename = typename std::enable_if<expr::is_operand<L>::value>::type>
+	constexpr expr::negate<expr::node_t<L>> operator-(const L &l) noexcept {
+		return expr::negate<expr::node_t<L>>(expr::node<L>::wrap(l));
+	}
+
+	// Compare evaluated expression with container
+	template <typename E>
+	constexpr bool operator==(const expr::expression<E> &e, const typename E::result_type &c) noexcept {
+		for (size_t i = 0; i < E::size; ++i)
+			if (e.self()[i] != c.data()[i]) return false;
+		return true;
+	}
+
+	template <typename E>
+	constexpr bool operator!=(const expr::expression<E> &e, const typename E::result_type &c) noexcept {
+		return !(e == c);
+	}
+#endif  // VTX_EXPR_TEMPLATES
+}  // namespace vtx
+
+#endif //VECTRIX_EXPRESSION_H
@@ -0,0 +1,182 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_LU_H
+#define VECTRIX_LU_H
+
+#include "base_matrix.h"
+
+namespace vtx {
+	// LU decomposition with partial pivoting: P * A = L * U.
+	// O(N^3) once, then O(N^2) per right-hand side; keep the object to solve many systems
+	// with the same matrix. Everything is constexpr (no std::swap/std::abs).
+	// Factors are stored packed: U on and above the diagonal, L below it (unit diagonal).
+	template <typename T, size_t N>
+	class lu {
+	public:
+		// Factorize square matrix a
+		constexpr explicit lu(const matrix<T, N, N>& a) noexcept
+		    : factors(a), perm{}, sign(1), rankValue(N) {
+			for (size_t i = 0; i < N; ++i) perm[i] = i;
+
+			for (size_t k = 0; k < N; ++k) {
+				// Largest remaining element of column k is the pivot
+				size_t p = k;
+				T best = absolute(factors[k][k]);
+				for (size_t i = k + 1; i < N; ++i) {
+					const T v = absolute(factors[i][k]);
+					if (v > best) {
+						best = v;
+						p = i;
+					}
+				}
+
+				if (best == T(0)) {
+					--rankValue;
+					continue;
+				}
+
+				if (p != k) {
+					for (size_t j = 0; j < N; ++j) {
+						const T t = factors[k][j];
+						factors[k][j] = factors[p][j];
+						factors[p][j] = t;
+					}
+					const size_t t = perm[k];
+					perm[k] = perm[p];
+					perm[p] = t;
+					sign = -sign;
+				}
+
+				const T inv = T(1) / factors[k][k];
+				for (size_t i = k + 1; i < N; ++i) {
+					const T l = factors[i][k] * inv;
+					factors[i][k] = l;
+					if (l == T(0)) continue;
+					for (size_t j = k + 1; j < N; ++j) factors[i][j] -= l * factors[k][j];
+				}
+			}
+		}
+
+		// True if a zero pivot was met (solve/inverse results are meaningless then)
+		constexpr bool singular() const noexcept { return rankValue < N; }
+
+		// Count of nonzero pivots (exact zero test, an estimate for ill-conditioned input)
+		constexpr size_t rank() const noexcept { return rankValue; }
+
+		// Determinant of the factorized matrix
+		constexpr T determinant() const noexcept {
+			T det = T(sign);
+			for (size_t i = 0; i < N; ++i) det *= factors[i][i];
+			return det;
+		}
+
+		// Solve A * x = b
+		constexpr vector<T, N> solve(const vector<T, N>& b) const noexcept {
+			T x[N] = {};
+			for (size_t i = 0; i < N; ++i) x[i] = b[perm[i]];
+			substitute(x);
+
+			vector<T, N> result(b);
+			for (size_t i = 0; i < N; ++i) result[i] = x[i];
+			return result;
+		}
+
+		// Solve A * X = B for K right-hand side columns at once
+		template <size_t K>
+		constexpr matrix<T, N, K> solve(const matrix<T, N, K>& b) const noexcept {
+			matrix<T, N, K> result;
+			for (size_t c = 0; c < K; ++c) {
+				T x[N] = {};
+				for (size_t i = 0; i < N; ++i) x[i] = b[perm[i]][c];
+				substitute(x);
+				for (size_t i = 0; i < N; ++i) result[i][c] = x[i];
+			}
+			return result;
+		}
+
+		// Inverse of the factorized matrix (identity if singular, as matrix::inverse)
+		constexpr matrix<T, N, N> inverse() const noexcept {
+			if (singular()) return matrix<T, N, N>::identity();
+
+			matrix<T, N, N> result;
+			for (size_t c = 0; c < N; ++c) {
+				T x[N] = {};
+				for (size_t i = 0; i < N; ++i) x[i] = perm[i] == c ? T(1) : T(0);
+				substitute(x);
+				for (size_t i = 0; i < N; ++i) result[i][c] = x[i];
+			}
+			return result;
+		}
+
+		// Packed L and U factors
+		constexpr const matrix<T, N, N>& packed() const noexcept { return factors; }
+
+		// Unit lower triangular factor
+		constexpr matrix<T, N, N> lower() const noexcept {
+			matrix<T, N, N> l;
+			for (size_t i = 0; i < N; ++i)
+				for (size_t j = 0; j < N; ++j)
+					l[i][j] = j < i ? factors[i][j] : (i == j ? T(1) : T(0));
+			return l;
+		}
+
+		// Upper triangular factor
+		constexpr matrix<T, N, N> upper() const noexcept {
+			matrix<T, N, N> u;
+			for (size_t i = 0; i < N; ++i)
+				for (size_t j = 0; j < N; ++j) u[i][j] = j >= i ? factors[i][j] : T(0);
+			return u;
+		}
+
+		// Row of A moved to row i of P * A
+		constexpr size_t pivot(const size_t i) const noexcept { return perm[i]; }
+
+		// Fraction-free (Bareiss) determinant: O(N^3) and exact for integral T
+		static constexpr T exactDeterminant(matrix<T, N, N> a) noexcept {
+			T det = T(1), prev = T(1);
+			for (size_t k = 0; k < N; ++k) {
+				if (a[k][k] == T(0)) {
+					size_t p = k + 1;
+					while (p < N && a[p][k] == T(0)) ++p;
+					if (p == N) return T(0);
+					for (size_t j = k; j < N; ++j) {
+						const T t = a[k][j];
+						a[k][j] = a[p][j];
+						a[p][j] = t;
+					}
+					det = -det;
+				}
+
+				for (size_t i = k + 1; i < N; ++i)
+					for (size_t j = k + 1; j < N; ++j)
+						a[i][j] = (a[i][j] * a[k][k] - a[i][k] * a[k][j]) / prev;
+				prev = a[k][k];
+			}
+			return det * a[N - 1][N - 1];
+		}
+
+	private:
+		matrix<T, N, N> factors;
+		size_t perm[N];
+		int sign;
+		size_t rankValue;
+
+		static constexpr T absolute(const T v) noexcept { return v < T(0) ? -v : v; }
+
+		// Forward (L, unit diagonal) then backward (U) substitution in place.
+		// Zero pivots leave their unknown at zero
+		constexpr void substitute(T* x) const noexcept {
+			for (size_t i = 1; i < N; ++i)
+				for (size_t j = 0; j < i; ++j) x[i] -= factors[i][j] * x[j];
+
+			for (size_t i = N; i-- > 0;) {
+				for (size_t j = i + 1; j < N; ++j) x[i] -= factors[i][j] * x[j];
+				x[i] = factors[i][i] != T(0) ? x[i] / factors[i][i] : T(0);
+			}
+		}
+	};
+}  // namespace vtx
+
+#endif  // VECTRIX_LU_H
@@ -7,10 +7,23 @@
 
 #include "base_matrix.h"
 #include "vector3.h"
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/simd/dispatch.h"
+
+#define VTX_SIMD_KERNELS "vectrix/core/detail/transform_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
 
 // vtx namespace
 namespace vtx
 {
+    // What a 4x4 matrix is known to be (row vectors, translation in the last row).
+    // Lets inverse() and the normal transforms skip the general cofactor expansion
+    enum class transform_kind {
+        general,  // any matrix, projections included
+        affine,   // last column is (0, 0, 0, 1)
+        rigid     // affine with orthonormal 3x3 part (rotate*, translate, view)
+    };
+
     // Matrix 4x4 class specialization
     template<typename T>
     class matrix<T, 4, 4> {
@@ -25,11 +38,59 @@ namespace vtx
                         std::is_convertible<First, T>::value &&
                         all_convertible<Rest...>::value> {};
 
-        constexpr T det3x3(
-                const T E00, const T E01, const T E02,
-                const T E10, const T E11, const T E12,
-                const T E20, const T E21, const T E22) const noexcept {
-            return E00 * (E11 * E22 - E12 * E21) - E01 * (E10 * E22 - E12 * E20) + E02 * (E10 * E21 - E11 * E20);
+        // 2x2 sub-determinants of rows 0, 1 (s) and rows 2, 3 (c), shared by determinant()
+        // and all cofactors of inverse()
+        constexpr void subDeterminants( T (&s)[6], T (&c)[6] ) const noexcept {
+            const T (&e)[4][4] = elements;
+            s[0] = e[0][0] * e[1][1] - e[1][0] * e[0][1];
+            s[1] = e[0][0] * e[1][2] - e[1][0] * e[0][2];
+            s[2] = e[0][0] * e[1][3] - e[1][0] * e[0][3];
+            s[3] = e[0][1] * e[1][2] - e[1][1] * e[0][2];
+            s[4] = e[0][1] * e[1][3] - e[1][1] * e[0][3];
+            s[5] = e[0][2] * e[1][3] - e[1][2] * e[0][3];
+
+            c[0] = e[2][0] * e[3][1] - e[3][0] * e[2][1];
+            c[1] = e[2][0] * e[3][2] - e[3][0] * e[2][2];
+            c[2] = e[2][0] * e[3][3] - e[3][0] * e[2][3];
+            c[3] = e[2][1] * e[3][2] - e[3][1] * e[2][2];
+            c[4] = e[2][1] * e[3][3] - e[3][1] * e[2][3];
+            c[5] = e[2][2] * e[3][3] - e[3][2] * e[2][3];
+        }
+
+        // SIMD backend paths (runtime only, 'done' is false if scalar code must be used)
+        matrix simdTranspose( bool &done ) const noexcept {
+            matrix result;
+            done = simd::mat4<T>::transpose(data(), result.data());
+            return result;
+        }
+
+        matrix simdInverse( bool &done ) const noexcept {
+            matrix result;
+            done = simd::mat4<T>::inverse(data(), result.data());
+            return result;
+        }
+
+        // Batch transform kinds (see transform_kernels.inl)
+        static constexpr int TRANSFORM_POINT = 0, TRANSFORM_VECTOR = 1, TRANSFORM_PROJECTIVE = 2;
+
+        // Elements per task when a batch is split across threads
+        static constexpr size_t TRANSFORM_GRAIN = 16384;
+
+        // Run batch transform of 'count' elements with matrix m (row-major)
+        template<int Kind>
+        static void transformBatch( const T *m, const T *in, const size_t inStride, T *out, const size_t outStride,
+                                    const size_t count, const parallel::policy pol ) {
+            const auto kernel = simd::select(VTX_SIMD_FN(transformStream<T, Kind>));
+            const BYTE *src = reinterpret_cast<const BYTE *>(in);
+            BYTE *dst = reinterpret_cast<BYTE *>(out);
+
+            if (pol == parallel::policy::seq) {
+                kernel(m, src, inStride, dst, outStride, count);
+                return;
+            }
+            parallel::parallel_for(0, count, TRANSFORM_GRAIN, [&]( const size_t b, const size_t e ) {
+                kernel(m, src + b * inStride, inStride, dst + b * outStride, outStride, e - b);
+            });
         }
 
     public:
@@ -288,6 +349,11 @@ namespace vtx
         constexpr matrix<T, 4, P> operator*( const matrix<T, 4, P>& m ) const noexcept {
             matrix<T, 4, P> result;
 
+            // SIMD backend (chosen at runtime) for square product
+            if (P == 4 && simd::mat4<T>::enabled && !VTX_IS_CONSTANT_EVALUATED() &&
+                    simd::mat4<T>::mul(data(), m.data(), result.data()))
+                return result;
+
             for (size_t i = 0; i < 4; ++i) {
                 for (size_t j = 0; j < P; ++j) {
                     T sum = T(0);
@@ -309,6 +375,13 @@ namespace vtx
 
         // Transpose matrix
         constexpr matrix transpose() const noexcept {
+            if (simd::mat4<T>::enabled && !VTX_IS_CONSTANT_EVALUATED()) {
+                bool done = false;
+                const matrix result = simdTranspose(done);
+                if (done)
+                    return result;
+            }
+
             return matrix{
                     elements[0][0], elements[1][0], elements[2][0], elements[3][0],
                     elements[0][1], elements[1][1], elements[2][1], elements[3][1],
@@ -329,86 +402,125 @@ namespace vtx
 
         // Determinant (only for square matrices)
         constexpr T determinant() const noexcept {
-            return
-                +elements[0][0] * det3x3(
-                    elements[1][1], elements[1][2], elements[1][3],
-                    elements[2][1], elements[2][2], elements[2][3],
-                    elements[3][1], elements[3][2], elements[3][3]) +
-                -elements[0][1] * det3x3(
-                    elements[1][0], elements[1][2], elements[1][3],
-                    elements[2][0], elements[2][2], elements[2][3],
-                    elements[3][0], elements[3][2], elements[3][3]) +
-                +elements[0][2] * det3x3(
-                    elements[1][0], elements[1][1], elements[1][3],
-                    elements[2][0], elements[2][1], elements[2][3],
-                    elements[3][0], elements[3][1], elements[3][3]) +
-                -elements[0][3] * det3x3(
-                    elements[1][0], elements[1][1], elements[1][2],
-                    elements[2][0], elements[2][1], elements[2][2],
-                    elements[3][0], elements[3][1], elements[3][2]);
+            T s[6] = {}, c[6] = {};
+            subDeterminants(s, c);
+            return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
         }
 
         // Inverse matrix (only for square matrices)
         constexpr matrix inverse() const noexcept {
-            T det = determinant();
+            if (simd::mat4<T>::enabled && !VTX_IS_CONSTANT_EVALUATED()) {
+                bool done = false;
+                const matrix result = simdInverse(done);
+                if (done)
+                    return result;
+            }
+
+            T s[6] = {}, c[6] = {};
+            subDeterminants(s, c);
+            const T det = s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
             if (det == T(0)) return identity();
 
+            // Adjugate (transposed cofactors) divided by determinant, cofactors from the shared
+            // 2x2 sub-determinants
+            const T (&e)[4][4] = elements;
             return matrix{
-                // 01, 02, 03, 04
-                    det3x3(elements[1][1], elements[1][2], elements[1][3],
-                            elements[2][1], elements[2][2], elements[2][3],
-                            elements[3][1], elements[3][2], elements[3][3]) / det,
-                    -det3x3(elements[1][0], elements[1][2], elements[1][3],
-                            elements[2][0], elements[2][2], elements[2][3],
-                            elements[3][0], elements[3][2], elements[3][3]) / det,
-                    det3x3(elements[1][0], elements[1][1], elements[1][3],
-                            elements[2][0], elements[2][1], elements[2][3],
-                            elements[3][0], elements[3][1], elements[3][3]) / det,
-                    -det3x3(elements[1][0], elements[1][1], elements[1][2],
-                            elements[2][0], elements[2][1], elements[2][2],
-                            elements[3][0], elements[3][1], elements[3][2]) / det,
+                // 00, 01, 02, 03
+                    (e[1][1] * c[5] - e[1][2] * c[4] + e[1][3] * c[3]) / det,
+                    (-e[0][1] * c[5] + e[0][2] * c[4] - e[0][3] * c[3]) / det,
+                    (e[3][1] * s[5] - e[3][2] * s[4] + e[3][3] * s[3]) / det,
+                    (-e[2][1] * s[5] + e[2][2] * s[4] - e[2][3] * s[3]) / det,
                 // 10, 11, 12, 13
-                    -det3x3(elements[0][1], elements[0][2], elements[0][3],
-                            elements[2][1], elements[2][2], elements[2][3],
-                            elements[3][1], elements[3][2], elements[3][3]) / det,
-                    det3x3(elements[0][0], elements[0][2], elements[0][3],
-                            elements[2][0], elements[2][2], elements[2][3],
-                            elements[3][0], elements[3][2], elements[3][3]) / det,
-                    -det3x3(elements[0][0], elements[0][1], elements[0][3],
-                            elements[2][0], elements[2][1], elements[2][3],
-                            elements[3][0], elements[3][1], elements[3][3]) / det,
-                    det3x3(elements[0][0], elements[0][1], elements[0][2],
-                            elements[2][0], elements[2][1], elements[2][2],
-                            elements[3][0], elements[3][1], elements[3][2]) / det,
+                    (-e[1][0] * c[5] + e[1][2] * c[2] - e[1][3] * c[1]) / det,
+                    (e[0][0] * c[5] - e[0][2] * c[2] + e[0][3] * c[1]) / det,
+                    (-e[3][0] * s[5] + e[3][2] * s[2] - e[3][3] * s[1]) / det,
+                    (e[2][0] * s[5] - e[2][2] * s[2] + e[2][3] * s[1]) / det,
                 // 20, 21, 22, 23
-                    det3x3(elements[0][1], elements[0][2], elements[0][3],
-                            elements[1][1], elements[1][2], elements[1][3],
-                            elements[3][1], elements[3][2], elements[3][3]) / det,
-                    -det3x3(elements[0][0], elements[0][2], elements[0][3],
-                            elements[1][0], elements[1][2], elements[1][3],
-                            elements[3][0], elements[3][2], elements[3][3]) / det,
-                    det3x3(elements[0][0], elements[0][1], elements[0][3],
-                            elements[1][0], elements[1][1], elements[1][3],
-                            elements[3][0], elements[3][1], elements[3][3]) / det,
-                    -det3x3(elements[0][0], elements[0][1], elements[0][2],
-                            elements[1][0], elements[1][1], elements[1][2],
-                            elements[3][0], elements[3][1], elements[3][2]) / det,
+                    (e[1][0] * c[4] - e[1][1] * c[2] + e[1][3] * c[0]) / det,
+                    (-e[0][0] * c[4] + e[0][1] * c[2] - e[0][3] * c[0]) / det,
+                    (e[3][0] * s[4] - e[3][1] * s[2] + e[3][3] * s[0]) / det,
+                    (-e[2][0] * s[4] + e[2][1] * s[2] - e[2][3] * s[0]) / det,
                 // 30, 31, 32, 33
-                    -det3x3(elements[0][1], elements[0][2], elements[0][3],
-                            elements[1][1], elements[1][2], elements[1][3],
-                            elements[2][1], elements[2][2], elements[2][3]) / det,
-                    det3x3(elements[0][0], elements[0][2], elements[0][3],
-                            elements[1][0], elements[1][2], elements[1][3],
-                            elements[2][0], elements[2][2], elements[2][3]) / det,
-                    -det3x3(elements[0][0], elements[0][1], elements[0][3],
-                            elements[1][0], elements[1][1], elements[1][3],
-                            elements[2][0], elements[2][1], elements[2][3]) / det,
-                    det3x3(elements[0][0], elements[0][1], elements[0][2],
-                            elements[1][0], elements[1][1], elements[1][2],
-                            elements[2][0], elements[2][1], elements[2][2]) / det
+                    (-e[1][0] * c[3] + e[1][1] * c[1] - e[1][2] * c[0]) / det,
+                    (e[0][0] * c[3] - e[0][1] * c[1] + e[0][2] * c[0]) / det,
+                    (-e[3][0] * s[3] + e[3][1] * s[1] - e[3][2] * s[0]) / det,
+                    (e[2][0] * s[3] - e[2][1] * s[1] + e[2][2] * s[0]) / det
             };
         }
 
+        // Inverse of an affine matrix (last column (0, 0, 0, 1)): 3x3 inverse of the linear part,
+        // translation mapped back through it. Identity if the linear part is singular
+        constexpr matrix inverseAffine( ) const noexcept {
+            const T (&e)[4][4] = elements;
+            matrix result;
+            T (&r)[4][4] = result.elements;
+            r[0][0] = e[1][1] * e[2][2] - e[1][2] * e[2][1];
+            r[0][1] = e[0][2] * e[2][1] - e[0][1] * e[2][2];
+            r[0][2] = e[0][1] * e[1][2] - e[0][2] * e[1][1];
+            r[1][0] = e[1][2] * e[2][0] - e[1][0] * e[2][2];
+            r[1][1] = e[0][0] * e[2][2] - e[0][2] * e[2][0];
+            r[1][2] = e[0][2] * e[1][0] - e[0][0] * e[1][2];
+            r[2][0] = e[1][0] * e[2][1] - e[1][1] * e[2][0];
+            r[2][1] = e[0][1] * e[2][0] - e[0][0] * e[2][1];
+            r[2][2] = e[0][0] * e[1][1] - e[0][1] * e[1][0];
+            const T det = e[0][0] * r[0][0] + e[0][1] * r[1][0] + e[0][2] * r[2][0];
+            if (det == T(0)) return identity();
+
+            const T inv = T(1) / det;
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 3; ++j) {
+                    r[i][j] *= inv;
+                }
+                r[i][3] = T(0);
+            }
+            for (size_t j = 0; j < 3; ++j) {
+                r[3][j] = -(e[3][0] * r[0][j] + e[3][1] * r[1][j] + e[3][2] * r[2][j]);
+            }
+            r[3][3] = T(1);
+
+            return result;
+        }
+
+        // Inverse of a rigid matrix (orthonormal 3x3 part, last column (0, 0, 0, 1)):
+        // transposed rotation, translation negated and rotated back
+        constexpr matrix inverseRigid( ) const noexcept {
+            const T (&e)[4][4] = elements;
+            matrix result;
+            T (&r)[4][4] = result.elements;
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 3; ++j) {
+                    r[i][j] = e[j][i];
+                }
+                r[i][3] = T(0);
+                r[3][i] = -(e[3][0] * e[i][0] + e[3][1] * e[i][1] + e[3][2] * e[i][2]);
+            }
+            r[3][3] = T(1);
+
+            return result;
+        }
+
+        // Inverse by the known kind of the matrix
+        constexpr matrix inverse( const transform_kind kind ) const noexcept {
+            return kind == transform_kind::rigid ? inverseRigid() :
+                   kind == transform_kind::affine ? inverseAffine() : inverse();
+        }
+
+        // Kind of this matrix: affine if the last column is exactly (0, 0, 0, 1), rigid if the
+        // rows of the 3x3 part are also orthonormal within epsilon
+        constexpr transform_kind kind( const T epsilon = T(1e-5) ) const noexcept {
+            if (elements[0][3] != T(0) || elements[1][3] != T(0) || elements[2][3] != T(0) ||
+                elements[3][3] != T(1))
+                return transform_kind::general;
+            for (size_t i = 0; i < 3; ++i)
+                for (size_t j = i; j < 3; ++j) {
+                    const T d = elements[i][0] * elements[j][0] + elements[i][1] * elements[j][1] +
+                                elements[i][2] * elements[j][2];
+                    if (vtx::math::abs(d - (i == j ? T(1) : T(0))) > epsilon)
+                        return transform_kind::affine;
+                }
+            return transform_kind::rigid;
+        }
+
         // Trace (sum of diagonal elements, only for square matrices)
         constexpr T trace() const noexcept {
             return elements[0][0] + elements[1][1] + elements[2][2] + elements[3][3];
@@ -431,6 +543,10 @@ namespace vtx
         constexpr vector<T, 4> operator*( const vector<T, 4>& v ) const noexcept {
             vector<T, 4> result;
 
+            if (simd::mat4<T>::enabled && !VTX_IS_CONSTANT_EVALUATED() &&
+                    simd::mat4<T>::mulVec(data(), v.data(), result.data()))
+                return result;
+
             for (size_t i = 0; i < 4; ++i) {
                 T sum = T(0);
                 for (size_t j = 0; j < 4; ++j) {
@@ -456,7 +572,8 @@ namespace vtx
 
         // Rotate matrix around X-axis
         constexpr static matrix rotateX( const T angleInDegree ) noexcept {
-            const T co = vtx::math::cos(vtx::math::D2R * angleInDegree), si = vtx::math::sin(vtx::math::D2R * angleInDegree);
+            T co = 0, si = 0;
+            vtx::math::policy::sincos(vtx::math::D2R * angleInDegree, si, co);
             return matrix{
                 1, 0, 0, 0,
                 0, co, si, 0,
@@ -467,7 +584,8 @@ namespace vtx
 
         // Rotate matrix around Y-axis
         constexpr static matrix rotateY( const T angleInDegree ) noexcept {
-            const T co = vtx::math::cos(vtx::math::D2R * angleInDegree), si = vtx::math::sin(vtx::math::D2R * angleInDegree);
+            T co = 0, si = 0;
+            vtx::math::policy::sincos(vtx::math::D2R * angleInDegree, si, co);
             return matrix{
                 co, 0, -si, 0,
                 0, 1, 0, 0,
@@ -478,7 +596,8 @@ namespace vtx
 
         // Rotate matrix around Z-axis
         constexpr static matrix rotateZ( const T angleInDegree ) noexcept {
-            const T co = vtx::math::cos(vtx::math::D2R * angleInDegree), si = vtx::math::sin(vtx::math::D2R * angleInDegree);
+            T co = 0, si = 0;
+            vtx::math::policy::sincos(vtx::math::D2R * angleInDegree, si, co);
             return matrix{
                 co, si, 0, 0,
                 -si, co, 0, 0,
@@ -489,7 +608,8 @@ namespace vtx
 
         // Rotate matrix around given axis
         constexpr static matrix rotate( const vector<T, 3>& v, const T angleInDegree ) noexcept {
-            const T co = vtx::math::cos(vtx::math::D2R * angleInDegree), si = vtx::math::sin(vtx::math::D2R * angleInDegree);
+            T co = 0, si = 0;
+            vtx::math::policy::sincos(vtx::math::D2R * angleInDegree, si, co);
             return matrix{
                 // 1
                 co + v[0] * v[0] * (1 - co),
@@ -559,9 +679,31 @@ namespace vtx
             };
         }
 
+        // Normal matrix (inverse transpose). Compute once when transforming many normals
+        constexpr matrix normalMatrix( ) const noexcept {
+            return inverse().transpose();
+        }
+
+        // Normal matrix by the known kind of the matrix (a rigid matrix keeps its own 3x3 part)
+        constexpr matrix normalMatrix( const transform_kind kind ) const noexcept {
+            if (kind != transform_kind::rigid)
+                return inverse(kind).transpose();
+
+            const T (&e)[4][4] = elements;
+            matrix result = *this;
+            for (size_t i = 0; i < 3; ++i) {
+                result.elements[i][3] = -(e[3][0] * e[i][0] + e[3][1] * e[i][1] + e[3][2] * e[i][2]);
+                result.elements[3][i] = T(0);
+            }
+
+            return result;
+        }
+
         // Transform matrix for normal
-        constexpr vector<T, 3> transformNormal( const vector<T, 3>& v ) const noexcept {
-            const matrix M = inverse().transpose();
+        constexpr vector<T, 3> transformNormal( const vector<T, 3>& v,
+                                                const transform_kind kind = transform_kind::general )
+                                                const noexcept {
+            const matrix M = normalMatrix(kind);
             return vector<T, 3>{
                     v[0] * M[0][0] + v[1] * M[1][0] + v[2] * M[2][0],
                     v[0] * M[0][1] + v[1] * M[1][1] + v[2] * M[2][1],
@@ -579,6 +721,74 @@ namespace vtx
             };
         }
 
+        //*************************************
+        // Batch transforms (vertex arrays)
+        //*************************************
+        // Strides are in bytes between consecutive elements, so positions and normals can be
+        // read from and written to interleaved vertex buffers. 'in' and 'out' may be the same buffer.
+        // policy::par splits large batches across the default thread pool.
+
+        // Transform points
+        void transformPoint( const T *in, const size_t inStride, T *out, const size_t outStride,
+                             const size_t count, const parallel::policy pol = parallel::policy::seq ) const {
+            transformBatch<TRANSFORM_POINT>(data(), in, inStride, out, outStride, count, pol);
+        }
+
+        void transformPoint( const vector<T, 3> *in, vector<T, 3> *out, const size_t count,
+                             const parallel::policy pol = parallel::policy::seq ) const {
+            transformPoint(reinterpret_cast<const T *>(in), sizeof(vector<T, 3>),
+                           reinterpret_cast<T *>(out), sizeof(vector<T, 3>), count, pol);
+        }
+
+        // Transform vectors (no translation)
+        void transformVector( const T *in, const size_t inStride, T *out, const size_t outStride,
+                              const size_t count, const parallel::policy pol = parallel::policy::seq ) const {
+            transformBatch<TRANSFORM_VECTOR>(data(), in, inStride, out, outStride, count, pol);
+        }
+
+        void transformVector( const vector<T, 3> *in, vector<T, 3> *out, const size_t count,
+                              const parallel::policy pol = parallel::policy::seq ) const {
+            transformVector(reinterpret_cast<const T *>(in), sizeof(vector<T, 3>),
+                            reinterpret_cast<T *>(out), sizeof(vector<T, 3>), count, pol);
+        }
+
+        // Transform normals (normal matrix is computed once per call, by the known kind of the matrix)
+        void transformNormal( const T *in, const size_t inStride, T *out, const size_t outStride,
+                              const size_t count, const transform_kind kind,
+                              const parallel::policy pol = parallel::policy::seq ) const {
+            const matrix M = normalMatrix(kind);
+            transformBatch<TRANSFORM_VECTOR>(M.data(), in, inStride, out, outStride, count, pol);
+        }
+
+        void transformNormal( const T *in, const size_t inStride, T *out, const size_t outStride,
+                              const size_t count, const parallel::policy pol = parallel::policy::seq ) const {
+            transformNormal(in, inStride, out, outStride, count, transform_kind::general, pol);
+        }
+
+        void transformNormal( const vector<T, 3> *in, vector<T, 3> *out, const size_t count,
+                              const transform_kind kind,
+                              const parallel::policy pol = parallel::policy::seq ) const {
+            transformNormal(reinterpret_cast<const T *>(in), sizeof(vector<T, 3>),
+                            reinterpret_cast<T *>(out), sizeof(vector<T, 3>), count, kind, pol);
+        }
+
+        void transformNormal( const vector<T, 3> *in, vector<T, 3> *out, const size_t count,
+                              const parallel::policy pol = parallel::policy::seq ) const {
+            transformNormal(in, out, count, transform_kind::general, pol);
+        }
+
+        // Transform points with perspective divide
+        void transform4x4( const T *in, const size_t inStride, T *out, const size_t outStride,
+                           const size_t count, const parallel::policy pol = parallel::policy::seq ) const {
+            transformBatch<TRANSFORM_PROJECTIVE>(data(), in, inStride, out, outStride, count, pol);
+        }
+
+        void transform4x4( const vector<T, 3> *in, vector<T, 3> *out, const size_t count,
+                           const parallel::policy pol = parallel::policy::seq ) const {
+            transform4x4(reinterpret_cast<const T *>(in), sizeof(vector<T, 3>),
+                         reinterpret_cast<T *>(out), sizeof(vector<T, 3>), count, pol);
+        }
+
         //*******************************
         // Projection-view-ortho matrices
         //*******************************
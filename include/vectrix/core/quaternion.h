@@ -6,6 +6,7 @@
 #define VECTRIX_QUATERNION_H
 
 #include "vectrix/math/common.h"
+#include "vectrix/math/fast.h"
 
 #include "base_matrix.h"
 
@@ -35,7 +36,9 @@ namespace vtx {
             struct {
                 union {
                     vector<T, 3> Vec;
-                    T X, Y, Z;
+                    struct {
+                        T X, Y, Z;
+                    };
                 };
                 T W;
             };
@@ -289,25 +292,52 @@ namespace vtx {
             };
         }
 
-        // Two quaternions square interpolation
+        // Normalized linear interpolation along the shortest arc (unit quaternions)
+        constexpr quaternion nlerp( const quaternion& q, const T t ) const noexcept {
+            const T cos_a = W * q.W + X * q.X + Y * q.Y + Z * q.Z;
+            return lerp(cos_a < 0 ? -q : q, t).normalized();
+        }
+
+        // Cosine of the angle above which slerp falls back to nlerp (sin(alpha) -> 0 there,
+        // the rotation angle error of nlerp is below 7.3e-7 rad)
+        static constexpr T SLERP_NLERP_COS = T(0.9996);
+
+        // Spherical linear interpolation along the shortest arc (unit quaternions)
         constexpr quaternion slerp( const quaternion& q, const T t ) const noexcept {
             T cos_a = W * q.W + X * q.X + Y * q.Y + Z * q.Z;
-            quaternion a = *this, b = q;
+            quaternion b = q;
 
             if (cos_a < 0)
                 cos_a = -cos_a, b = -b;
+            if (cos_a > SLERP_NLERP_COS)
+                return lerp(b, t).normalized();
+
+            const T
+                alpha = vtx::math::policy::acos(cos_a),
+                sin_a_rev = 1 / vtx::math::policy::sin(alpha),
+                sin_ta = vtx::math::policy::sin(t * alpha) * sin_a_rev,
+                sin_1_ta = vtx::math::policy::sin((1 - t) * alpha) * sin_a_rev;
+
+            return quaternion{
+                    X * sin_1_ta + b.X * sin_ta,
+                    Y * sin_1_ta + b.Y * sin_ta,
+                    Z * sin_1_ta + b.Z * sin_ta,
+                    W * sin_1_ta + b.W * sin_ta
+            };
+        }
 
+        // Rotate vector by unit quaternion (same as v * rotateMatr()):
+        // t = 2 (Vec x v), v' = v + W t + Vec x t
+        constexpr vector<T, 3> rotateVector( const vector<T, 3>& v ) const noexcept {
             const T
-                alpha = acos(cos_a),
-                sin_a_rev = 1 / sin(alpha),
-                sin_ta = sin(t * alpha),
-                sin_1_ta = sin((1 - t) * alpha);
-
-            return quat(
-                    (a.X * sin_1_ta + b.X * sin_ta) * sin_a_rev,
-                    (a.Y * sin_1_ta + b.Y * sin_ta) * sin_a_rev,
-                    (a.Z * sin_1_ta + b.Z * sin_ta) * sin_a_rev,
-                    (a.W * sin_1_ta + b.W * sin_ta) * sin_a_rev);
+                tx = 2 * (Y * v[2] - Z * v[1]),
+                ty = 2 * (Z * v[0] - X * v[2]),
+                tz = 2 * (X * v[1] - Y * v[0]);
+
+            return vector<T, 3>(
+                    v[0] + W * tx + (Y * tz - Z * ty),
+                    v[1] + W * ty + (Z * tx - X * tz),
+                    v[2] + W * tz + (X * ty - Y * tx));
         }
 
         // Get rotation (around 3D vector by angle in degrees) quaternion
@@ -0,0 +1,148 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SKINNING_H
+#define VECTRIX_SKINNING_H
+
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+
+#include "affine3.h"
+#include "dual_quaternion.h"
+#include "matrix4x4.h"
+#include "soa_vector.h"
+
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/simd/dispatch.h"
+
+#define VTX_SIMD_KERNELS "vectrix/core/detail/skinning_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
+
+namespace vtx {
+	// Batch skinning of meshes: every vertex is transformed by the blend of up to MAX_INFLUENCES
+	// bones of a palette. Influences are given per vertex (vertex-major): bone indices into the
+	// palette and weights, 'influences' of each per vertex, weights summing to 1 (an unused
+	// influence has weight 0 and any valid bone). Positions and normals are soa_vector<T, 3>
+	// streams, one vertex per SIMD lane; the output may be the input. Large meshes are split across
+	// threads under policy::par.
+	namespace skinning {
+		// Maximal influences per vertex
+		constexpr size_t MAX_INFLUENCES = 8;
+
+		// Vertices per task when skinning is split across threads
+		constexpr size_t SKIN_GRAIN = 4096;
+
+		namespace skinning_detail {
+			// Kernel of vtx::simd: (palette, bones, weights, influences, positions, normals or null,
+			// output positions, output normals, count)
+			template <typename T>
+			using kernel_fn = void (*)(const T *, const std::uint32_t *, const T *, size_t, const T *const *,
+			    const T *const *, T *const *, T *const *, size_t);
+
+			// Run the kernel over all vertices, split across the default thread pool under policy::par
+			template <typename T>
+			void run(const kernel_fn<T> kernel, const T *palette, const std::uint32_t *bones,
+			    const T *weights, const size_t influences, const soa_vector<T, 3> &positions,
+			    soa_vector<T, 3> &outPositions, const soa_vector<T, 3> *normals, soa_vector<T, 3> *outNormals,
+			    const parallel::policy pol) {
+				assert(influences > 0 && influences <= MAX_INFLUENCES);
+				const size_t n = positions.size();
+				if (&outPositions != &positions) outPositions.resize(n);
+				if (normals) {
+					assert(normals->size() == n);
+					if (outNormals != normals) outNormals->resize(n);
+				}
+
+				auto chunk = [&](const size_t b, const size_t e) {
+					const T *pos[3], *nrm[3];
+					T *outPos[3], *outNrm[3];
+					for (size_t c = 0; c < 3; ++c) {
+						pos[c] = positions.data(c) + b;
+						outPos[c] = outPositions.data(c) + b;
+						nrm[c] = normals ? normals->data(c) + b : nullptr;
+						outNrm[c] = normals ? outNormals->data(c) + b : nullptr;
+					}
+					kernel(palette, bones + b * influences, weights + b * influences, influences, pos,
+					    normals ? nrm : nullptr, outPos, outNrm, e - b);
+				};
+
+				if (pol == parallel::policy::seq)
+					chunk(0, n);
+				else
+					parallel::parallel_for(0, n, SKIN_GRAIN, chunk);
+			}
+		}  // namespace skinning_detail
+
+		// Dual quaternion skinning of positions (unit dual quaternions palette)
+		template <typename T>
+		void dualQuaternion(const dual_quaternion<T> *palette, const std::uint32_t *bones, const T *weights,
+		    const size_t influences, const soa_vector<T, 3> &positions, soa_vector<T, 3> &outPositions,
+		    const parallel::policy pol = parallel::policy::seq) {
+			static_assert(
+			    sizeof(dual_quaternion<T>) == 8 * sizeof(T), "dual_quaternion<T> must be 8 packed elements");
+			skinning_detail::run<T>(simd::select(VTX_SIMD_FN(skinDualQuaternion<T>)), palette->data(), bones,
+			    weights, influences, positions, outPositions, nullptr, nullptr, pol);
+		}
+
+		// Positions and normals (rotated only: the blend is rigid)
+		template <typename T>
+		void dualQuaternion(const dual_quaternion<T> *palette, const std::uint32_t *bones, const T *weights,
+		    const size_t influences, const soa_vector<T, 3> &positions, const soa_vector<T, 3> &normals,
+		    soa_vector<T, 3> &outPositions, soa_vector<T, 3> &outNormals,
+		    const parallel::policy pol = parallel::policy::seq) {
+			static_assert(
+			    sizeof(dual_quaternion<T>) == 8 * sizeof(T), "dual_quaternion<T> must be 8 packed elements");
+			skinning_detail::run<T>(simd::select(VTX_SIMD_FN(skinDualQuaternion<T>)), palette->data(), bones,
+			    weights, influences, positions, outPositions, &normals, &outNormals, pol);
+		}
+
+		// Linear blend skinning of positions: the weighted sum of the bone matrices, blended in
+		// registers per vertex (affine3<T> palette, 12 elements per bone)
+		template <typename T>
+		void linear(const affine3<T> *palette, const std::uint32_t *bones, const T *weights,
+		    const size_t influences, const soa_vector<T, 3> &positions, soa_vector<T, 3> &outPositions,
+		    const parallel::policy pol = parallel::policy::seq) {
+			static_assert(sizeof(affine3<T>) == 12 * sizeof(T), "affine3<T> must be 12 packed elements");
+			skinning_detail::run<T>(simd::select(VTX_SIMD_FN(skinLinear<T, false>)), palette->data(), bones,
+			    weights, influences, positions, outPositions, nullptr, nullptr, pol);
+		}
+
+		// Positions and normals: normals go through the inverse transpose of the blended matrix
+		// (as matrix<T, 4, 4>::transformNormal) and are renormalized
+		template <typename T>
+		void linear(const affine3<T> *palette, const std::uint32_t *bones, const T *weights,
+		    const size_t influences, const soa_vector<T, 3> &positions, const soa_vector<T, 3> &normals,
+		    soa_vector<T, 3> &outPositions, soa_vector<T, 3> &outNormals,
+		    const parallel::policy pol = parallel::policy::seq) {
+			static_assert(sizeof(affine3<T>) == 12 * sizeof(T), "affine3<T> must be 12 packed elements");
+			skinning_detail::run<T>(simd::select(VTX_SIMD_FN(skinLinear<T, false>)), palette->data(), bones,
+			    weights, influences, positions, outPositions, &normals, &outNormals, pol);
+		}
+
+		// matrix<T, 4, 4> palette (affine: last column (0, 0, 0, 1) is not read)
+		template <typename T>
+		void linear(const matrix<T, 4, 4> *palette, const std::uint32_t *bones, const T *weights,
+		    const size_t influences, const soa_vector<T, 3> &positions, soa_vector<T, 3> &outPositions,
+		    const parallel::policy pol = parallel::policy::seq) {
+			static_assert(
+			    sizeof(matrix<T, 4, 4>) == 16 * sizeof(T), "matrix<T, 4, 4> must be 16 packed elements");
+			skinning_detail::run<T>(simd::select(VTX_SIMD_FN(skinLinear<T, true>)), palette->data(), bones,
+			    weights, influences, positions, outPositions, nullptr, nullptr, pol);
+		}
+
+		template <typename T>
+		void linear(const matrix<T, 4, 4> *palette, const std::uint32_t *bones, const T *weights,
+		    const size_t influences, const soa_vector<T, 3> &positions, const soa_vector<T, 3> &normals,
+		    soa_vector<T, 3> &outPositions, soa_vector<T, 3> &outNormals,
+		    const parallel::policy pol = parallel::policy::seq) {
+			static_assert(
+			    sizeof(matrix<T, 4, 4>) == 16 * sizeof(T), "matrix<T, 4, 4> must be 16 packed elements");
+			skinning_detail::run<T>(simd::select(VTX_SIMD_FN(skinLinear<T, true>)), palette->data(), bones,
+			    weights, influences, positions, outPositions, &normals, &outNormals, pol);
+		}
+	}  // namespace skinning
+}  // namespace vtx
+
+#endif //VECTRIX_SKINNING_H
@@ -0,0 +1,189 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SOA_MATRIX_H
+#define VECTRIX_SOA_MATRIX_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+#include "base_matrix.h"
+#include "matrix3x3.h"
+#include "matrix4x4.h"
+
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/simd/dispatch.h"
+#include "vectrix/utils/memory.h"
+
+#define VTX_SIMD_KERNELS "vectrix/core/detail/soa_matrix_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
+
+namespace vtx {
+	// Structure-of-arrays container of matrix<T, M, N>.
+	// Every element (row-major index r * N + c) lives in its own 64-byte aligned stream, so the
+	// batch determinant and inverse of 3x3 and 4x4 matrices process one matrix per SIMD lane.
+	template <typename T, size_t M, size_t N>
+	class soa_matrix {
+	public:
+		static_assert(M > 0 && N > 0, "Matrix dimensions must be greater than zero");
+
+		// Matrices per task when an operation is split across threads
+		static constexpr size_t SOA_GRAIN = 4096;
+
+		using value_type = matrix<T, M, N>;
+		using stream_type = std::vector<T, aligned_allocator<T>>;
+
+		// Class default constructor
+		soa_matrix() = default;
+
+		// n copies of m
+		explicit soa_matrix(const size_t n, const value_type &m = value_type(T(0))) { resize(n, m); }
+
+		// Initializer list constructor
+		soa_matrix(std::initializer_list<value_type> list) { assign(list.begin(), list.size()); }
+
+		// Array of structures constructor
+		soa_matrix(const value_type *aos, const size_t n) { assign(aos, n); }
+
+		// Matrices count
+		size_t size() const noexcept { return streams[0].size(); }
+		bool empty() const noexcept { return streams[0].empty(); }
+
+		void reserve(const size_t n) {
+			for (auto &s : streams) s.reserve(n);
+		}
+
+		void resize(const size_t n, const value_type &m = value_type(T(0))) {
+			for (size_t k = 0; k < M * N; ++k) streams[k].resize(n, m(k / N, k % N));
+		}
+
+		void clear() noexcept {
+			for (auto &s : streams) s.clear();
+		}
+
+		void push_back(const value_type &m) {
+			for (size_t k = 0; k < M * N; ++k) streams[k].push_back(m(k / N, k % N));
+		}
+
+		value_type get(const size_t i) const noexcept {
+			value_type m;
+			for (size_t k = 0; k < M * N; ++k) m(k / N, k % N) = streams[k][i];
+			return m;
+		}
+
+		void set(const size_t i, const value_type &m) noexcept {
+			for (size_t k = 0; k < M * N; ++k) streams[k][i] = m(k / N, k % N);
+		}
+
+		// Stream of element (row, col)
+		T *data(const size_t row, const size_t col) noexcept { return streams[row * N + col].data(); }
+		const T *data(const size_t row, const size_t col) const noexcept {
+			return streams[row * N + col].data();
+		}
+
+		// Replace contents with n matrices of array of structures
+		void assign(const value_type *aos, const size_t n) {
+			for (auto &s : streams) s.resize(n);
+			for (size_t i = 0; i < n; ++i) set(i, aos[i]);
+		}
+
+		// Convert to array of structures
+		std::vector<value_type> toAoS() const {
+			std::vector<value_type> aos(size());
+			for (size_t i = 0; i < size(); ++i) aos[i] = get(i);
+			return aos;
+		}
+
+		// Determinants of every matrix (3x3 and 4x4 only)
+		void determinant(T *out, const parallel::policy pol = parallel::policy::seq) const {
+			static_assert(M == N && (N == 3 || N == 4), "Batch determinant is defined for 3x3 and 4x4 only");
+			const auto a = pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaDeterminant<T, N>));
+			forRange(pol, [&](const size_t i, const size_t e) { kernel(a.offset(i).p, e - i, out + i); });
+		}
+
+		stream_type determinant(const parallel::policy pol = parallel::policy::seq) const {
+			stream_type out(size());
+			determinant(out.data(), pol);
+			return out;
+		}
+
+		// Inverses of every matrix into out (3x3 and 4x4 only; out may be *this).
+		// A matrix with |determinant| <= epsilon (or NaN) is singular: its inverse is identity
+		// and singular[i] (when not null) is 1, otherwise 0. Returns the singular matrices count
+		size_t inverse(soa_matrix &out, std::uint8_t *singular = nullptr, const T epsilon = T(0),
+		    const parallel::policy pol = parallel::policy::seq) const {
+			static_assert(M == N && (N == 3 || N == 4), "Batch inverse is defined for 3x3 and 4x4 only");
+			static_assert(std::is_floating_point<T>::value,
+			    "Batch inverse supports float-point matrices only");
+			if (&out != this) out.resize(size());
+			const auto a = pointers();
+			const auto r = out.pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaInverse<T, N>));
+			auto chunk = [&](const size_t i, const size_t e) {
+				return kernel(
+				    a.offset(i).p, r.offset(i).p, e - i, epsilon, singular ? singular + i : nullptr);
+			};
+
+			if (pol == parallel::policy::seq) return chunk(0, size());
+			return parallel::parallel_reduce(size_t(0), size(), SOA_GRAIN, size_t(0), chunk,
+			    [](const size_t x, const size_t y) { return x + y; });
+		}
+
+		// Inverted copy, singular matrices flagged in 'singular' (resized to size())
+		soa_matrix inverse(std::vector<std::uint8_t> &singular, const T epsilon = T(0),
+		    const parallel::policy pol = parallel::policy::seq) const {
+			soa_matrix res;
+			singular.resize(size());
+			inverse(res, singular.data(), epsilon, pol);
+			return res;
+		}
+
+	private:
+		stream_type streams[M * N];
+
+		// Element pointers of all streams
+		template <typename P>
+		struct stream_ptrs {
+			P *p[M * N];
+
+			// Pointers to matrix i
+			stream_ptrs offset(const size_t i) const noexcept {
+				stream_ptrs s;
+				for (size_t k = 0; k < M * N; ++k) s.p[k] = p[k] + i;
+				return s;
+			}
+		};
+
+		stream_ptrs<const T> pointers() const noexcept {
+			stream_ptrs<const T> s;
+			for (size_t k = 0; k < M * N; ++k) s.p[k] = streams[k].data();
+			return s;
+		}
+
+		stream_ptrs<T> pointers() noexcept {
+			stream_ptrs<T> s;
+			for (size_t k = 0; k < M * N; ++k) s.p[k] = streams[k].data();
+			return s;
+		}
+
+		// Run fn(b, e) over all matrices, split across the default thread pool under policy::par
+		template <typename F>
+		void forRange(const parallel::policy pol, F &&fn) const {
+			if (pol == parallel::policy::seq)
+				fn(size_t(0), size());
+			else
+				parallel::parallel_for(0, size(), SOA_GRAIN, fn);
+		}
+	};
+
+	// Set other names for SoA matrix containers
+	template <typename T>
+	using soa_mat3 = soa_matrix<T, 3, 3>;
+	template <typename T>
+	using soa_mat4 = soa_matrix<T, 4, 4>;
+}  // namespace vtx
+
+#endif //VECTRIX_SOA_MATRIX_H
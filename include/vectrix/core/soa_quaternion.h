@@ -0,0 +1,233 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SOA_QUATERNION_H
+#define VECTRIX_SOA_QUATERNION_H
+
+#include <cassert>
+#include <initializer_list>
+#include <vector>
+
+#include "quaternion.h"
+#include "soa_vector.h"
+
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/simd/dispatch.h"
+#include "vectrix/utils/memory.h"
+
+#define VTX_SIMD_KERNELS "vectrix/core/detail/soa_quaternion_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
+
+namespace vtx {
+	// Structure-of-arrays container of quaternion<T>: X, Y, Z and W in their own 64-byte aligned
+	// streams, so the batch rotation, product, nlerp and slerp process one quaternion per SIMD
+	// lane. Rotations and interpolations expect unit quaternions.
+	template <typename T>
+	class soa_quaternion {
+	public:
+		// Quaternions per task when an operation is split across threads
+		static constexpr size_t SOA_GRAIN = 16384;
+
+		using value_type = quaternion<T>;
+		using stream_type = std::vector<T, aligned_allocator<T>>;
+
+		// Class default constructor
+		soa_quaternion() = default;
+
+		// n copies of q
+		explicit soa_quaternion(const size_t n, const value_type &q = value_type(T(0), T(0), T(0), T(1))) {
+			resize(n, q);
+		}
+
+		// Initializer list constructor
+		soa_quaternion(std::initializer_list<value_type> list) { assign(list.begin(), list.size()); }
+
+		// Array of structures constructor
+		soa_quaternion(const value_type *aos, const size_t n) { assign(aos, n); }
+
+		// Quaternions count
+		size_t size() const noexcept { return streams[0].size(); }
+		bool empty() const noexcept { return streams[0].empty(); }
+
+		void reserve(const size_t n) {
+			for (auto &s : streams) s.reserve(n);
+		}
+
+		void resize(const size_t n, const value_type &q = value_type(T(0), T(0), T(0), T(1))) {
+			for (size_t k = 0; k < 4; ++k) streams[k].resize(n, q[k]);
+		}
+
+		void clear() noexcept {
+			for (auto &s : streams) s.clear();
+		}
+
+		void push_back(const value_type &q) {
+			for (size_t k = 0; k < 4; ++k) streams[k].push_back(q[k]);
+		}
+
+		value_type get(const size_t i) const noexcept {
+			return value_type(streams[0][i], streams[1][i], streams[2][i], streams[3][i]);
+		}
+
+		void set(const size_t i, const value_type &q) noexcept {
+			for (size_t k = 0; k < 4; ++k) streams[k][i] = q[k];
+		}
+
+		// Component stream (0..3 = X, Y, Z, W)
+		T *data(const size_t k) noexcept { return streams[k].data(); }
+		const T *data(const size_t k) const noexcept { return streams[k].data(); }
+
+		// Replace contents with n quaternions of array of structures
+		void assign(const value_type *aos, const size_t n) {
+			for (auto &s : streams) s.resize(n);
+			for (size_t i = 0; i < n; ++i) set(i, aos[i]);
+		}
+
+		// Convert to array of structures
+		std::vector<value_type> toAoS() const {
+			std::vector<value_type> aos(size());
+			for (size_t i = 0; i < size(); ++i) aos[i] = get(i);
+			return aos;
+		}
+
+		// Normalize every quaternion
+		soa_quaternion &normalize(const parallel::policy pol = parallel::policy::seq) {
+			const auto r = pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaQuatNormalize<T>));
+			forRange(pol, [&](const size_t i, const size_t e) {
+				kernel(r.offset(i).p, r.offset(i).p, e - i);
+			});
+			return *this;
+		}
+
+		// Hamilton products this[i] * q[i] into out (out may be *this or q)
+		void multiply(const soa_quaternion &q, soa_quaternion &out,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			assert(q.size() == size());
+			if (&out != this && &out != &q) out.resize(size());
+			const auto a = pointers(), b = q.pointers();
+			const auto r = out.pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaQuatMultiply<T>));
+			forRange(pol, [&](const size_t i, const size_t e) {
+				kernel(a.offset(i).p, b.offset(i).p, r.offset(i).p, e - i);
+			});
+		}
+
+		soa_quaternion multiply(
+		    const soa_quaternion &q, const parallel::policy pol = parallel::policy::seq) const {
+			soa_quaternion res;
+			multiply(q, res, pol);
+			return res;
+		}
+
+		// Vectors v[i] rotated by this[i] into out (out may be v), as quaternion<T>::rotateVector
+		void rotate(const soa_vector<T, 3> &v, soa_vector<T, 3> &out,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			assert(v.size() == size());
+			if (&out != &v) out.resize(size());
+			const stream_ptrs<const T, 3> in = {{v.data(0), v.data(1), v.data(2)}};
+			const stream_ptrs<T, 3> r = {{out.data(0), out.data(1), out.data(2)}};
+			const auto q = pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaQuatRotate<T>));
+			forRange(pol, [&](const size_t i, const size_t e) {
+				kernel(q.offset(i).p, in.offset(i).p, r.offset(i).p, e - i);
+			});
+		}
+
+		soa_vector<T, 3> rotate(
+		    const soa_vector<T, 3> &v, const parallel::policy pol = parallel::policy::seq) const {
+			soa_vector<T, 3> res;
+			rotate(v, res, pol);
+			return res;
+		}
+
+		// Normalized linear interpolation of every pair along the shortest arc, t in [0, 1]
+		// (out may be *this or q)
+		void nlerp(const soa_quaternion &q, const T t, soa_quaternion &out,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			interpolate<false>(q, &t, 0, out, pol);
+		}
+
+		// Per-pair factors t[0..size())
+		void nlerp(const soa_quaternion &q, const T *t, soa_quaternion &out,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			interpolate<false>(q, t, 1, out, pol);
+		}
+
+		soa_quaternion nlerp(const soa_quaternion &q, const T t,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			soa_quaternion res;
+			nlerp(q, t, res, pol);
+			return res;
+		}
+
+		// Spherical linear interpolation of every pair along the shortest arc, t in [0, 1].
+		// Pairs closer than quaternion<T>::SLERP_NLERP_COS take nlerp (out may be *this or q)
+		void slerp(const soa_quaternion &q, const T t, soa_quaternion &out,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			interpolate<true>(q, &t, 0, out, pol);
+		}
+
+		// Per-pair factors t[0..size())
+		void slerp(const soa_quaternion &q, const T *t, soa_quaternion &out,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			interpolate<true>(q, t, 1, out, pol);
+		}
+
+		soa_quaternion slerp(const soa_quaternion &q, const T t,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			soa_quaternion res;
+			slerp(q, t, res, pol);
+			return res;
+		}
+
+	private:
+		stream_type streams[4];
+
+		// Component pointers of K streams
+		template <typename P, size_t K = 4>
+		struct stream_ptrs {
+			P *p[K];
+
+			// Pointers to element i
+			stream_ptrs offset(const size_t i) const noexcept {
+				stream_ptrs s;
+				for (size_t k = 0; k < K; ++k) s.p[k] = p[k] + i;
+				return s;
+			}
+		};
+
+		stream_ptrs<const T> pointers() const noexcept {
+			return {{streams[0].data(), streams[1].data(), streams[2].data(), streams[3].data()}};
+		}
+
+		stream_ptrs<T> pointers() noexcept {
+			return {{streams[0].data(), streams[1].data(), streams[2].data(), streams[3].data()}};
+		}
+
+		// Run fn(b, e) over all quaternions, split across the default thread pool under policy::par
+		template <typename F>
+		void forRange(const parallel::policy pol, F &&fn) const {
+			if (pol == parallel::policy::seq)
+				fn(size_t(0), size());
+			else
+				parallel::parallel_for(0, size(), SOA_GRAIN, fn);
+		}
+
+		template <bool Slerp>
+		void interpolate(const soa_quaternion &q, const T *t, const size_t tStride, soa_quaternion &out,
+		    const parallel::policy pol) const {
+			assert(q.size() == size());
+			if (&out != this && &out != &q) out.resize(size());
+			const auto a = pointers(), b = q.pointers();
+			const auto r = out.pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaQuatInterpolate<T, Slerp>));
+			forRange(pol, [&](const size_t i, const size_t e) {
+				kernel(a.offset(i).p, b.offset(i).p, t + i * tStride, tStride, r.offset(i).p, e - i);
+			});
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_SOA_QUATERNION_H
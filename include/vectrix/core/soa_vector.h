@@ -0,0 +1,400 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SOA_VECTOR_H
+#define VECTRIX_SOA_VECTOR_H
+
+#include <initializer_list>
+#include <vector>
+
+#include "base_vector.h"
+#include "vector2.h"
+#include "vector3.h"
+#include "vector4.h"
+
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/simd/dispatch.h"
+#include "vectrix/utils/memory.h"
+
+#define VTX_SIMD_KERNELS "vectrix/core/detail/soa_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
+
+namespace vtx {
+	// Structure-of-arrays container of vector<T, N>.
+	// Every component lives in its own 64-byte aligned stream, so bulk operations
+	// process a full SIMD register of elements per instruction.
+	template <typename T, size_t N>
+	class soa_vector {
+	public:
+		static_assert(N > 0, "Vector dimension N must be greater than zero");
+
+		// Elements per task when an operation is split across threads
+		static constexpr size_t SOA_GRAIN = 16384;
+
+		using value_type = vector<T, N>;
+		using stream_type = std::vector<T, aligned_allocator<T>>;
+
+		class const_reference;
+
+		// Proxy to element i, behaves like vector<T, N>
+		class reference {
+		public:
+			reference(soa_vector &s, const size_t i) noexcept : soa(&s), ind(i) {}
+			reference(const reference &) = default;
+
+			// Element value
+			value_type get() const noexcept { return soa->get(ind); }
+			operator value_type() const noexcept { return get(); }
+
+			// Write whole element
+			reference &operator=(const value_type &v) noexcept {
+				soa->set(ind, v);
+				return *this;
+			}
+			reference &operator=(const reference &r) noexcept { return *this = r.get(); }
+
+			// Component access
+			T &operator[](const size_t k) const noexcept { return soa->streams[k][ind]; }
+
+			reference &operator+=(const value_type &v) noexcept { return *this = get() + v; }
+			reference &operator-=(const value_type &v) noexcept { return *this = get() - v; }
+			reference &operator*=(const T n) noexcept { return *this = get() * n; }
+			reference &operator/=(const T n) noexcept { return *this = get() / n; }
+
+			value_type operator+(const value_type &v) const noexcept { return get() + v; }
+			value_type operator-(const value_type &v) const noexcept { return get() - v; }
+			value_type operator*(const T n) const noexcept { return get() * n; }
+			value_type operator/(const T n) const noexcept { return get() / n; }
+			bool operator==(const value_type &v) const noexcept { return get() == v; }
+			bool operator!=(const value_type &v) const noexcept { return !(get() == v); }
+
+			T dot(const value_type &v) const noexcept { return get().dot(v); }
+			T squaredLength() const noexcept { return get().squaredLength(); }
+			T length() const noexcept { return get().length(); }
+			value_type normalized() const noexcept { return get().normalized(); }
+
+		private:
+			friend class const_reference;
+
+			soa_vector *soa;
+			size_t ind;
+		};
+
+		// Read-only proxy to element i
+		class const_reference {
+		public:
+			const_reference(const soa_vector &s, const size_t i) noexcept : soa(&s), ind(i) {}
+			const_reference(const reference &r) noexcept : soa(r.soa), ind(r.ind) {}
+
+			value_type get() const noexcept { return soa->get(ind); }
+			operator value_type() const noexcept { return get(); }
+
+			T operator[](const size_t k) const noexcept { return soa->streams[k][ind]; }
+
+			value_type operator+(const value_type &v) const noexcept { return get() + v; }
+			value_type operator-(const value_type &v) const noexcept { return get() - v; }
+			value_type operator*(const T n) const noexcept { return get() * n; }
+			value_type operator/(const T n) const noexcept { return get() / n; }
+			bool operator==(const value_type &v) const noexcept { return get() == v; }
+			bool operator!=(const value_type &v) const noexcept { return !(get() == v); }
+
+			T dot(const value_type &v) const noexcept { return get().dot(v); }
+			T squaredLength() const noexcept { return get().squaredLength(); }
+			T length() const noexcept { return get().length(); }
+			value_type normalized() const noexcept { return get().normalized(); }
+
+		private:
+			const soa_vector *soa;
+			size_t ind;
+		};
+
+		// Class default constructor
+		soa_vector() = default;
+
+		// n copies of v
+		explicit soa_vector(const size_t n, const value_type &v = value_type(T(0))) {
+			resize(n, v);
+		}
+
+		// Initializer list constructor
+		soa_vector(std::initializer_list<value_type> list) { assign(list.begin(), list.size()); }
+
+		// Array of structures constructor
+		soa_vector(const value_type *aos, const size_t n) { assign(aos, n); }
+
+		// Elements count
+		size_t size() const noexcept { return streams[0].size(); }
+		bool empty() const noexcept { return streams[0].empty(); }
+		size_t capacity() const noexcept { return streams[0].capacity(); }
+
+		void reserve(const size_t n) {
+			for (size_t k = 0; k < N; ++k) streams[k].reserve(n);
+		}
+
+		void resize(const size_t n, const value_type &v = value_type(T(0))) {
+			for (size_t k = 0; k < N; ++k) streams[k].resize(n, v[k]);
+		}
+
+		void clear() noexcept {
+			for (size_t k = 0; k < N; ++k) streams[k].clear();
+		}
+
+		void push_back(const value_type &v) {
+			for (size_t k = 0; k < N; ++k) streams[k].push_back(v[k]);
+		}
+
+		void pop_back() noexcept {
+			for (size_t k = 0; k < N; ++k) streams[k].pop_back();
+		}
+
+		// Element access
+		reference operator[](const size_t i) noexcept { return reference(*this, i); }
+		const_reference operator[](const size_t i) const noexcept { return const_reference(*this, i); }
+
+		value_type get(const size_t i) const noexcept {
+			value_type v;
+			for (size_t k = 0; k < N; ++k) v[k] = streams[k][i];
+			return v;
+		}
+
+		void set(const size_t i, const value_type &v) noexcept {
+			for (size_t k = 0; k < N; ++k) streams[k][i] = v[k];
+		}
+
+		// Component stream (aligned to CACHE_LINE)
+		T *data(const size_t k) noexcept { return streams[k].data(); }
+		const T *data(const size_t k) const noexcept { return streams[k].data(); }
+
+		// Replace contents from array of structures
+		void assign(const value_type *aos, const size_t n) {
+			for (size_t k = 0; k < N; ++k) streams[k].resize(n);
+
+			// Blocked transposition keeps the N output streams and the input block in cache
+			constexpr size_t BLOCK = 256;
+			for (size_t b = 0; b < n; b += BLOCK) {
+				const size_t e = vtx::math::min(n, b + BLOCK);
+				for (size_t k = 0; k < N; ++k) {
+					T *dst = streams[k].data();
+					for (size_t i = b; i < e; ++i) dst[i] = aos[i][k];
+				}
+			}
+		}
+
+		// Write contents to array of structures (size() elements)
+		void store(value_type *aos) const noexcept {
+			constexpr size_t BLOCK = 256;
+			const size_t n = size();
+			for (size_t b = 0; b < n; b += BLOCK) {
+				const size_t e = vtx::math::min(n, b + BLOCK);
+				for (size_t k = 0; k < N; ++k) {
+					const T *src = streams[k].data();
+					for (size_t i = b; i < e; ++i) aos[i][k] = src[i];
+				}
+			}
+		}
+
+		// Convert to array of structures
+		std::vector<value_type> toAoS() const {
+			std::vector<value_type> aos(size());
+			store(aos.data());
+			return aos;
+		}
+
+		// Element-wise dot products
+		void dot(const soa_vector &v, T *out, const parallel::policy pol = parallel::policy::seq) const {
+			assert(v.size() == size());
+			const auto a = pointers(), b = v.pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaDot<T, N>));
+			forRange(pol, [&](const size_t i, const size_t e) {
+				kernel(a.offset(i).p, b.offset(i).p, e - i, out + i);
+			});
+		}
+
+		stream_type dot(const soa_vector &v, const parallel::policy pol = parallel::policy::seq) const {
+			stream_type out(size());
+			dot(v, out.data(), pol);
+			return out;
+		}
+
+		// Dot products of every element with v
+		void dot(const value_type &v, T *out, const parallel::policy pol = parallel::policy::seq) const {
+			const auto a = pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaDotVec<T, N>));
+			forRange(pol, [&](const size_t i, const size_t e) {
+				kernel(a.offset(i).p, v.data(), e - i, out + i);
+			});
+		}
+
+		stream_type dot(const value_type &v, const parallel::policy pol = parallel::policy::seq) const {
+			stream_type out(size());
+			dot(v, out.data(), pol);
+			return out;
+		}
+
+		// Squared lengths of every element
+		void squaredLength(T *out, const parallel::policy pol = parallel::policy::seq) const {
+			const auto a = pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaSquaredLength<T, N>));
+			forRange(pol, [&](const size_t i, const size_t e) { kernel(a.offset(i).p, e - i, out + i); });
+		}
+
+		stream_type squaredLength(const parallel::policy pol = parallel::policy::seq) const {
+			stream_type out(size());
+			squaredLength(out.data(), pol);
+			return out;
+		}
+
+		// Normalize every element
+		soa_vector &normalize(const parallel::policy pol = parallel::policy::seq) {
+			const auto r = pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaNormalize<T, N>));
+			forRange(pol, [&](const size_t i, const size_t e) {
+				kernel(r.offset(i).p, r.offset(i).p, e - i);
+			});
+			return *this;
+		}
+
+		// Normalized copy
+		soa_vector normalized(const parallel::policy pol = parallel::policy::seq) const {
+			soa_vector res = sameSize();
+			const auto a = pointers();
+			const auto r = res.pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaNormalize<T, N>));
+			forRange(pol, [&](const size_t i, const size_t e) {
+				kernel(a.offset(i).p, r.offset(i).p, e - i);
+			});
+			return res;
+		}
+
+		// Linear interpolation of every element pair
+		void lerp(const soa_vector &v, const T t, soa_vector &out,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			assert(v.size() == size());
+			if (&out != this && &out != &v) out.resize(size());
+			const auto a = pointers(), b = v.pointers();
+			const auto r = out.pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaLerp<T, N>));
+			forRange(pol, [&](const size_t i, const size_t e) {
+				kernel(a.offset(i).p, b.offset(i).p, t, r.offset(i).p, e - i);
+			});
+		}
+
+		soa_vector lerp(const soa_vector &v, const T t,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			soa_vector res = sameSize();
+			lerp(v, t, res, pol);
+			return res;
+		}
+
+		// Component-wise maximum of every element pair
+		void maxV(const soa_vector &v, soa_vector &out,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			minMax<true>(v, out, pol);
+		}
+
+		soa_vector maxV(const soa_vector &v, const parallel::policy pol = parallel::policy::seq) const {
+			soa_vector res = sameSize();
+			maxV(v, res, pol);
+			return res;
+		}
+
+		// Component-wise minimum of every element pair
+		void minV(const soa_vector &v, soa_vector &out,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			minMax<false>(v, out, pol);
+		}
+
+		soa_vector minV(const soa_vector &v, const parallel::policy pol = parallel::policy::seq) const {
+			soa_vector res = sameSize();
+			minV(v, res, pol);
+			return res;
+		}
+
+		// Cross products of every element pair (3D only)
+		void cross(const soa_vector &v, soa_vector &out,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			static_assert(N == 3, "Cross product is defined for 3D vectors only");
+			assert(v.size() == size());
+			if (&out != this && &out != &v) out.resize(size());
+			const auto a = pointers(), b = v.pointers();
+			const auto r = out.pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaCross<T>));
+			forRange(pol, [&](const size_t i, const size_t e) {
+				kernel(a.offset(i).p, b.offset(i).p, r.offset(i).p, e - i);
+			});
+		}
+
+		soa_vector cross(const soa_vector &v, const parallel::policy pol = parallel::policy::seq) const {
+			soa_vector res = sameSize();
+			cross(v, res, pol);
+			return res;
+		}
+
+	private:
+		stream_type streams[N];
+
+		// Component pointers of all streams
+		template <typename P>
+		struct stream_ptrs {
+			P *p[N];
+
+			// Pointers to element i
+			stream_ptrs offset(const size_t i) const noexcept {
+				stream_ptrs s;
+				for (size_t k = 0; k < N; ++k) s.p[k] = p[k] + i;
+				return s;
+			}
+		};
+
+		stream_ptrs<const T> pointers() const noexcept {
+			stream_ptrs<const T> s;
+			for (size_t k = 0; k < N; ++k) s.p[k] = streams[k].data();
+			return s;
+		}
+
+		stream_ptrs<T> pointers() noexcept {
+			stream_ptrs<T> s;
+			for (size_t k = 0; k < N; ++k) s.p[k] = streams[k].data();
+			return s;
+		}
+
+		// Run fn(b, e) over all elements, split across the default thread pool under policy::par
+		template <typename F>
+		void forRange(const parallel::policy pol, F &&fn) const {
+			if (pol == parallel::policy::seq)
+				fn(size_t(0), size());
+			else
+				parallel::parallel_for(0, size(), SOA_GRAIN, fn);
+		}
+
+		template <bool Max>
+		void minMax(const soa_vector &v, soa_vector &out, const parallel::policy pol) const {
+			assert(v.size() == size());
+			if (&out != this && &out != &v) out.resize(size());
+			const auto a = pointers(), b = v.pointers();
+			const auto r = out.pointers();
+			const auto kernel = simd::select(VTX_SIMD_FN(soaMinMax<T, N, Max>));
+			forRange(pol, [&](const size_t i, const size_t e) {
+				kernel(a.offset(i).p, b.offset(i).p, r.offset(i).p, e - i);
+			});
+		}
+
+		// Uninitialized result of the same size
+		soa_vector sameSize() const {
+			soa_vector res;
+			for (size_t k = 0; k < N; ++k) res.streams[k].resize(size());
+			return res;
+		}
+	};
+
+	// Set other names for SoA containers
+	template <typename T>
+	using soa2 = soa_vector<T, 2>;
+	template <typename T>
+	using soa3 = soa_vector<T, 3>;
+	template <typename T>
+	using soa4 = soa_vector<T, 4>;
+}  // namespace vtx
+
+#endif //VECTRIX_SOA_VECTOR_H
@@ -0,0 +1,147 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_TRANSFORM_H
+#define VECTRIX_TRANSFORM_H
+
+#include <atomic>
+#include <mutex>
+
+#include "matrix4x4.h"
+#include "vector3.h"
+
+#include "vectrix/parallel/parallel_for.h"
+
+namespace vtx {
+	// matrix<T, 4, 4> with its kind and a lazily computed cache of the inverse, the normal matrix
+	// and the determinant sign. The cache is built once on the first query after a change and
+	// published with release/acquire ordering, so any number of threads may query a transform
+	// that is not being modified. Modification (set, *=, assignment) needs exclusive access.
+	template <typename T>
+	class transform {
+	public:
+		using matrix_type = matrix<T, 4, 4>;
+
+		// Identity transform
+		transform() noexcept : m(matrix_type::identity()), k(transform_kind::rigid) {}
+
+		// Matrix of the known kind (see matrix<T, 4, 4>::kind())
+		explicit transform(
+		    const matrix_type &matr, const transform_kind kind = transform_kind::general) noexcept
+		    : m(matr), k(kind) {}
+
+		transform(const transform &t) noexcept : m(t.m), k(t.k) { copyCache(t); }
+
+		transform &operator=(const transform &t) noexcept {
+			if (this != &t) {
+				m = t.m;
+				k = t.k;
+				copyCache(t);
+			}
+			return *this;
+		}
+
+		// Replace the matrix (invalidates the cache)
+		void set(const matrix_type &matr, const transform_kind kind = transform_kind::general) noexcept {
+			m = matr;
+			k = kind;
+			cached.store(false, std::memory_order_relaxed);
+		}
+
+		// Matrix and its kind
+		const matrix_type &get() const noexcept { return m; }
+		transform_kind kind() const noexcept { return k; }
+
+		// True when the next query recomputes the cache
+		bool dirty() const noexcept { return !cached.load(std::memory_order_acquire); }
+
+		// Composition: 'this' first, then t. The result is as general as the more general operand
+		transform operator*(const transform &t) const noexcept {
+			return transform(m * t.m, k < t.k ? k : t.k);
+		}
+
+		transform &operator*=(const transform &t) noexcept {
+			set(m * t.m, k < t.k ? k : t.k);
+			return *this;
+		}
+
+		// Cached inverse matrix (identity for a singular matrix, as matrix<T, 4, 4>::inverse())
+		const matrix_type &inverse() const {
+			update();
+			return inv;
+		}
+
+		// Cached normal matrix (inverse transpose, see matrix<T, 4, 4>::normalMatrix())
+		const matrix_type &normalMatrix() const {
+			update();
+			return normal;
+		}
+
+		// Cached determinant sign: 1, -1 (mirroring, flips triangle winding) or 0 (singular)
+		int determinantSign() const {
+			update();
+			return sign;
+		}
+
+		// Transforms of single elements (see matrix<T, 4, 4>)
+		vector<T, 3> transformPoint(const vector<T, 3> &v) const noexcept { return m.transformPoint(v); }
+		vector<T, 3> transformVector(const vector<T, 3> &v) const noexcept { return m.transformVector(v); }
+		vector<T, 3> transformNormal(const vector<T, 3> &v) const {
+			return normalMatrix().transformVector(v);
+		}
+
+		// Transforms by the cached inverse (world to local, e.g. picking rays)
+		vector<T, 3> inverseTransformPoint(const vector<T, 3> &v) const {
+			return inverse().transformPoint(v);
+		}
+		vector<T, 3> inverseTransformVector(const vector<T, 3> &v) const {
+			return inverse().transformVector(v);
+		}
+
+		// Batch normal transforms by the cached normal matrix (in == out allowed)
+		void transformNormal(const T *in, const size_t inStride, T *out, const size_t outStride,
+		    const size_t count, const parallel::policy pol = parallel::policy::seq) const {
+			normalMatrix().transformVector(in, inStride, out, outStride, count, pol);
+		}
+
+		void transformNormal(const vector<T, 3> *in, vector<T, 3> *out, const size_t count,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			normalMatrix().transformVector(in, out, count, pol);
+		}
+
+	private:
+		matrix_type m;
+		transform_kind k;
+
+		// Cache, valid when 'cached' is set (written under cacheMutex, published by the release store)
+		mutable std::atomic<bool> cached{false};
+		mutable std::mutex cacheMutex;
+		mutable matrix_type inv, normal;
+		mutable int sign = 0;
+
+		void update() const {
+			if (cached.load(std::memory_order_acquire)) return;
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			if (cached.load(std::memory_order_relaxed)) return;
+			inv = m.inverse(k);
+			normal = k == transform_kind::rigid ? m.normalMatrix(k) : inv.transpose();
+			const T det = m.determinant();
+			sign = det > T(0) ? 1 : det < T(0) ? -1 : 0;
+			cached.store(true, std::memory_order_release);
+		}
+
+		void copyCache(const transform &t) noexcept {
+			const bool valid = t.cached.load(std::memory_order_acquire);
+			if (valid) {
+				inv = t.inv;
+				normal = t.normal;
+				sign = t.sign;
+			}
+			cached.store(valid, std::memory_order_relaxed);
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_TRANSFORM_H
@@ -6,6 +6,7 @@
 #define VECTRIX_VECTOR3_H
 
 #include "vectrix/math/common.h"
+#include "vectrix/math/fast.h"
 
 #include "base_vector.h"
 
@@ -273,20 +274,12 @@ namespace vtx
 
         // Normalized vector
         constexpr vector normalized( ) const noexcept {
-            T len = length();
-#ifdef _DEBUG
-            assert(len != T(0));
-#endif // _DEBUG
-            return *this / len;
+            return vtx::math::policy::normalized(*this, squaredLength());
         }
 
         // Normalize current vector
         constexpr vector& normalize( ) noexcept {
-            T len = length();
-#ifdef _DEBUG
-            assert(len != T(0));
-#endif // _DEBUG
-            return *this /= len;
+            return *this = vtx::math::policy::normalized(*this, squaredLength());
         }
 
         // Maximal component
@@ -5,9 +5,11 @@
 #ifndef VECTRIX_VECTOR4_H
 #define VECTRIX_VECTOR4_H
 
-#include "vectrix/math/common.h"
+#include "vectrix/math/functions.h"
+#include "vectrix/math/fast.h"
 
 #include "base_vector.h"
+#include "vectrix/simd/dispatch.h"
 
 // vtx namespace
 namespace vtx
@@ -131,6 +133,8 @@ namespace vtx
 
         // Addition operator
         constexpr vector operator+( const vector &v ) const noexcept {
+            if (simd::vec4<T>::enabled && !VTX_IS_CONSTANT_EVALUATED())
+                return simd::vec4<T>::add(*this, v);
             return vector{
                     X + v.X,
                     Y + v.Y,
@@ -150,6 +154,8 @@ namespace vtx
 
         // Subtraction operator
         constexpr vector operator-( const vector &v ) const noexcept {
+            if (simd::vec4<T>::enabled && !VTX_IS_CONSTANT_EVALUATED())
+                return simd::vec4<T>::sub(*this, v);
             return vector{
                     X - v.X,
                     Y - v.Y,
@@ -169,6 +175,8 @@ namespace vtx
 
         // Multiplication operator
         constexpr vector operator*( const vector &v ) const noexcept {
+            if (simd::vec4<T>::enabled && !VTX_IS_CONSTANT_EVALUATED())
+                return simd::vec4<T>::mul(*this, v);
             return {
                     X * v.X,
                     Y * v.Y,
@@ -188,6 +196,8 @@ namespace vtx
 
         // Multiplication operator
         constexpr vector operator*( const T n ) const noexcept {
+            if (simd::vec4<T>::enabled && !VTX_IS_CONSTANT_EVALUATED())
+                return simd::vec4<T>::scale(*this, n);
             return vector{
                     X * n,
                     Y * n,
@@ -245,6 +255,8 @@ namespace vtx
 
         // Dot product function
         constexpr T dot( const vector& v ) const noexcept {
+            if (simd::vec4<T>::enabled && !VTX_IS_CONSTANT_EVALUATED())
+                return simd::vec4<T>::dot(*this, v);
             return X * v.X + Y * v.Y + Z * v.Z + W * v.W;
         }
 
@@ -265,20 +277,12 @@ namespace vtx
 
         // Normalized vector
         constexpr vector normalized( ) const noexcept {
-            T len = length();
-#ifdef _DEBUG
-            assert(len != T(0));
-#endif // _DEBUG
-            return *this / len;
+            return vtx::math::policy::normalized(*this, squaredLength());
         }
 
         // Normalize current vector
         constexpr vector& normalize( ) noexcept {
-            T len = length();
-#ifdef _DEBUG
-            assert(len != T(0));
-#endif // _DEBUG
-            return *this /= len;
+            return *this = vtx::math::policy::normalized(*this, squaredLength());
         }
 
         // Maximal component
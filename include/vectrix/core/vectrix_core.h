@@ -12,13 +12,38 @@
 #include "matrix3x3.h"
 #include "matrix4x4.h"
 
+// Matrix decompositions
+#include "lu.h"
+
 // Vector classes
 #include "base_vector.h"
 #include "vector2.h"
 #include "vector3.h"
 #include "vector4.h"
 
+// Structure-of-arrays containers
+#include "soa_vector.h"
+#include "soa_matrix.h"
+
+// Runtime-sized matrix and vector
+#include "dmatrix.h"
+
 // Quat
 #include "quaternion.h"
 
+// Structure-of-arrays quaternions
+#include "soa_quaternion.h"
+
+// Compact 3x4 affine transform
+#include "affine3.h"
+
+// Dual quaternion (rigid transform)
+#include "dual_quaternion.h"
+
+// Transform with cached inverse and normal matrix
+#include "transform.h"
+
+// Batch skinning of meshes
+#include "skinning.h"
+
 #endif //VECTRIX_VECTRIX_CORE_H
@@ -0,0 +1,128 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_AABB_H
+#define VECTRIX_AABB_H
+
+#include <limits>
+
+#include "vectrix/core/matrix4x4.h"
+#include "vectrix/core/vector3.h"
+
+namespace vtx {
+	// Axis-aligned bounding box [min, max]. The default box is empty (min above max), so points
+	// and boxes can be merged into it; an empty box contains and intersects nothing.
+	// 6 packed elements (min, then max): arrays of boxes are culled as is (see frustum<T>).
+	template <typename T>
+	class aabb {
+	public:
+		vector<T, 3> min, max;
+
+		// Empty box
+		constexpr aabb() noexcept
+		    : min(std::numeric_limits<T>::max()), max(std::numeric_limits<T>::lowest()) {}
+
+		// Corners (min <= max componentwise)
+		constexpr aabb(const vector<T, 3> &lo, const vector<T, 3> &hi) noexcept : min(lo), max(hi) {}
+
+		// Box of points
+		aabb(const vector<T, 3> *points, const size_t count) noexcept : aabb() {
+			for (size_t i = 0; i < count; ++i) expand(points[i]);
+		}
+
+		// Box of center and half extents
+		static constexpr aabb fromCenter(const vector<T, 3> &center, const vector<T, 3> &extent) noexcept {
+			return aabb(center - extent, center + extent);
+		}
+
+		// Boxes equality operator
+		constexpr bool operator==(const aabb &b) const noexcept { return min == b.min && max == b.max; }
+
+		// Boxes inequality operator
+		constexpr bool operator!=(const aabb &b) const noexcept { return !(*this == b); }
+
+		// True for the box of no points
+		constexpr bool empty() const noexcept {
+			return min[0] > max[0] || min[1] > max[1] || min[2] > max[2];
+		}
+
+		constexpr vector<T, 3> center() const noexcept { return (min + max) * T(0.5); }
+
+		// Half size
+		constexpr vector<T, 3> extent() const noexcept { return (max - min) * T(0.5); }
+
+		constexpr vector<T, 3> size() const noexcept { return max - min; }
+
+		constexpr T surfaceArea() const noexcept {
+			if (empty()) return T(0);
+			const vector<T, 3> s = size();
+			return 2 * (s[0] * s[1] + s[1] * s[2] + s[2] * s[0]);
+		}
+
+		constexpr T volume() const noexcept {
+			if (empty()) return T(0);
+			const vector<T, 3> s = size();
+			return s[0] * s[1] * s[2];
+		}
+
+		// Grow to contain point or box
+		constexpr aabb &expand(const vector<T, 3> &p) noexcept {
+			min = min.minV(p);
+			max = max.maxV(p);
+			return *this;
+		}
+
+		constexpr aabb &expand(const aabb &b) noexcept {
+			min = min.minV(b.min);
+			max = max.maxV(b.max);
+			return *this;
+		}
+
+		constexpr aabb merged(const aabb &b) const noexcept { return aabb(min.minV(b.min), max.maxV(b.max)); }
+
+		// Overlap of two boxes (empty if they are disjoint)
+		constexpr aabb intersection(const aabb &b) const noexcept {
+			return aabb(min.maxV(b.min), max.minV(b.max));
+		}
+
+		constexpr bool contains(const vector<T, 3> &p) const noexcept {
+			return p[0] >= min[0] && p[0] <= max[0] && p[1] >= min[1] && p[1] <= max[1] && p[2] >= min[2] &&
+			       p[2] <= max[2];
+		}
+
+		constexpr bool contains(const aabb &b) const noexcept {
+			return !b.empty() && contains(b.min) && contains(b.max);
+		}
+
+		// Boxes touching on a face intersect
+		constexpr bool intersects(const aabb &b) const noexcept {
+			return min[0] <= b.max[0] && b.min[0] <= max[0] && min[1] <= b.max[1] && b.min[1] <= max[1] &&
+			       min[2] <= b.max[2] && b.min[2] <= max[2];
+		}
+
+		// Point of the box nearest to p
+		constexpr vector<T, 3> closestPoint(const vector<T, 3> &p) const noexcept {
+			return p.maxV(min).minV(max);
+		}
+
+		constexpr T squaredDistance(const vector<T, 3> &p) const noexcept {
+			return (closestPoint(p) - p).squaredLength();
+		}
+
+		// Box of the affine transformed box (row vectors, translation in row 3): the center is
+		// transformed, the half extents go through the absolute values of the 3x3 part
+		constexpr aabb transformed(const matrix<T, 4, 4> &m) const noexcept {
+			if (empty()) return *this;
+			const vector<T, 3> c = center(), e = extent();
+			vector<T, 3> nc(T(0)), ne(T(0));
+			for (size_t j = 0; j < 3; ++j) {
+				nc[j] = c[0] * m(0, j) + c[1] * m(1, j) + c[2] * m(2, j) + m(3, j);
+				ne[j] = e[0] * math::abs(m(0, j)) + e[1] * math::abs(m(1, j)) + e[2] * math::abs(m(2, j));
+			}
+			return aabb(nc - ne, nc + ne);
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_AABB_H
@@ -0,0 +1,408 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_BVH_H
+#define VECTRIX_BVH_H
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "aabb.h"
+#include "ray.h"
+
+#include "vectrix/core/vector3.h"
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/simd/dispatch.h"
+
+namespace vtx {
+	// Node of a flattened bvh<T>, depth-first order: the left child of an interior node follows it
+	template <typename T>
+	struct bvh_node {
+		// Traversal stack size (above any tree depth)
+		static constexpr size_t STACK = 64;
+
+		aabb<T> bounds;
+		std::uint32_t offset;  // leaf: first triangle, interior node: right child
+		std::uint16_t count;   // triangles of a leaf, 0 for interior nodes
+		std::uint16_t axis;    // split axis of an interior node
+
+		constexpr bool leaf() const noexcept { return count != 0; }
+	};
+
+	// Triangle of a bvh<T> in leaf order: vertex and edges of the Moller-Trumbore test
+	template <typename T>
+	struct bvh_triangle {
+		vector<T, 3> v0, e1, e2;
+	};
+
+	// Closest hit of a ray. t limits the search on input; a miss leaves the hit as it was
+	template <typename T>
+	struct ray_hit {
+		static constexpr std::uint32_t NO_HIT = std::numeric_limits<std::uint32_t>::max();
+
+		T t = std::numeric_limits<T>::infinity();
+		T u = T(0), v = T(0);                  // barycentrics of triangle vertices 1 and 2
+		std::uint32_t primitive = NO_HIT;      // triangle index of the mesh
+
+		constexpr bool hit() const noexcept { return primitive != NO_HIT; }
+	};
+}  // namespace vtx
+
+#define VTX_SIMD_KERNELS "vectrix/geometry/detail/bvh_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
+
+namespace vtx {
+	// Bounding volume hierarchy over a triangle mesh for ray queries.
+	// Built top-down with the surface area heuristic over BINS centroid bins per axis; below
+	// SAH_DEPTH (or for coincident centroids) nodes are split at the median, so the depth stays
+	// under STACK. Under policy::par large nodes are binned across the thread pool and their
+	// subtrees built in parallel; the result does not depend on the thread count.
+	// Nodes are flattened depth-first into 32 (float) bytes each, triangles are stored in leaf
+	// order with precomputed edges.
+	// Rays are traversed one at a time or in packets of one SIMD register of rays (4, 8 or 16
+	// lanes by backend): a packet visits a node when any of its rays hits the node bounds, so
+	// packets pay off for coherent rays (neighbouring pixels, shadow rays to one light).
+	template <typename T>
+	class bvh {
+	public:
+		// Centroid bins per axis of the SAH split search
+		static constexpr size_t BINS = 16;
+
+		// Leaf size limit; smaller leaves are kept whenever the SAH prefers them
+		static constexpr size_t MAX_LEAF = 8;
+
+		// Depth of the SAH splits and traversal stack size
+		static constexpr size_t SAH_DEPTH = 32, STACK = bvh_node<T>::STACK;
+
+		// Triangles of a node above which its subtrees are built in parallel / it is binned in parallel
+		static constexpr size_t BUILD_GRAIN = 4096, BIN_GRAIN = 65536;
+
+		// Rays per task when a batch query is split across threads
+		static constexpr size_t RAY_GRAIN = 256;
+
+		// Empty hierarchy (no hits)
+		bvh() = default;
+
+		// Hierarchy of a mesh: triangle k is vertices[indices[3k]], [3k + 1], [3k + 2], or vertices
+		// 3k, 3k + 1, 3k + 2 without indices (triangle soup)
+		bvh(const vector<T, 3> *vertices, const std::uint32_t *indices, const size_t triangles,
+		    const parallel::policy pol = parallel::policy::seq) {
+			build(vertices, indices, triangles, pol);
+		}
+
+		void build(const vector<T, 3> *vertices, const std::uint32_t *indices, const size_t triangles,
+		    const parallel::policy pol = parallel::policy::seq) {
+			assert(triangles < size_t(ray_hit<T>::NO_HIT));
+			nodeList.clear();
+			triangleList.clear();
+			order.resize(triangles);
+			if (triangles == 0) return;
+
+			builder b(vertices, indices, triangles, pol);
+			const std::uint32_t root = b.build(0, triangles, 0);
+			for (size_t k = 0; k < triangles; ++k) order[k] = b.prims[k];
+
+			nodeList.reserve(b.count.load());
+			flatten(b, root);
+
+			triangleList.resize(triangles);
+			for (size_t k = 0; k < triangles; ++k) {
+				const size_t p = order[k] * 3;
+				const vector<T, 3> &a = vertices[indices ? indices[p] : p];
+				const vector<T, 3> &v1 = vertices[indices ? indices[p + 1] : p + 1];
+				const vector<T, 3> &v2 = vertices[indices ? indices[p + 2] : p + 2];
+				triangleList[k] = bvh_triangle<T>{a, v1 - a, v2 - a};
+			}
+		}
+
+		bool empty() const noexcept { return nodeList.empty(); }
+
+		// Triangles of the mesh
+		size_t size() const noexcept { return triangleList.size(); }
+
+		// Bounds of the mesh
+		aabb<T> bounds() const noexcept { return empty() ? aabb<T>() : nodeList[0].bounds; }
+
+		// Flattened nodes (root first), triangles in leaf order and their mesh indices
+		const std::vector<bvh_node<T>> &nodes() const noexcept { return nodeList; }
+		const std::vector<bvh_triangle<T>> &triangles() const noexcept { return triangleList; }
+		const std::vector<std::uint32_t> &primitives() const noexcept { return order; }
+
+		// Closest hit of one ray, nearer than hit.t; true if hit was updated
+		bool intersect(const ray<T> &r, ray_hit<T> &hit) const noexcept {
+			if (empty()) return false;
+			const vector<T, 3> inv(T(1) / r.direction[0], T(1) / r.direction[1], T(1) / r.direction[2]);
+			const bool neg[3] = {r.direction[0] < T(0), r.direction[1] < T(0), r.direction[2] < T(0)};
+			std::uint32_t stack[STACK], best = ray_hit<T>::NO_HIT;
+			size_t sp = 0;
+			std::uint32_t node = 0;
+			for (;;) {
+				const bvh_node<T> &n = nodeList[node];
+				if (slab(n.bounds, r.origin, inv, hit.t)) {
+					if (!n.leaf()) {
+						// Nearer child first along the split axis
+						const bool rightFirst = neg[n.axis];
+						stack[sp++] = rightFirst ? node + 1 : n.offset;
+						node = rightFirst ? n.offset : node + 1;
+						continue;
+					}
+					for (std::uint32_t k = n.offset; k < n.offset + n.count; ++k) {
+						const bvh_triangle<T> &tri = triangleList[k];
+						T t, u, v;
+						if (r.intersectEdges(tri.v0, tri.e1, tri.e2, t, u, v) && t < hit.t) {
+							hit.t = t;
+							hit.u = u;
+							hit.v = v;
+							best = k;
+						}
+					}
+				}
+				if (sp == 0) break;
+				node = stack[--sp];
+			}
+			if (best == ray_hit<T>::NO_HIT) return false;
+			hit.primitive = order[best];
+			return true;
+		}
+
+		// Closest hits of a batch of rays in SIMD packets of consecutive rays
+		void intersect(const ray<T> *rays, ray_hit<T> *hits, const size_t count,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			static_assert(sizeof(ray<T>) == 6 * sizeof(T), "ray<T> must be 6 packed elements");
+			if (empty()) return;
+			const auto kernel = simd::select(VTX_SIMD_FN(bvhIntersect<T>));
+			auto chunk = [&](const size_t b, const size_t e) {
+				kernel(nodeList.data(), triangleList.data(), order.data(), rays + b, hits + b, e - b);
+			};
+			if (pol == parallel::policy::seq)
+				chunk(0, count);
+			else
+				parallel::parallel_for(0, count, RAY_GRAIN, chunk);
+		}
+
+	private:
+		std::vector<bvh_node<T>> nodeList;
+		std::vector<bvh_triangle<T>> triangleList;
+		std::vector<std::uint32_t> order;
+
+		// Ray interval [0, tMax] against the box, inverse direction precomputed
+		static bool slab(
+		    const aabb<T> &b, const vector<T, 3> &o, const vector<T, 3> &inv, const T tMax) noexcept {
+			T t0 = T(0), t1 = tMax;
+			for (size_t c = 0; c < 3; ++c) {
+				T n = (b.min[c] - o[c]) * inv[c], f = (b.max[c] - o[c]) * inv[c];
+				if (n > f) {
+					const T s = n;
+					n = f;
+					f = s;
+				}
+				t0 = n > t0 ? n : t0;
+				t1 = f < t1 ? f : t1;
+			}
+			return t0 <= t1;
+		}
+
+		// Node of the build tree: children for interior nodes, a range of prims for leaves
+		struct build_node {
+			aabb<T> bounds;
+			std::uint32_t left, right, first, count, axis;
+		};
+
+		// Bounds and centroid bounds of a range of triangles
+		struct range_bounds {
+			aabb<T> bounds, centroids;
+
+			range_bounds merged(const range_bounds &r) const noexcept {
+				return range_bounds{bounds.merged(r.bounds), centroids.merged(r.centroids)};
+			}
+		};
+
+		// Bounds and triangle counts of the centroid bins of every axis
+		struct bin_set {
+			aabb<T> bounds[3][BINS];
+			std::uint32_t count[3][BINS];
+
+			bin_set merged(const bin_set &s) const noexcept {
+				bin_set r;
+				for (size_t a = 0; a < 3; ++a)
+					for (size_t k = 0; k < BINS; ++k) {
+						r.bounds[a][k] = bounds[a][k].merged(s.bounds[a][k]);
+						r.count[a][k] = count[a][k] + s.count[a][k];
+					}
+				return r;
+			}
+		};
+
+		// Top-down SAH builder over the triangle bounds; nodes are allocated atomically, so
+		// subtrees build concurrently, and flattened depth-first afterwards
+		struct builder {
+			std::vector<aabb<T>> boxes;
+			std::vector<vector<T, 3>> centers;
+			std::vector<std::uint32_t> prims;
+			std::vector<build_node> nodes;
+			std::atomic<std::uint32_t> count{0};
+			parallel::policy pol;
+
+			builder(const vector<T, 3> *vertices, const std::uint32_t *indices, const size_t triangles,
+			    const parallel::policy p)
+			    : boxes(triangles), centers(triangles), prims(triangles), nodes(2 * triangles), pol(p) {
+				auto prepare = [&](const size_t b, const size_t e) {
+					for (size_t k = b; k < e; ++k) {
+						const size_t i = 3 * k;
+						aabb<T> box;
+						for (size_t v = 0; v < 3; ++v) box.expand(vertices[indices ? indices[i + v] : i + v]);
+						boxes[k] = box;
+						centers[k] = box.center();
+						prims[k] = std::uint32_t(k);
+					}
+				};
+				if (pol == parallel::policy::seq)
+					prepare(0, triangles);
+				else
+					parallel::parallel_for(0, triangles, BIN_GRAIN, prepare);
+			}
+
+			range_bounds measure(const size_t b, const size_t e) const {
+				auto map = [&](const size_t cb, const size_t ce) {
+					range_bounds r;
+					for (size_t k = cb; k < ce; ++k) {
+						r.bounds.expand(boxes[prims[k]]);
+						r.centroids.expand(centers[prims[k]]);
+					}
+					return r;
+				};
+				if (pol == parallel::policy::seq || e - b <= BIN_GRAIN) return map(b, e);
+				return parallel::parallel_reduce(b, e, BIN_GRAIN, range_bounds(), map,
+				    [](const range_bounds &x, const range_bounds &y) { return x.merged(y); });
+			}
+
+			// Bin of a centroid coordinate
+			static size_t bin(const T c, const T lo, const T scale) noexcept {
+				const T k = (c - lo) * scale;
+				return k <= T(0) ? 0 : k >= T(BINS - 1) ? BINS - 1 : size_t(k);
+			}
+
+			bin_set binning(const size_t b, const size_t e, const aabb<T> &cb) const {
+				const vector<T, 3> lo = cb.min, ext = cb.size();
+				auto map = [&](const size_t mb, const size_t me) {
+					bin_set s;
+					for (size_t a = 0; a < 3; ++a)
+						for (size_t k = 0; k < BINS; ++k) s.count[a][k] = 0;
+					for (size_t k = mb; k < me; ++k) {
+						const std::uint32_t p = prims[k];
+						for (size_t a = 0; a < 3; ++a) {
+							if (ext[a] <= T(0)) continue;
+							const size_t i = bin(centers[p][a], lo[a], T(BINS) / ext[a]);
+							s.bounds[a][i].expand(boxes[p]);
+							++s.count[a][i];
+						}
+					}
+					return s;
+				};
+				if (pol == parallel::policy::seq || e - b <= BIN_GRAIN) return map(b, e);
+				return parallel::parallel_reduce(b, e, BIN_GRAIN, map(b, b), map,
+				    [](const bin_set &x, const bin_set &y) { return x.merged(y); });
+			}
+
+			std::uint32_t build(const size_t b, const size_t e, const size_t depth) {
+				const std::uint32_t id = count.fetch_add(1, std::memory_order_relaxed);
+				const range_bounds rb = measure(b, e);
+				build_node &node = nodes[id];
+				node.bounds = rb.bounds;
+				node.first = std::uint32_t(b);
+				node.count = std::uint32_t(e - b);
+
+				const size_t n = e - b;
+				const vector<T, 3> ext = rb.centroids.size();
+				size_t axis = ext[0] >= ext[1] && ext[0] >= ext[2] ? 0 : ext[1] >= ext[2] ? 1 : 2;
+				size_t mid = b;
+				if (n == 1) return id;
+
+				if (depth < SAH_DEPTH && ext[axis] > T(0)) {
+					// Best split between bins over every axis: 1 + (Nl Al + Nr Ar) / A against n
+					const bin_set s = binning(b, e, rb.centroids);
+					const T area = rb.bounds.surfaceArea();
+					T bestCost = std::numeric_limits<T>::max();
+					size_t bestSplit = 0;
+					for (size_t a = 0; a < 3; ++a) {
+						if (ext[a] <= T(0)) continue;
+						T rightArea[BINS];
+						std::uint32_t rightCount[BINS];
+						aabb<T> acc;
+						std::uint32_t cnt = 0;
+						for (size_t k = BINS - 1; k > 0; --k) {
+							acc.expand(s.bounds[a][k]);
+							cnt += s.count[a][k];
+							rightArea[k] = acc.surfaceArea();
+							rightCount[k] = cnt;
+						}
+						acc = aabb<T>();
+						cnt = 0;
+						for (size_t k = 0; k + 1 < BINS; ++k) {
+							acc.expand(s.bounds[a][k]);
+							cnt += s.count[a][k];
+							if (cnt == 0 || rightCount[k + 1] == 0) continue;
+							const T cost = T(1) + (T(cnt) * acc.surfaceArea() +
+							                       T(rightCount[k + 1]) * rightArea[k + 1]) / area;
+							if (cost < bestCost) {
+								bestCost = cost;
+								axis = a;
+								bestSplit = k;
+							}
+						}
+					}
+
+					if (n <= MAX_LEAF && bestCost >= T(n)) return id;
+					const T lo = rb.centroids.min[axis], scale = T(BINS) / ext[axis];
+					const auto split = std::partition(prims.begin() + b, prims.begin() + e,
+					    [&](const std::uint32_t p) { return bin(centers[p][axis], lo, scale) <= bestSplit; });
+					mid = size_t(split - prims.begin());
+				}
+
+				if (mid == b || mid == e) {
+					// Median split (deep nodes, coincident centroids)
+					if (n <= MAX_LEAF) return id;
+					mid = b + n / 2;
+					std::nth_element(prims.begin() + b, prims.begin() + mid, prims.begin() + e,
+					    [&](const std::uint32_t x, const std::uint32_t y) {
+						    return centers[x][axis] < centers[y][axis];
+					    });
+				}
+
+				node.axis = std::uint32_t(axis);
+				node.count = 0;
+				if (pol == parallel::policy::par && n > BUILD_GRAIN) {
+					std::uint32_t *child[2] = {&node.left, &node.right};
+					const size_t bounds[3] = {b, mid, e};
+					parallel::parallel_for(0, 2, 1, [&](const size_t cb, const size_t ce) {
+						for (size_t c = cb; c < ce; ++c)
+							*child[c] = build(bounds[c], bounds[c + 1], depth + 1);
+					});
+				} else {
+					node.left = build(b, mid, depth + 1);
+					node.right = build(mid, e, depth + 1);
+				}
+				return id;
+			}
+		};
+
+		// Depth-first copy of the build tree
+		void flatten(const builder &b, const std::uint32_t id) {
+			const build_node &n = b.nodes[id];
+			const size_t index = nodeList.size();
+			nodeList.push_back(bvh_node<T>{n.bounds, n.first, std::uint16_t(n.count), std::uint16_t(0)});
+			if (n.count != 0) return;
+			nodeList[index].axis = std::uint16_t(n.axis);
+			flatten(b, n.left);
+			nodeList[index].offset = std::uint32_t(nodeList.size());
+			flatten(b, n.right);
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_BVH_H
@@ -0,0 +1,119 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Packet traversal kernel of vtx::bvh.
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// One ray per lane: full packets with batch_for<T>::type, the remainder with scalar::batch<T>
+// (single-ray traversal). A packet descends into a node when any lane hits its bounds (nearer
+// child first by the direction of lane 0) and tests every triangle of a leaf against all lanes
+// with a SIMD Moller-Trumbore step. Rays and hits are read and written through lane buffers.
+// No include guard on purpose.
+
+namespace bvh_detail {
+	template <typename B>
+	VTX_FORCEINLINE void packetStep(const ::vtx::bvh_node<typename B::value_type> *nodes,
+	    const ::vtx::bvh_triangle<typename B::value_type> *tris, const std::uint32_t *order,
+	    const ::vtx::ray<typename B::value_type> *rays, ::vtx::ray_hit<typename B::value_type> *hits,
+	    const size_t i) noexcept {
+		using T = typename B::value_type;
+		constexpr std::uint32_t NO_HIT = ::vtx::ray_hit<T>::NO_HIT;
+		alignas(64) T lanes[9][B::size];
+		alignas(64) std::uint32_t prim[B::size];
+		for (size_t l = 0; l < B::size; ++l) {
+			const ::vtx::ray<T> &r = rays[i + l];
+			for (size_t c = 0; c < 3; ++c) {
+				lanes[c][l] = r.origin[c];
+				lanes[3 + c][l] = r.direction[c];
+			}
+			lanes[6][l] = hits[i + l].t;
+			prim[l] = NO_HIT;
+		}
+
+		B o[3], d[3], inv[3];
+		for (size_t c = 0; c < 3; ++c) {
+			o[c] = B::load(lanes[c]);
+			d[c] = B::load(lanes[3 + c]);
+			inv[c] = B::set1(T(1)) / d[c];
+		}
+		B best = B::load(lanes[6]), bu = B::zero(), bv = B::zero();
+		const bool neg[3] = {lanes[3][0] < T(0), lanes[4][0] < T(0), lanes[5][0] < T(0)};
+		const B zero = B::zero(), one = B::set1(T(1));
+
+		std::uint32_t stack[::vtx::bvh_node<T>::STACK];
+		size_t sp = 0;
+		std::uint32_t node = 0;
+		for (;;) {
+			const ::vtx::bvh_node<T> &n = nodes[node];
+			B t0 = zero, t1 = best;
+			for (size_t c = 0; c < 3; ++c) {
+				const B a = (B::set1(n.bounds.min[c]) - o[c]) * inv[c];
+				const B f = (B::set1(n.bounds.max[c]) - o[c]) * inv[c];
+				t0 = B::max(t0, B::min(a, f));
+				t1 = B::min(t1, B::max(a, f));
+			}
+			if ((t0 <= t1).any()) {
+				if (!n.leaf()) {
+					const bool rightFirst = neg[n.axis];
+					stack[sp++] = rightFirst ? node + 1 : n.offset;
+					node = rightFirst ? n.offset : node + 1;
+					continue;
+				}
+				for (std::uint32_t k = n.offset; k < n.offset + n.count; ++k) {
+					const ::vtx::bvh_triangle<T> &tri = tris[k];
+					B e1[3], e2[3], s[3];
+					for (size_t c = 0; c < 3; ++c) {
+						e1[c] = B::set1(tri.e1[c]);
+						e2[c] = B::set1(tri.e2[c]);
+						s[c] = o[c] - B::set1(tri.v0[c]);
+					}
+					// p = d x e2, q = s x e1
+					const B px = B::fnmadd(d[2], e2[1], d[1] * e2[2]);
+					const B py = B::fnmadd(d[0], e2[2], d[2] * e2[0]);
+					const B pz = B::fnmadd(d[1], e2[0], d[0] * e2[1]);
+					const B qx = B::fnmadd(s[2], e1[1], s[1] * e1[2]);
+					const B qy = B::fnmadd(s[0], e1[2], s[2] * e1[0]);
+					const B qz = B::fnmadd(s[1], e1[0], s[0] * e1[1]);
+					const B det = B::fmadd(e1[2], pz, B::fmadd(e1[1], py, e1[0] * px));
+					const B rdet = one / det;
+					const B u = B::fmadd(s[2], pz, B::fmadd(s[1], py, s[0] * px)) * rdet;
+					const B v = B::fmadd(d[2], qz, B::fmadd(d[1], qy, d[0] * qx)) * rdet;
+					const B t = B::fmadd(e2[2], qz, B::fmadd(e2[1], qy, e2[0] * qx)) * rdet;
+					const auto m = (det != zero) & (u >= zero) & (u <= one) & (v >= zero) & (u + v <= one) &
+					               (t > zero) & (t < best);
+					if (!m.any()) continue;
+					best = B::select(m, t, best);
+					bu = B::select(m, u, bu);
+					bv = B::select(m, v, bv);
+					const unsigned bits = m.bits();
+					for (size_t l = 0; l < B::size; ++l)
+						if (bits >> l & 1u) prim[l] = k;
+				}
+			}
+			if (sp == 0) break;
+			node = stack[--sp];
+		}
+
+		best.store(lanes[6]);
+		bu.store(lanes[7]);
+		bv.store(lanes[8]);
+		for (size_t l = 0; l < B::size; ++l) {
+			if (prim[l] == NO_HIT) continue;
+			::vtx::ray_hit<T> &h = hits[i + l];
+			h.t = lanes[6][l];
+			h.u = lanes[7][l];
+			h.v = lanes[8][l];
+			h.primitive = order[prim[l]];
+		}
+	}
+}  // namespace bvh_detail
+
+// Closest hits of n rays (hits[i].t limits ray i on input)
+template <typename T>
+inline void bvhIntersect(const ::vtx::bvh_node<T> *nodes, const ::vtx::bvh_triangle<T> *tris,
+    const std::uint32_t *order, const ::vtx::ray<T> *rays, ::vtx::ray_hit<T> *hits, const size_t n) noexcept {
+	using W = typename batch_for<T>::type;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) bvh_detail::packetStep<W>(nodes, tris, order, rays, hits, i);
+	for (; i < n; ++i) bvh_detail::packetStep<scalar::batch<T>>(nodes, tris, order, rays, hits, i);
+}
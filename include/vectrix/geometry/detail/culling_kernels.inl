@@ -0,0 +1,124 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Stream kernels of frustum<T> batch culling.
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// One bound per lane: full batches with batch_for<T>::type, the remainder with scalar::batch<T>.
+// Planes are 24 elements (normal x, y, z, d per plane, normals pointing inside). Components of
+// the bounds are read at a stride of 'Stride' elements: 1 for soa_vector streams, the packed
+// size for arrays of aabb<T> / sphere<T>. Indices of the visible bounds are compacted without
+// branches: every lane writes its index and advances the output by its mask bit.
+// No include guard on purpose.
+
+namespace cull_detail {
+	template <typename B, size_t Stride>
+	VTX_FORCEINLINE B load(const typename B::value_type *p, const size_t i) noexcept {
+		using T = typename B::value_type;
+		if VTX_CONSTEXPR_IF (Stride == 1) return B::load(p + i);
+		alignas(64) T lanes[B::size];
+		for (size_t l = 0; l < B::size; ++l) lanes[l] = p[(i + l) * Stride];
+		return B::load(lanes);
+	}
+
+	template <typename B>
+	VTX_FORCEINLINE size_t compact(const typename B::mask m, const std::uint32_t index,
+	    std::uint32_t *visible, size_t count) noexcept {
+		const unsigned bits = m.bits();
+		for (size_t l = 0; l < B::size; ++l) {
+			visible[count] = index + std::uint32_t(l);
+			count += bits >> l & 1u;
+		}
+		return count;
+	}
+
+	// Box against the planes: the corner farthest along each normal (normal+ . max + normal- . min)
+	// must not be behind any plane
+	template <typename B, size_t Stride>
+	VTX_FORCEINLINE size_t boxStep(const B (&pos)[6][3], const B (&neg)[6][3], const B (&d)[6],
+	    const typename B::value_type *const *lo, const typename B::value_type *const *hi, const size_t i,
+	    const std::uint32_t first, std::uint32_t *visible, const size_t count) noexcept {
+		B mn[3], mx[3];
+		for (size_t c = 0; c < 3; ++c) {
+			mn[c] = load<B, Stride>(lo[c], i);
+			mx[c] = load<B, Stride>(hi[c], i);
+		}
+		typename B::mask in = B::zero() <= B::zero();
+		for (size_t k = 0; k < 6; ++k) {
+			B dist = d[k];
+			for (size_t c = 0; c < 3; ++c)
+				dist = B::fmadd(neg[k][c], mn[c], B::fmadd(pos[k][c], mx[c], dist));
+			in = in & (dist >= B::zero());
+		}
+		return compact<B>(in, first + std::uint32_t(i), visible, count);
+	}
+
+	// Sphere against the planes: the center must not be farther than the radius behind any plane
+	template <typename B, size_t Stride>
+	VTX_FORCEINLINE size_t sphereStep(const B (&n)[6][3], const B (&d)[6],
+	    const typename B::value_type *const *center, const typename B::value_type *radius, const size_t i,
+	    const std::uint32_t first, std::uint32_t *visible, const size_t count) noexcept {
+		B c[3];
+		for (size_t k = 0; k < 3; ++k) c[k] = load<B, Stride>(center[k], i);
+		const B r = -load<B, Stride>(radius, i);
+		typename B::mask in = B::zero() <= B::zero();
+		for (size_t k = 0; k < 6; ++k) {
+			const B dist = B::fmadd(n[k][2], c[2], B::fmadd(n[k][1], c[1], B::fmadd(n[k][0], c[0], d[k])));
+			in = in & (dist >= r);
+		}
+		return compact<B>(in, first + std::uint32_t(i), visible, count);
+	}
+
+	template <typename B>
+	VTX_FORCEINLINE void broadcast(const typename B::value_type *planes, B (&n)[6][3], B (&d)[6]) noexcept {
+		for (size_t k = 0; k < 6; ++k) {
+			for (size_t c = 0; c < 3; ++c) n[k][c] = B::set1(planes[4 * k + c]);
+			d[k] = B::set1(planes[4 * k + 3]);
+		}
+	}
+}  // namespace cull_detail
+
+// Boxes [lo, hi] intersecting the frustum: indices first + i written to 'visible', returns the count
+template <typename T, size_t Stride>
+inline size_t cullBoxes(const T *planes, const T *const *lo, const T *const *hi, const size_t n,
+    const std::uint32_t first, std::uint32_t *visible) noexcept {
+	using W = typename batch_for<T>::type;
+	using S = scalar::batch<T>;
+	W wn[6][3], wd[6], wpos[6][3], wneg[6][3];
+	S sn[6][3], sd[6], spos[6][3], sneg[6][3];
+	cull_detail::broadcast(planes, wn, wd);
+	cull_detail::broadcast(planes, sn, sd);
+	for (size_t k = 0; k < 6; ++k)
+		for (size_t c = 0; c < 3; ++c) {
+			wpos[k][c] = W::max(wn[k][c], W::zero());
+			wneg[k][c] = W::min(wn[k][c], W::zero());
+			spos[k][c] = S::max(sn[k][c], S::zero());
+			sneg[k][c] = S::min(sn[k][c], S::zero());
+		}
+
+	size_t i = 0, count = 0;
+	for (; i + W::size <= n; i += W::size)
+		count = cull_detail::boxStep<W, Stride>(wpos, wneg, wd, lo, hi, i, first, visible, count);
+	for (; i < n; ++i)
+		count = cull_detail::boxStep<S, Stride>(spos, sneg, sd, lo, hi, i, first, visible, count);
+	return count;
+}
+
+// Spheres (center, radius) intersecting the frustum, as cullBoxes
+template <typename T, size_t Stride>
+inline size_t cullSpheres(const T *planes, const T *const *center, const T *radius, const size_t n,
+    const std::uint32_t first, std::uint32_t *visible) noexcept {
+	using W = typename batch_for<T>::type;
+	using S = scalar::batch<T>;
+	W wn[6][3], wd[6];
+	S sn[6][3], sd[6];
+	cull_detail::broadcast(planes, wn, wd);
+	cull_detail::broadcast(planes, sn, sd);
+
+	size_t i = 0, count = 0;
+	for (; i + W::size <= n; i += W::size)
+		count = cull_detail::sphereStep<W, Stride>(wn, wd, center, radius, i, first, visible, count);
+	for (; i < n; ++i)
+		count = cull_detail::sphereStep<S, Stride>(sn, sd, center, radius, i, first, visible, count);
+	return count;
+}
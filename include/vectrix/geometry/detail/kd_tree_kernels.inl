@@ -0,0 +1,176 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Query kernels of vtx::kd_tree.
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// One query at a time: the traversal descends to the leaf of the query, nearer child first, and
+// keeps the farther children whose split plane is within the search distance. Leaves are scanned
+// one batch of points per step (batch_for<T>::type, the remainder with scalar::batch<T>): squared
+// distances of all lanes at once, then only the lanes closer than the current bound go through
+// the scalar result update.
+// No include guard on purpose.
+
+namespace kd_detail {
+	template <typename T>
+	struct entry {
+		size_t node, level, b, e;
+		T bound;  // squared distance to the split planes on the way
+	};
+
+	// Squared distances of points [i, i + B::size) to the query into 'lanes'; true for lanes
+	// below 'limit' (or equal to it, when 'inclusive')
+	template <typename B, bool Inclusive>
+	VTX_FORCEINLINE unsigned scan(const ::vtx::kd_tree_view<typename B::value_type> &t, const B (&q)[3],
+	    const size_t i, const typename B::value_type limit, typename B::value_type *lanes) noexcept {
+		const B dx = B::load(t.xyz[0] + i) - q[0], dy = B::load(t.xyz[1] + i) - q[1];
+		const B dz = B::load(t.xyz[2] + i) - q[2];
+		const B d = B::fmadd(dz, dz, B::fmadd(dy, dy, dx * dx));
+		d.store(lanes);
+		return Inclusive ? (d <= B::set1(limit)).bits() : (d < B::set1(limit)).bits();
+	}
+
+	// Max-heap of the k best candidates in the output row
+	template <typename T>
+	struct best_k {
+		std::uint32_t *ids;
+		T *dist;
+		size_t k, count = 0;
+
+		T worst() const noexcept { return count < k ? std::numeric_limits<T>::infinity() : dist[0]; }
+
+		void insert(const T d, const std::uint32_t id) noexcept {
+			size_t i;
+			if (count < k) {
+				// Sift up from the new last slot
+				i = count++;
+				while (i > 0 && dist[(i - 1) / 2] < d) {
+					dist[i] = dist[(i - 1) / 2];
+					ids[i] = ids[(i - 1) / 2];
+					i = (i - 1) / 2;
+				}
+			} else {
+				if (!(d < dist[0])) return;
+				// Sift down from the replaced top
+				i = 0;
+				for (;;) {
+					size_t c = 2 * i + 1;
+					if (c >= k) break;
+					if (c + 1 < k && dist[c] < dist[c + 1]) ++c;
+					if (!(d < dist[c])) break;
+					dist[i] = dist[c];
+					ids[i] = ids[c];
+					i = c;
+				}
+			}
+			dist[i] = d;
+			ids[i] = id;
+		}
+
+		// Ascending distances, the slots past the found points padded
+		void finish(const std::uint32_t none) noexcept {
+			for (size_t n = count; n > 1; --n) {
+				const T d = dist[n - 1];
+				const std::uint32_t id = ids[n - 1];
+				dist[n - 1] = dist[0];
+				ids[n - 1] = ids[0];
+				size_t i = 0;
+				for (;;) {
+					size_t c = 2 * i + 1;
+					if (c >= n - 1) break;
+					if (c + 1 < n - 1 && dist[c] < dist[c + 1]) ++c;
+					if (!(d < dist[c])) break;
+					dist[i] = dist[c];
+					ids[i] = ids[c];
+					i = c;
+				}
+				dist[i] = d;
+				ids[i] = id;
+			}
+			for (size_t i = count; i < k; ++i) {
+				dist[i] = std::numeric_limits<T>::infinity();
+				ids[i] = none;
+			}
+		}
+	};
+
+	// Leaves of the tree within the search bound of q, nearer first: visit(b, e) scans a leaf,
+	// bound() returns the current squared search distance
+	template <typename T, typename Visit, typename Bound>
+	VTX_FORCEINLINE void traverse(const ::vtx::kd_tree_view<T> &t, const ::vtx::vector<T, 3> &q,
+	    Visit &&visit, Bound &&bound) noexcept {
+		entry<T> stack[::vtx::kd_tree_view<T>::STACK];
+		size_t sp = 0;
+		stack[sp++] = entry<T>{0, 0, 0, t.n, T(0)};
+		while (sp > 0) {
+			entry<T> c = stack[--sp];
+			if (c.bound > bound()) continue;
+			while (c.level < t.depth) {
+				const T diff = q[t.axis[c.node]] - t.split[c.node];
+				const size_t m = c.b + (c.e - c.b) / 2;
+				const entry<T> left{2 * c.node + 1, c.level + 1, c.b, m, c.bound};
+				const entry<T> right{2 * c.node + 2, c.level + 1, m, c.e, c.bound};
+				entry<T> farther = diff < T(0) ? right : left;
+				farther.bound = diff * diff > c.bound ? diff * diff : c.bound;
+				if (farther.bound <= bound()) stack[sp++] = farther;
+				c = diff < T(0) ? left : right;
+			}
+			visit(c.b, c.e);
+		}
+	}
+}  // namespace kd_detail
+
+// k nearest points of each query: row q of ids / dist2 (k entries) in ascending distance,
+// padded with 'none' and infinity past the point count
+template <typename T>
+inline void kdNearest(const ::vtx::kd_tree_view<T> &t, const ::vtx::vector<T, 3> *queries, const size_t count,
+    const size_t k, std::uint32_t *ids, T *dist2, const std::uint32_t none) noexcept {
+	using W = typename batch_for<T>::type;
+	using S = scalar::batch<T>;
+	alignas(64) T lanes[W::size];
+	for (size_t qi = 0; qi < count; ++qi) {
+		const ::vtx::vector<T, 3> &q = queries[qi];
+		kd_detail::best_k<T> best{ids + qi * k, dist2 + qi * k, k};
+		const W wq[3] = {W::set1(q[0]), W::set1(q[1]), W::set1(q[2])};
+		const S sq[3] = {S::set1(q[0]), S::set1(q[1]), S::set1(q[2])};
+		auto update = [&](unsigned bits, const size_t i) {
+			for (size_t l = 0; bits != 0; ++l, bits >>= 1)
+				if (bits & 1u) best.insert(lanes[l], t.ids[i + l]);
+		};
+		auto visit = [&](const size_t b, const size_t e) {
+			size_t i = b;
+			for (; i + W::size <= e; i += W::size)
+				update(kd_detail::scan<W, false>(t, wq, i, best.worst(), lanes), i);
+			for (; i < e; ++i)
+				update(kd_detail::scan<S, false>(t, sq, i, best.worst(), lanes), i);
+		};
+		if (k > 0 && t.n > 0) kd_detail::traverse(t, q, visit, [&] { return best.worst(); });
+		best.finish(none);
+	}
+}
+
+// Points within sqrt(r2) of each query (boundary included) appended to 'out', counts[q] per query
+template <typename T>
+inline void kdRadius(const ::vtx::kd_tree_view<T> &t, const ::vtx::vector<T, 3> *queries, const size_t count,
+    const T r2, std::vector<std::uint32_t> &out, size_t *counts) {
+	using W = typename batch_for<T>::type;
+	using S = scalar::batch<T>;
+	alignas(64) T lanes[W::size];
+	for (size_t qi = 0; qi < count; ++qi) {
+		const ::vtx::vector<T, 3> &q = queries[qi];
+		const size_t first = out.size();
+		const W wq[3] = {W::set1(q[0]), W::set1(q[1]), W::set1(q[2])};
+		const S sq[3] = {S::set1(q[0]), S::set1(q[1]), S::set1(q[2])};
+		auto append = [&](unsigned bits, const size_t i) {
+			for (size_t l = 0; bits != 0; ++l, bits >>= 1)
+				if (bits & 1u) out.push_back(t.ids[i + l]);
+		};
+		auto visit = [&](const size_t b, const size_t e) {
+			size_t i = b;
+			for (; i + W::size <= e; i += W::size) append(kd_detail::scan<W, true>(t, wq, i, r2, lanes), i);
+			for (; i < e; ++i) append(kd_detail::scan<S, true>(t, sq, i, r2, lanes), i);
+		};
+		if (t.n > 0) kd_detail::traverse(t, q, visit, [&] { return r2; });
+		counts[qi] = out.size() - first;
+	}
+}
@@ -0,0 +1,128 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Query kernels of vtx::spatial_hash.
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// Particles of a cell are contiguous in the SoA position streams; a particle is tested against a
+// cell one batch at a time (batch_for<T>::type, the remainder with scalar::batch<T>), squared
+// distances of all lanes at once, and only the lanes within the radius are written out.
+// No include guard on purpose.
+
+namespace hash_detail {
+	// Lanes of particles [j, j + B::size) within sqrt(r2) of p
+	template <typename B>
+	VTX_FORCEINLINE unsigned within(const ::vtx::spatial_hash_view<typename B::value_type> &t,
+	    const B (&p)[3], const size_t j, const B &r2) noexcept {
+		const B dx = B::load(t.xyz[0] + j) - p[0], dy = B::load(t.xyz[1] + j) - p[1];
+		const B dz = B::load(t.xyz[2] + j) - p[2];
+		return (B::fmadd(dz, dz, B::fmadd(dy, dy, dx * dx)) <= r2).bits();
+	}
+
+	// Particles [j, e) within sqrt(r2) of p: emit(bits, j) per batch. Cells hold a few particles,
+	// so the last partial batch is a full one with the lanes past e cleared while it stays
+	// within the streams
+	template <typename T, typename Emit>
+	VTX_FORCEINLINE void scan(const ::vtx::spatial_hash_view<T> &t, const T *p, size_t j, const size_t e,
+	    const T r2, Emit &&emit) {
+		using W = typename batch_for<T>::type;
+		using S = scalar::batch<T>;
+		if (j >= e) return;
+		if (j + W::size <= t.n) {
+			const W wp[3] = {W::set1(p[0]), W::set1(p[1]), W::set1(p[2])};
+			const W wr = W::set1(r2);
+			for (; j + W::size <= e; j += W::size) emit(within<W>(t, wp, j, wr), j);
+			if (j < e && j + W::size <= t.n) {
+				emit(within<W>(t, wp, j, wr) & ((1u << (e - j)) - 1u), j);
+				return;
+			}
+		}
+		const S sp[3] = {S::set1(p[0]), S::set1(p[1]), S::set1(p[2])};
+		const S sr = S::set1(r2);
+		for (; j < e; ++j) emit(within<S>(t, sp, j, sr), j);
+	}
+}  // namespace hash_detail
+
+// Pairs of particles at most sqrt(r2) apart with the first one in cells [cb, ce), (smaller id,
+// larger id). A cell is paired with itself and with those of its 26 neighbours of a larger key:
+// the key of a neighbour is found by adding -1 or +1 to each axis part of the Morton key
+// (interleaved bits, wrapping within the table). Returns the pair count; only the first
+// 'capacity' pairs are written
+template <typename T>
+inline size_t hashPairs(const ::vtx::spatial_hash_view<T> &t, const size_t cb, const size_t ce, const T r2,
+    std::pair<std::uint32_t, std::uint32_t> *out, const size_t capacity) noexcept {
+	const std::uint32_t mx = ::vtx::spatial_hash_view<T>::spread(t.mask);
+	const std::uint32_t axes[3] = {mx, mx << 1, mx << 2};
+	size_t count = 0;
+	for (size_t c = cb; c < ce; ++c) {
+		const size_t b = t.starts[c], e = t.starts[c + 1];
+		if (b == e) continue;
+
+		// Neighbour cells after this one
+		const std::uint32_t key = std::uint32_t(c);
+		std::uint32_t steps[3][3];
+		for (size_t a = 0; a < 3; ++a) {
+			const std::uint32_t m = axes[a], k = key & m;
+			steps[a][0] = (k - 1) & m;
+			steps[a][1] = k;
+			steps[a][2] = ((k | ~m) + 1) & m;
+		}
+		std::uint32_t cells[26];
+		size_t n = 0;
+		for (size_t x = 0; x < 3; ++x)
+			for (size_t y = 0; y < 3; ++y)
+				for (size_t z = 0; z < 3; ++z) {
+					const std::uint32_t other = steps[0][x] | steps[1][y] | steps[2][z];
+					if (other > key && t.starts[other] != t.starts[other + 1]) cells[n++] = other;
+				}
+
+		for (size_t i = b; i < e; ++i) {
+			const std::uint32_t id = t.ids[i];
+			const T p[3] = {t.xyz[0][i], t.xyz[1][i], t.xyz[2][i]};
+			auto emit = [&](unsigned bits, const size_t j) {
+				for (size_t l = 0; bits != 0; ++l, bits >>= 1) {
+					if (!(bits & 1u)) continue;
+					if (count < capacity) {
+						const std::uint32_t other = t.ids[j + l];
+						out[count] = id < other ? std::make_pair(id, other) : std::make_pair(other, id);
+					}
+					++count;
+				}
+			};
+			hash_detail::scan(t, p, i + 1, e, r2, emit);
+			for (size_t k = 0; k < n; ++k)
+				hash_detail::scan(t, p, t.starts[cells[k]], t.starts[cells[k] + 1], r2, emit);
+		}
+	}
+	return count;
+}
+
+// Particles within r of each query (boundary included) appended to 'out', counts[q] per query
+template <typename T>
+inline void hashRadius(const ::vtx::spatial_hash_view<T> &t, const ::vtx::vector<T, 3> *queries,
+    const size_t count, const T r, std::vector<std::uint32_t> &out, size_t *counts) {
+	const T r2 = r * r;
+	for (size_t qi = 0; qi < count; ++qi) {
+		const ::vtx::vector<T, 3> &q = queries[qi];
+		const size_t first = out.size();
+		const T p[3] = {q[0], q[1], q[2]};
+		std::int64_t lo[3], hi[3];
+		for (size_t a = 0; a < 3; ++a) {
+			lo[a] = t.coord(q[a] - r);
+			hi[a] = t.coord(q[a] + r);
+			// Every cell of the table once
+			if (hi[a] - lo[a] > std::int64_t(t.mask)) hi[a] = lo[a] + std::int64_t(t.mask);
+		}
+		auto append = [&](unsigned bits, const size_t j) {
+			for (size_t l = 0; bits != 0; ++l, bits >>= 1)
+				if (bits & 1u) out.push_back(t.ids[j + l]);
+		};
+		for (std::int64_t x = lo[0]; x <= hi[0]; ++x)
+			for (std::int64_t y = lo[1]; y <= hi[1]; ++y)
+				for (std::int64_t z = lo[2]; z <= hi[2]; ++z) {
+					const std::uint32_t k = t.key(x, y, z);
+					hash_detail::scan(t, p, t.starts[k], t.starts[k + 1], r2, append);
+				}
+		counts[qi] = out.size() - first;
+	}
+}
@@ -0,0 +1,60 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Sweep kernel of sweep_and_prune<T>.
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// Bounds are six streams sorted by the minimum on the sweep axis: sweep min, sweep max, then min
+// and max of the two other axes. Box i is tested against the boxes after it one batch at a time
+// (batch_for<T>::type, the remainder with scalar::batch<T>) until a minimum passes its maximum on
+// the sweep axis; the other axes are tested in the same batch.
+// No include guard on purpose.
+
+namespace sweep_detail {
+	// Box i (sweep max, then min and max of the other axes) against boxes [j, j + B::size).
+	// Overlapping pairs are counted, written while the count is below the capacity.
+	// Returns false once the sweep of box i ends in this batch
+	template <typename B>
+	VTX_FORCEINLINE bool step(const typename B::value_type *const *s, const B (&box)[5],
+	    const std::uint32_t *ids, const std::uint32_t id, const size_t j,
+	    std::pair<std::uint32_t, std::uint32_t> *out, const size_t capacity, size_t &count) noexcept {
+		const auto open = B::load(s[0] + j) <= box[0];
+		const auto hit = open & (B::load(s[2] + j) <= box[2]) & (B::load(s[3] + j) >= box[1]) &
+		    (B::load(s[4] + j) <= box[4]) & (B::load(s[5] + j) >= box[3]);
+		unsigned bits = hit.bits();
+		for (size_t l = 0; bits != 0; ++l, bits >>= 1) {
+			if (!(bits & 1u)) continue;
+			if (count < capacity) {
+				const std::uint32_t other = ids[j + l];
+				out[count] = id < other ? std::make_pair(id, other) : std::make_pair(other, id);
+			}
+			++count;
+		}
+		return open.all();
+	}
+}  // namespace sweep_detail
+
+// Pairs of box i in [b, e) with the boxes after it among n sorted boxes, (smaller id, larger id).
+// Returns the pair count; only the first 'capacity' pairs are written
+template <typename T>
+inline size_t sweepPairs(const T *const *s, const std::uint32_t *ids, const size_t n, const size_t b,
+    const size_t e, std::pair<std::uint32_t, std::uint32_t> *out, const size_t capacity) noexcept {
+	using W = typename batch_for<T>::type;
+	using S = scalar::batch<T>;
+	size_t count = 0;
+	for (size_t i = b; i < e; ++i) {
+		W wbox[5];
+		S sbox[5];
+		for (size_t k = 0; k < 5; ++k) {
+			wbox[k] = W::set1(s[k + 1][i]);
+			sbox[k] = S::set1(s[k + 1][i]);
+		}
+		size_t j = i + 1;
+		bool open = true;
+		for (; open && j + W::size <= n; j += W::size)
+			open = sweep_detail::step<W>(s, wbox, ids, ids[i], j, out, capacity, count);
+		for (; open && j < n; ++j)
+			open = sweep_detail::step<S>(s, sbox, ids, ids[i], j, out, capacity, count);
+	}
+	return count;
+}
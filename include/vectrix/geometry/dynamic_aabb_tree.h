@@ -0,0 +1,456 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_DYNAMIC_AABB_TREE_H
+#define VECTRIX_DYNAMIC_AABB_TREE_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "aabb.h"
+#include "ray.h"
+
+#include "vectrix/core/vector3.h"
+#include "vectrix/parallel/parallel_for.h"
+
+namespace vtx {
+	// Dynamic AABB tree: incremental broadphase over moving boxes.
+	// Every proxy (leaf) stores a fat box: the box grown by 'margin' on every side and along its
+	// predicted displacement, so small motion leaves the tree untouched (move() returns false).
+	// Leaves are inserted next to the sibling of least surface area cost and the path to the root
+	// is rebalanced by rotations lifting the higher grandchild, so the height stays logarithmic
+	// under any insertion order.
+	// Nodes live in one pool with a free list: after reserve() inserts and removes allocate
+	// nothing. Proxy ids are node indices, stable until the proxy is removed.
+	// refit() updates many proxies at once without rotations: escaped leaves are re-fattened and
+	// the inner boxes recomputed level by level, in parallel under policy::par.
+	template <typename T>
+	class dynamic_aabb_tree {
+	public:
+		static constexpr std::uint32_t NULL_NODE = std::numeric_limits<std::uint32_t>::max();
+
+		// Traversal stack size (heights of balanced trees stay far below)
+		static constexpr size_t STACK = 128;
+
+		// Inner nodes of one level / proxies per task when refit or pairs are split across threads
+		static constexpr size_t REFIT_GRAIN = 4096, PAIR_GRAIN = 1024;
+
+		// Proxy ids of an overlapping pair
+		using proxy_pair = std::pair<std::uint32_t, std::uint32_t>;
+
+		// Tree node: a proxy when it has no children
+		struct node {
+			aabb<T> box;
+			std::uint32_t parent;    // next free node while in the free list
+			std::uint32_t child[2];  // NULL_NODE for proxies
+			std::int32_t height;     // 0 for proxies, -1 for free nodes
+			std::uint32_t data;      // user data of a proxy
+
+			constexpr bool leaf() const noexcept { return child[0] == NULL_NODE; }
+		};
+
+		// Fat boxes grow by 'margin' and by 'predict' times the displacement passed to move()
+		explicit dynamic_aabb_tree(const T margin = T(0.1), const T predict = T(2)) noexcept
+		    : fatMargin(margin), predictFactor(predict) {}
+
+		// Room for 'count' proxies without allocation. The sibling search holds a few candidates
+		// per level it descends (about 6 for random boxes): room for 8 per level of a balanced tree
+		void reserve(const size_t count) {
+			pool.reserve(count > 0 ? 2 * count - 1 : 0);
+			size_t height = 1;
+			while (height < STACK && size_t(1) << height < count) ++height;
+			search.reserve(8 * height);
+		}
+
+		void clear() noexcept {
+			pool.clear();
+			rootNode = freeList = NULL_NODE;
+			proxies = 0;
+			levelsDirty = true;
+		}
+
+		size_t size() const noexcept { return proxies; }
+		bool empty() const noexcept { return proxies == 0; }
+
+		// Root index (NULL_NODE for an empty tree), node pool and tree height
+		std::uint32_t root() const noexcept { return rootNode; }
+		const std::vector<node> &nodes() const noexcept { return pool; }
+		std::int32_t height() const noexcept { return rootNode == NULL_NODE ? 0 : pool[rootNode].height; }
+
+		// Fat box and user data of a proxy
+		const aabb<T> &fatBounds(const std::uint32_t id) const noexcept { return pool[id].box; }
+		std::uint32_t data(const std::uint32_t id) const noexcept { return pool[id].data; }
+
+		// New proxy of the box, returns its id
+		std::uint32_t insert(const aabb<T> &box, const std::uint32_t data = 0) {
+			const std::uint32_t id = allocate();
+			node &n = pool[id];
+			n.box = fatten(box);
+			n.data = data;
+			n.height = 0;
+			insertLeaf(id);
+			++proxies;
+			return id;
+		}
+
+		void remove(const std::uint32_t id) {
+			assert(id < pool.size() && pool[id].leaf() && pool[id].height == 0);
+			removeLeaf(id);
+			release(id);
+			--proxies;
+		}
+
+		// New box of a proxy moved by 'displacement' since the last update. The proxy is
+		// reinserted only if the box left its fat box; returns true in that case
+		bool move(const std::uint32_t id, const aabb<T> &box,
+		    const vector<T, 3> &displacement = vector<T, 3>(T(0))) {
+			assert(id < pool.size() && pool[id].leaf() && pool[id].height == 0);
+			if (pool[id].box.contains(box)) return false;
+
+			removeLeaf(id);
+			aabb<T> fat = fatten(box);
+			for (size_t c = 0; c < 3; ++c) {
+				const T d = predictFactor * displacement[c];
+				if (d < T(0))
+					fat.min[c] += d;
+				else
+					fat.max[c] += d;
+			}
+			pool[id].box = fat;
+			insertLeaf(id);
+			return true;
+		}
+
+		// Calls fn(id) for every proxy whose fat box overlaps 'box'; fn returns false to stop
+		template <typename F>
+		void query(const aabb<T> &box, F &&fn) const {
+			if (rootNode == NULL_NODE) return;
+			std::uint32_t stack[STACK];
+			size_t sp = 0;
+			stack[sp++] = rootNode;
+			while (sp > 0) {
+				const node &n = pool[stack[--sp]];
+				if (!n.box.intersects(box)) continue;
+				if (n.leaf()) {
+					if (!fn(std::uint32_t(&n - pool.data()))) return;
+					continue;
+				}
+				assert(sp + 2 <= STACK);
+				stack[sp++] = n.child[0];
+				stack[sp++] = n.child[1];
+			}
+		}
+
+		// Calls fn(id, tMax) for every proxy whose fat box the ray enters before tMax. fn returns
+		// the new limit: a closer hit clips the ray, 0 stops the cast
+		template <typename F>
+		void raycast(const ray<T> &r, T tMax, F &&fn) const {
+			if (rootNode == NULL_NODE) return;
+			std::uint32_t stack[STACK];
+			size_t sp = 0;
+			stack[sp++] = rootNode;
+			while (sp > 0) {
+				const std::uint32_t id = stack[--sp];
+				const node &n = pool[id];
+				T t0, t1;
+				if (!r.intersect(n.box, t0, t1) || t0 > tMax) continue;
+				if (n.leaf()) {
+					tMax = fn(id, tMax);
+					if (tMax <= T(0)) return;
+					continue;
+				}
+				assert(sp + 2 <= STACK);
+				stack[sp++] = n.child[0];
+				stack[sp++] = n.child[1];
+			}
+		}
+
+		// All pairs of proxies with overlapping fat boxes, (smaller id, larger id), appended to
+		// 'out'. Proxies query the tree in depth-first order (neighbours in space query one after
+		// another and share the cached nodes); the order is the same under both policies
+		void pairs(std::vector<proxy_pair> &out, const parallel::policy pol = parallel::policy::seq) const {
+			std::vector<std::uint32_t> leaves;
+			leaves.reserve(proxies);
+			if (rootNode != NULL_NODE) {
+				std::uint32_t stack[STACK];
+				size_t sp = 0;
+				stack[sp++] = rootNode;
+				while (sp > 0) {
+					const std::uint32_t id = stack[--sp];
+					if (pool[id].leaf()) {
+						leaves.push_back(id);
+						continue;
+					}
+					assert(sp + 2 <= STACK);
+					stack[sp++] = pool[id].child[1];
+					stack[sp++] = pool[id].child[0];
+				}
+			}
+
+			auto collect = [&](const size_t b, const size_t e, std::vector<proxy_pair> &dst) {
+				for (size_t k = b; k < e; ++k) {
+					const std::uint32_t a = leaves[k];
+					query(pool[a].box, [&](const std::uint32_t id) {
+						if (id > a) dst.emplace_back(a, id);
+						return true;
+					});
+				}
+			};
+			if (pol == parallel::policy::seq || leaves.size() <= PAIR_GRAIN) {
+				collect(0, leaves.size(), out);
+				return;
+			}
+
+			// Fixed chunks with their own buffers, joined in order
+			const size_t chunks = (leaves.size() + PAIR_GRAIN - 1) / PAIR_GRAIN;
+			std::vector<std::vector<proxy_pair>> parts(chunks);
+			parallel::parallel_for(0, chunks, 1, [&](const size_t cb, const size_t ce) {
+				for (size_t c = cb; c < ce; ++c) {
+					const size_t b = c * PAIR_GRAIN;
+					collect(b, leaves.size() - b < PAIR_GRAIN ? leaves.size() : b + PAIR_GRAIN, parts[c]);
+				}
+			});
+			size_t total = out.size();
+			for (const auto &p : parts) total += p.size();
+			out.reserve(total);
+			for (const auto &p : parts) out.insert(out.end(), p.begin(), p.end());
+		}
+
+		// New boxes of many proxies (distinct ids). Proxies whose box left the fat box get a new
+		// fat box, then every inner box is recomputed bottom-up. The tree is not restructured,
+		// so its quality drops under large motion (move() the worst proxies to restore it).
+		// Returns the number of re-fattened proxies
+		size_t refit(const std::uint32_t *ids, const aabb<T> *boxes, const size_t count,
+		    const parallel::policy pol = parallel::policy::seq) {
+			auto leaves = [&](const size_t b, const size_t e) {
+				size_t changed = 0;
+				for (size_t i = b; i < e; ++i) {
+					node &n = pool[ids[i]];
+					assert(n.height == 0);
+					if (n.box.contains(boxes[i])) continue;
+					n.box = fatten(boxes[i]);
+					++changed;
+				}
+				return changed;
+			};
+			const size_t changed = pol == parallel::policy::seq || count <= REFIT_GRAIN ? leaves(0, count) :
+			    parallel::parallel_reduce(size_t(0), count, REFIT_GRAIN, size_t(0), leaves,
+			        [](const size_t a, const size_t b) { return a + b; });
+			if (changed == 0) return 0;
+
+			if (levelsDirty) buildLevels();
+			for (const auto &level : levels) {
+				auto inner = [&](const size_t b, const size_t e) {
+					for (size_t k = b; k < e; ++k) {
+						node &n = pool[level[k]];
+						n.box = pool[n.child[0]].box.merged(pool[n.child[1]].box);
+					}
+				};
+				if (pol == parallel::policy::seq || level.size() <= REFIT_GRAIN)
+					inner(0, level.size());
+				else
+					parallel::parallel_for(0, level.size(), REFIT_GRAIN, inner);
+			}
+			return changed;
+		}
+
+	private:
+		std::vector<node> pool;
+		std::uint32_t rootNode = NULL_NODE, freeList = NULL_NODE;
+		size_t proxies = 0;
+		T fatMargin, predictFactor;
+
+		// Heap of the sibling search, kept to insert without allocation
+		struct candidate {
+			T inherited;
+			std::uint32_t id;
+		};
+		std::vector<candidate> search;
+
+		// Inner nodes by height (1, 2, ...) for refit, rebuilt after structural changes
+		std::vector<std::vector<std::uint32_t>> levels;
+		bool levelsDirty = true;
+
+		aabb<T> fatten(const aabb<T> &box) const noexcept {
+			const vector<T, 3> m(fatMargin);
+			return aabb<T>(box.min - m, box.max + m);
+		}
+
+		std::uint32_t allocate() {
+			levelsDirty = true;
+			std::uint32_t id = freeList;
+			if (id != NULL_NODE)
+				freeList = pool[id].parent;
+			else {
+				id = std::uint32_t(pool.size());
+				pool.emplace_back();
+			}
+			node &n = pool[id];
+			n.parent = n.child[0] = n.child[1] = NULL_NODE;
+			n.height = 0;
+			n.data = 0;
+			return id;
+		}
+
+		void release(const std::uint32_t id) noexcept {
+			levelsDirty = true;
+			pool[id].parent = freeList;
+			pool[id].height = -1;
+			freeList = id;
+		}
+
+		// Branch and bound search of the sibling adding the least surface area to the tree: the
+		// area of the new parent plus the growth of its ancestors ('inherited'). Candidates are
+		// visited by inherited cost, a subtree is pruned when even a zero-size parent in it
+		// cannot beat the best so far
+		std::uint32_t bestSibling(const aabb<T> &box) {
+			const T leafArea = box.surfaceArea();
+			std::uint32_t best = rootNode;
+			T bestCost = std::numeric_limits<T>::infinity();
+			auto later = [](const candidate &a, const candidate &b) { return a.inherited > b.inherited; };
+			search.clear();
+			search.push_back({T(0), rootNode});
+			while (!search.empty()) {
+				std::pop_heap(search.begin(), search.end(), later);
+				const candidate c = search.back();
+				search.pop_back();
+				if (c.inherited + leafArea >= bestCost) break;
+
+				const node &n = pool[c.id];
+				const T merged = n.box.merged(box).surfaceArea();
+				if (merged + c.inherited < bestCost) {
+					bestCost = merged + c.inherited;
+					best = c.id;
+				}
+				if (n.leaf()) continue;
+				const T inherited = c.inherited + merged - n.box.surfaceArea();
+				if (inherited + leafArea >= bestCost) continue;
+				for (size_t k = 0; k < 2; ++k) {
+					search.push_back({inherited, n.child[k]});
+					std::push_heap(search.begin(), search.end(), later);
+				}
+			}
+			return best;
+		}
+
+		// New parent above the best sibling, rebalance upwards
+		void insertLeaf(const std::uint32_t leaf) {
+			levelsDirty = true;
+			if (rootNode == NULL_NODE) {
+				rootNode = leaf;
+				pool[leaf].parent = NULL_NODE;
+				return;
+			}
+
+			const aabb<T> box = pool[leaf].box;
+			const std::uint32_t index = bestSibling(box);
+
+			const std::uint32_t sibling = index, oldParent = pool[sibling].parent;
+			const std::uint32_t parent = allocate();
+			node &p = pool[parent];
+			p.parent = oldParent;
+			p.box = pool[sibling].box.merged(box);
+			p.height = pool[sibling].height + 1;
+			p.child[0] = sibling;
+			p.child[1] = leaf;
+			pool[sibling].parent = parent;
+			pool[leaf].parent = parent;
+			if (oldParent == NULL_NODE)
+				rootNode = parent;
+			else
+				pool[oldParent].child[pool[oldParent].child[0] == sibling ? 0 : 1] = parent;
+
+			fixUpwards(pool[leaf].parent);
+		}
+
+		void removeLeaf(const std::uint32_t leaf) {
+			levelsDirty = true;
+			if (leaf == rootNode) {
+				rootNode = NULL_NODE;
+				return;
+			}
+			const std::uint32_t parent = pool[leaf].parent, grand = pool[parent].parent;
+			const std::uint32_t sibling = pool[parent].child[pool[parent].child[0] == leaf ? 1 : 0];
+			release(parent);
+			if (grand == NULL_NODE) {
+				rootNode = sibling;
+				pool[sibling].parent = NULL_NODE;
+				return;
+			}
+			pool[grand].child[pool[grand].child[0] == parent ? 0 : 1] = sibling;
+			pool[sibling].parent = grand;
+			fixUpwards(grand);
+		}
+
+		// Rebalance and refit the path from 'index' to the root
+		void fixUpwards(std::uint32_t index) {
+			while (index != NULL_NODE) {
+				index = balance(index);
+				node &n = pool[index];
+				const node &a = pool[n.child[0]], &b = pool[n.child[1]];
+				n.height = 1 + (a.height > b.height ? a.height : b.height);
+				n.box = a.box.merged(b.box);
+				index = n.parent;
+			}
+		}
+
+		// Rotation of the higher grandchild up when the heights of A's children differ by more
+		// than 1; returns the root of the subtree
+		std::uint32_t balance(const std::uint32_t ia) {
+			node &a = pool[ia];
+			if (a.leaf() || a.height < 2) return ia;
+			const std::int32_t diff = pool[a.child[1]].height - pool[a.child[0]].height;
+			if (diff > 1) return rotate(ia, 1);
+			if (diff < -1) return rotate(ia, 0);
+			return ia;
+		}
+
+		// Child 'side' of A (C) becomes the parent of A; the higher child of C stays with C,
+		// the other one takes C's place under A
+		std::uint32_t rotate(const std::uint32_t ia, const size_t side) {
+			node &a = pool[ia];
+			const std::uint32_t ic = a.child[side], ib = a.child[1 - side];
+			node &c = pool[ic];
+			const std::uint32_t i_f = c.child[0], ig = c.child[1];
+
+			c.child[0] = ia;
+			c.parent = a.parent;
+			a.parent = ic;
+			if (c.parent == NULL_NODE)
+				rootNode = ic;
+			else
+				pool[c.parent].child[pool[c.parent].child[0] == ia ? 0 : 1] = ic;
+
+			const bool fHigher = pool[i_f].height > pool[ig].height;
+			const std::uint32_t keep = fHigher ? i_f : ig, move = fHigher ? ig : i_f;
+			c.child[1] = keep;
+			a.child[side] = move;
+			pool[move].parent = ia;
+
+			const node &b = pool[ib], &m = pool[move], &k = pool[keep];
+			a.box = b.box.merged(m.box);
+			a.height = 1 + (b.height > m.height ? b.height : m.height);
+			c.box = a.box.merged(k.box);
+			c.height = 1 + (a.height > k.height ? a.height : k.height);
+			return ic;
+		}
+
+		void buildLevels() {
+			levels.clear();
+			for (size_t i = 0; i < pool.size(); ++i) {
+				const std::int32_t h = pool[i].height;
+				if (h < 1) continue;
+				if (levels.size() < size_t(h)) levels.resize(size_t(h));
+				levels[size_t(h) - 1].push_back(std::uint32_t(i));
+			}
+			levelsDirty = false;
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_DYNAMIC_AABB_TREE_H
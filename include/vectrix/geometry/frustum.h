@@ -0,0 +1,179 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_FRUSTUM_H
+#define VECTRIX_FRUSTUM_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "aabb.h"
+#include "plane.h"
+#include "sphere.h"
+
+#include "vectrix/core/matrix4x4.h"
+#include "vectrix/core/soa_vector.h"
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/simd/dispatch.h"
+
+#define VTX_SIMD_KERNELS "vectrix/geometry/detail/culling_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
+
+namespace vtx {
+	// View frustum: 6 normalized planes with normals pointing inside, in the order left, right,
+	// bottom, top, near, far. Built from a projection or view * projection matrix in the row-vector
+	// convention of matrix<T, 4, 4> (clip = p * M, visible -w <= x, y, z <= w, as frustum() and
+	// ortho() produce): plane k is column 3 +- column k.
+	// Bounds are tested against every plane separately, so the tests are conservative: a bound
+	// outside the frustum but near one of its edges can still be reported as intersecting.
+	template <typename T>
+	class frustum {
+	public:
+		// Bounds per task when a batch culling is split across threads
+		static constexpr size_t CULL_GRAIN = 16384;
+
+		plane<T> planes[6];
+
+		// Class default constructor
+		constexpr frustum() = default;
+
+		// Frustum of the projection (view * projection) matrix
+		explicit frustum(const matrix<T, 4, 4> &m) noexcept {
+			for (size_t k = 0; k < 3; ++k) {
+				const vector<T, 3> w(m(0, 3), m(1, 3), m(2, 3)), c(m(0, k), m(1, k), m(2, k));
+				planes[2 * k] = plane<T>(w + c, m(3, 3) + m(3, k)).normalized();
+				planes[2 * k + 1] = plane<T>(w - c, m(3, 3) - m(3, k)).normalized();
+			}
+		}
+
+		bool contains(const vector<T, 3> &p) const noexcept {
+			for (const auto &pl : planes)
+				if (pl.distance(p) < T(0)) return false;
+			return true;
+		}
+
+		bool intersects(const sphere<T> &s) const noexcept {
+			for (const auto &pl : planes)
+				if (pl.distance(s.center) < -s.radius) return false;
+			return true;
+		}
+
+		// The corner farthest along each normal must not be behind any plane
+		bool intersects(const aabb<T> &b) const noexcept {
+			for (const auto &pl : planes) {
+				const vector<T, 3> &n = pl.normal;
+				const vector<T, 3> p(n[0] >= T(0) ? b.max[0] : b.min[0], n[1] >= T(0) ? b.max[1] : b.min[1],
+				    n[2] >= T(0) ? b.max[2] : b.min[2]);
+				if (pl.distance(p) < T(0)) return false;
+			}
+			return true;
+		}
+
+		//*************************************
+		// Batch culling
+		//*************************************
+		// Indices of the bounds intersecting the frustum (as intersects()) are written in increasing
+		// order to 'visible', which needs room for all the bounds; the count is returned.
+		// policy::par splits large batches across the default thread pool.
+
+		// Boxes as min and max streams
+		size_t cull(const soa_vector<T, 3> &min, const soa_vector<T, 3> &max, std::uint32_t *visible,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			assert(min.size() == max.size());
+			const T *lo[3] = {min.data(0), min.data(1), min.data(2)};
+			const T *hi[3] = {max.data(0), max.data(1), max.data(2)};
+			return cullBoxes<1>(lo, hi, min.size(), visible, pol);
+		}
+
+		size_t cull(const aabb<T> *boxes, const size_t count, std::uint32_t *visible,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			static_assert(sizeof(aabb<T>) == 6 * sizeof(T), "aabb<T> must be 6 packed elements");
+			const T *b = boxes->min.data();
+			const T *lo[3] = {b, b + 1, b + 2}, *hi[3] = {b + 3, b + 4, b + 5};
+			return cullBoxes<6>(lo, hi, count, visible, pol);
+		}
+
+		// Spheres as center streams and radii
+		size_t cull(const soa_vector<T, 3> &centers, const T *radii, std::uint32_t *visible,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			const T *c[3] = {centers.data(0), centers.data(1), centers.data(2)};
+			return cullSpheres<1>(c, radii, centers.size(), visible, pol);
+		}
+
+		size_t cull(const sphere<T> *spheres, const size_t count, std::uint32_t *visible,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			static_assert(sizeof(sphere<T>) == 4 * sizeof(T), "sphere<T> must be 4 packed elements");
+			const T *s = spheres->center.data();
+			const T *c[3] = {s, s + 1, s + 2};
+			return cullSpheres<4>(c, s + 3, count, visible, pol);
+		}
+
+	private:
+		// Planes as the 24 elements of the kernels
+		void pack(T (&p)[24]) const noexcept {
+			for (size_t k = 0; k < 6; ++k) {
+				for (size_t c = 0; c < 3; ++c) p[4 * k + c] = planes[k].normal[c];
+				p[4 * k + 3] = planes[k].d;
+			}
+		}
+
+		// Run chunk(b, e, out) over fixed chunks of CULL_GRAIN bounds. Under policy::par every
+		// chunk compacts into its own part of 'visible' first; the parts are moved together after
+		template <typename F>
+		static size_t run(const size_t n, std::uint32_t *visible, const parallel::policy pol, F &&chunk) {
+			assert(n <= size_t(UINT32_MAX));
+			if (pol == parallel::policy::seq || n <= CULL_GRAIN) return chunk(0, n, visible);
+
+			const size_t chunks = (n + CULL_GRAIN - 1) / CULL_GRAIN;
+			std::vector<size_t> counts(chunks);
+			parallel::parallel_for(0, chunks, 1, [&](const size_t cb, const size_t ce) {
+				for (size_t c = cb; c < ce; ++c) {
+					const size_t b = c * CULL_GRAIN, e = n - b < CULL_GRAIN ? n : b + CULL_GRAIN;
+					counts[c] = chunk(b, e, visible + b);
+				}
+			});
+
+			size_t total = counts[0];
+			for (size_t c = 1; c < chunks; ++c) {
+				// Every chunk so far fully visible: the part is already in place
+				const std::uint32_t *part = visible + c * CULL_GRAIN;
+				if (total != c * CULL_GRAIN) std::copy(part, part + counts[c], visible + total);
+				total += counts[c];
+			}
+			return total;
+		}
+
+		template <size_t Stride>
+		size_t cullBoxes(const T *const *lo, const T *const *hi, const size_t n, std::uint32_t *visible,
+		    const parallel::policy pol) const {
+			T p[24];
+			pack(p);
+			const auto kernel = simd::select(VTX_SIMD_FN(cullBoxes<T, Stride>));
+			return run(n, visible, pol, [&](const size_t b, const size_t e, std::uint32_t *out) {
+				const T *l[3], *h[3];
+				for (size_t c = 0; c < 3; ++c) {
+					l[c] = lo[c] + b * Stride;
+					h[c] = hi[c] + b * Stride;
+				}
+				return kernel(p, l, h, e - b, std::uint32_t(b), out);
+			});
+		}
+
+		template <size_t Stride>
+		size_t cullSpheres(const T *const *center, const T *radius, const size_t n, std::uint32_t *visible,
+		    const parallel::policy pol) const {
+			T p[24];
+			pack(p);
+			const auto kernel = simd::select(VTX_SIMD_FN(cullSpheres<T, Stride>));
+			return run(n, visible, pol, [&](const size_t b, const size_t e, std::uint32_t *out) {
+				const T *c[3] = {center[0] + b * Stride, center[1] + b * Stride, center[2] + b * Stride};
+				return kernel(p, c, radius + b * Stride, e - b, std::uint32_t(b), out);
+			});
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_FRUSTUM_H
@@ -0,0 +1,248 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_KD_TREE_H
+#define VECTRIX_KD_TREE_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "aabb.h"
+
+#include "vectrix/core/soa_vector.h"
+#include "vectrix/core/vector3.h"
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/simd/dispatch.h"
+
+namespace vtx {
+	// Raw arrays of a kd_tree<T> read by the query kernels
+	template <typename T>
+	struct kd_tree_view {
+		// Traversal stack size (above any tree depth)
+		static constexpr size_t STACK = 64;
+
+		const T *split;              // split value per inner node
+		const std::uint8_t *axis;    // split axis per inner node
+		const T *xyz[3];             // point coordinates in leaf order
+		const std::uint32_t *ids;    // cloud indices in leaf order
+		size_t n, depth;
+	};
+}  // namespace vtx
+
+#define VTX_SIMD_KERNELS "vectrix/geometry/detail/kd_tree_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
+
+namespace vtx {
+	// k-d tree over a point cloud for nearest neighbour and radius queries.
+	// The tree is complete: every inner node splits its range of points at the median along the
+	// widest axis of their bounds, down to a fixed depth where leaves hold at most LEAF points.
+	// Nodes are implicit: node i has children 2i + 1 and 2i + 2 and only its split value and axis
+	// are stored; the point range of a node follows from halving [0, n) on the way down.
+	// Points are copied in leaf order into SoA streams, so a leaf is scanned one SIMD register of
+	// points per step. Under policy::par the subtrees of large nodes are built in parallel (the
+	// result does not depend on the thread count) and batch queries are split across threads,
+	// radius queries collecting into buffers of their own before they are joined.
+	template <typename T>
+	class kd_tree {
+	public:
+		// Index of a missing neighbour (k above the point count)
+		static constexpr std::uint32_t NO_POINT = std::numeric_limits<std::uint32_t>::max();
+
+		// Points per leaf at most
+		static constexpr size_t LEAF = 32;
+
+		// Points of a node above which its subtrees are built in parallel, queries per task
+		static constexpr size_t BUILD_GRAIN = 16384, QUERY_GRAIN = 256;
+
+		// Empty tree (no neighbours)
+		kd_tree() = default;
+
+		kd_tree(const vector<T, 3> *points, const size_t count,
+		    const parallel::policy pol = parallel::policy::seq) {
+			build(points, count, pol);
+		}
+
+		explicit kd_tree(const soa_vector<T, 3> &points, const parallel::policy pol = parallel::policy::seq) {
+			build(points, pol);
+		}
+
+		void build(const vector<T, 3> *points, const size_t count,
+		    const parallel::policy pol = parallel::policy::seq) {
+			build(count, pol, [points](const size_t i) { return points[i]; });
+		}
+
+		void build(const soa_vector<T, 3> &points, const parallel::policy pol = parallel::policy::seq) {
+			const T *x = points.data(0), *y = points.data(1), *z = points.data(2);
+			build(points.size(), pol, [x, y, z](const size_t i) { return vector<T, 3>(x[i], y[i], z[i]); });
+		}
+
+		size_t size() const noexcept { return ids.size(); }
+		bool empty() const noexcept { return ids.empty(); }
+
+		// Levels of inner nodes
+		size_t depth() const noexcept { return levels; }
+
+		// Cloud indices of the points in leaf order
+		const std::vector<std::uint32_t> &order() const noexcept { return ids; }
+
+		// k nearest points of q in ascending distance: cloud indices to 'nearest', squared distances
+		// to 'dist2' (k entries each, padded with NO_POINT / infinity). Returns the neighbours found
+		size_t nearest(const vector<T, 3> &q, const size_t k, std::uint32_t *nearest, T *dist2) const {
+			simd::select(VTX_SIMD_FN(kdNearest<T>))(view(), &q, 1, k, nearest, dist2, NO_POINT);
+			return k < size() ? k : size();
+		}
+
+		// Nearest point of q (NO_POINT for an empty tree), its squared distance to dist2 if given
+		std::uint32_t nearest(const vector<T, 3> &q, T *dist2 = nullptr) const {
+			std::uint32_t id;
+			T d;
+			nearest(q, 1, &id, &d);
+			if (dist2) *dist2 = d;
+			return id;
+		}
+
+		// Points within r of q (boundary included) appended to 'out' in no particular order.
+		// Returns their count
+		size_t radius(const vector<T, 3> &q, const T r, std::vector<std::uint32_t> &out) const {
+			size_t count;
+			simd::select(VTX_SIMD_FN(kdRadius<T>))(view(), &q, 1, r * r, out, &count);
+			return count;
+		}
+
+		// k nearest points of every query: row i of 'nearest' and 'dist2' (k entries each) as above
+		void nearest(const vector<T, 3> *queries, const size_t count, const size_t k, std::uint32_t *nearest,
+		    T *dist2, const parallel::policy pol = parallel::policy::seq) const {
+			const auto kernel = simd::select(VTX_SIMD_FN(kdNearest<T>));
+			const kd_tree_view<T> v = view();
+			auto chunk = [&](const size_t b, const size_t e) {
+				kernel(v, queries + b, e - b, k, nearest + b * k, dist2 + b * k, NO_POINT);
+			};
+			if (pol == parallel::policy::seq)
+				chunk(0, count);
+			else
+				parallel::parallel_for(0, count, QUERY_GRAIN, chunk);
+		}
+
+		// Points within r of every query: neighbours of query i are found[offsets[i], offsets[i + 1])
+		// (offsets gets count + 1 entries)
+		void radius(const vector<T, 3> *queries, const size_t count, const T r,
+		    std::vector<std::uint32_t> &found, std::vector<size_t> &offsets,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			const auto kernel = simd::select(VTX_SIMD_FN(kdRadius<T>));
+			const kd_tree_view<T> v = view();
+			offsets.resize(count + 1);
+			offsets[0] = 0;
+			if (pol == parallel::policy::seq || count <= QUERY_GRAIN) {
+				found.clear();
+				kernel(v, queries, count, r * r, found, offsets.data() + 1);
+				for (size_t i = 0; i < count; ++i) offsets[i + 1] += offsets[i];
+				return;
+			}
+
+			// Fixed chunks with their own buffers, then copied in order
+			const size_t chunks = (count + QUERY_GRAIN - 1) / QUERY_GRAIN;
+			std::vector<std::vector<std::uint32_t>> parts(chunks);
+			parallel::parallel_for(0, chunks, 1, [&](const size_t cb, const size_t ce) {
+				for (size_t c = cb; c < ce; ++c) {
+					const size_t b = c * QUERY_GRAIN, e = count - b < QUERY_GRAIN ? count : b + QUERY_GRAIN;
+					kernel(v, queries + b, e - b, r * r, parts[c], offsets.data() + 1 + b);
+				}
+			});
+			for (size_t i = 0; i < count; ++i) offsets[i + 1] += offsets[i];
+			found.resize(offsets[count]);
+			parallel::parallel_for(0, chunks, 1, [&](const size_t cb, const size_t ce) {
+				for (size_t c = cb; c < ce; ++c)
+					std::copy(parts[c].begin(), parts[c].end(), found.begin() + offsets[c * QUERY_GRAIN]);
+			});
+		}
+
+	private:
+		std::vector<T> splits;
+		std::vector<std::uint8_t> axes;
+		std::vector<T> coords[3];
+		std::vector<std::uint32_t> ids;
+		size_t levels = 0;
+
+		// Point and its cloud index while the tree is built
+		struct item {
+			vector<T, 3> p;
+			std::uint32_t id;
+		};
+
+		kd_tree_view<T> view() const noexcept {
+			return kd_tree_view<T>{splits.data(), axes.data(),
+			    {coords[0].data(), coords[1].data(), coords[2].data()}, ids.data(), ids.size(), levels};
+		}
+
+		template <typename Point>
+		void build(const size_t n, const parallel::policy pol, Point &&point) {
+			assert(n < size_t(NO_POINT));
+			levels = 0;
+			while ((n + (size_t(1) << levels) - 1) >> levels > LEAF) ++levels;
+			const size_t inner = (size_t(1) << levels) - 1;
+			splits.resize(inner);
+			axes.resize(inner);
+
+			std::vector<item> items(n);
+			auto fill = [&](const size_t b, const size_t e) {
+				for (size_t i = b; i < e; ++i) items[i] = item{point(i), std::uint32_t(i)};
+			};
+			run(n, pol, fill);
+			subdivide(items.data(), 0, 0, 0, n, pol);
+
+			for (auto &c : coords) c.resize(n);
+			ids.resize(n);
+			run(n, pol, [&](const size_t b, const size_t e) {
+				for (size_t i = b; i < e; ++i) {
+					for (size_t c = 0; c < 3; ++c) coords[c][i] = items[i].p[c];
+					ids[i] = items[i].id;
+				}
+			});
+		}
+
+		// Median split of items [b, e) for node 'node', then its children
+		void subdivide(item *items, const size_t node, const size_t level, const size_t b, const size_t e,
+		    const parallel::policy pol) {
+			if (level == levels) return;
+			aabb<T> box;
+			for (size_t i = b; i < e; ++i) box.expand(items[i].p);
+			const vector<T, 3> ext = box.empty() ? vector<T, 3>(T(0)) : box.size();
+			const size_t axis = ext[0] >= ext[1] && ext[0] >= ext[2] ? 0 : ext[1] >= ext[2] ? 1 : 2;
+
+			const size_t m = b + (e - b) / 2;
+			std::nth_element(items + b, items + m, items + e,
+			    [axis](const item &x, const item &y) { return x.p[axis] < y.p[axis]; });
+			splits[node] = items[m].p[axis];
+			axes[node] = std::uint8_t(axis);
+
+			auto child = [&](const size_t c) {
+				if (c == 0)
+					subdivide(items, 2 * node + 1, level + 1, b, m, pol);
+				else
+					subdivide(items, 2 * node + 2, level + 1, m, e, pol);
+			};
+			if (pol == parallel::policy::par && e - b > BUILD_GRAIN)
+				parallel::parallel_for(0, 2, 1, [&](const size_t cb, const size_t ce) {
+					for (size_t c = cb; c < ce; ++c) child(c);
+				});
+			else {
+				child(0);
+				child(1);
+			}
+		}
+
+		template <typename F>
+		static void run(const size_t n, const parallel::policy pol, F &&fn) {
+			if (pol == parallel::policy::seq)
+				fn(0, n);
+			else
+				parallel::parallel_for(0, n, BUILD_GRAIN, fn);
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_KD_TREE_H
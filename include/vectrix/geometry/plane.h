@@ -0,0 +1,59 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_PLANE_H
+#define VECTRIX_PLANE_H
+
+#include "vectrix/core/vector3.h"
+
+namespace vtx {
+	// Plane normal . p + d = 0. The front (positive) side is the one the normal points to;
+	// distances are signed and in units of the normal length, so true distances need a
+	// normalized plane.
+	template <typename T>
+	class plane {
+	public:
+		vector<T, 3> normal;
+		T d;
+
+		// Class default constructor
+		constexpr plane() = default;
+
+		constexpr plane(const vector<T, 3> &n, const T dist) noexcept : normal(n), d(dist) {}
+
+		// Plane through point p
+		constexpr plane(const vector<T, 3> &n, const vector<T, 3> &p) noexcept : normal(n), d(-(n & p)) {}
+
+		// Plane through three points, front side where they are seen counter-clockwise
+		plane(const vector<T, 3> &a, const vector<T, 3> &b, const vector<T, 3> &c) noexcept
+		    : plane(((b - a) % (c - a)).normalized(), a) {}
+
+		// Planes equality operator
+		constexpr bool operator==(const plane &p) const noexcept { return normal == p.normal && d == p.d; }
+
+		// Planes inequality operator
+		constexpr bool operator!=(const plane &p) const noexcept { return !(*this == p); }
+
+		// Signed distance of point
+		constexpr T distance(const vector<T, 3> &p) const noexcept { return (normal & p) + d; }
+
+		// Unit normal plane
+		plane normalized() const noexcept {
+			const T inv = T(1) / normal.length();
+			return plane(normal * inv, d * inv);
+		}
+
+		plane &normalize() noexcept { return *this = normalized(); }
+
+		// Nearest point of the plane (normalized plane)
+		constexpr vector<T, 3> project(const vector<T, 3> &p) const noexcept {
+			return p - normal * distance(p);
+		}
+
+		// Same plane, other front side
+		constexpr plane flipped() const noexcept { return plane(-normal, -d); }
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_PLANE_H
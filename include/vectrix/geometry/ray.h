@@ -0,0 +1,111 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_RAY_H
+#define VECTRIX_RAY_H
+
+#include "aabb.h"
+#include "plane.h"
+#include "sphere.h"
+
+#include "vectrix/core/vector3.h"
+#include "vectrix/math/solvers.h"
+
+namespace vtx {
+	// Ray origin + t * direction, t >= 0. Hit distances t are in units of the direction length.
+	template <typename T>
+	class ray {
+	public:
+		vector<T, 3> origin, direction;
+
+		// Class default constructor
+		constexpr ray() = default;
+
+		constexpr ray(const vector<T, 3> &o, const vector<T, 3> &dir) noexcept : origin(o), direction(dir) {}
+
+		// Point at distance t
+		constexpr vector<T, 3> at(const T t) const noexcept { return origin + direction * t; }
+
+		// Slab test: [tNear, tFar] is the part of the ray inside the box (tNear = 0 from inside).
+		// Axis-parallel directions work through the infinite reciprocals.
+		bool intersect(const aabb<T> &b, T &tNear, T &tFar) const noexcept {
+			T t0 = T(0), t1 = std::numeric_limits<T>::infinity();
+			for (size_t c = 0; c < 3; ++c) {
+				const T inv = T(1) / direction[c];
+				T n = (b.min[c] - origin[c]) * inv, f = (b.max[c] - origin[c]) * inv;
+				if (n > f) {
+					const T s = n;
+					n = f;
+					f = s;
+				}
+				// NaN (origin on a slab of a parallel ray) keeps the current interval
+				t0 = n > t0 ? n : t0;
+				t1 = f < t1 ? f : t1;
+			}
+			tNear = t0;
+			tFar = t1;
+			return t0 <= t1;
+		}
+
+		bool intersects(const aabb<T> &b) const noexcept {
+			T n, f;
+			return intersect(b, n, f);
+		}
+
+		// Nearest hit with the sphere surface (the exit from inside) as roots of
+		// |o + t d - c|^2 = r^2
+		bool intersect(const sphere<T> &s, T &t) const noexcept {
+			const vector<T, 3> oc = origin - s.center;
+			const auto roots = solver::Square(direction & direction, 2 * (direction & oc),
+			    (oc & oc) - s.radius * s.radius);
+			bool hit = false;
+			for (size_t k = 0; k < roots.second; ++k)
+				if (roots.first[k] >= T(0) && (!hit || roots.first[k] < t)) {
+					t = roots.first[k];
+					hit = true;
+				}
+			return hit;
+		}
+
+		// Moller-Trumbore: hit of the triangle (a, b, c) from either side at distance t > 0,
+		// barycentrics u of b and v of c
+		bool intersect(const vector<T, 3> &a, const vector<T, 3> &b, const vector<T, 3> &c, T &t, T &u,
+		    T &v) const noexcept {
+			return intersectEdges(a, b - a, c - a, t, u, v);
+		}
+
+		// Triangle as vertex a and edges e1 = b - a, e2 = c - a (precomputed per triangle)
+		bool intersectEdges(const vector<T, 3> &a, const vector<T, 3> &e1, const vector<T, 3> &e2, T &t, T &u,
+		    T &v) const noexcept {
+			const vector<T, 3> p = direction % e2;
+			const T det = e1 & p;
+			if (det == T(0)) return false;
+			const T inv = T(1) / det;
+			const vector<T, 3> s = origin - a;
+			const T bu = (s & p) * inv;
+			if (bu < T(0) || bu > T(1)) return false;
+			const vector<T, 3> q = s % e1;
+			const T bv = (direction & q) * inv;
+			if (bv < T(0) || bu + bv > T(1)) return false;
+			const T h = (e2 & q) * inv;
+			if (!(h > T(0))) return false;
+			t = h;
+			u = bu;
+			v = bv;
+			return true;
+		}
+
+		// Hit with the plane from either side (none for parallel rays)
+		bool intersect(const plane<T> &p, T &t) const noexcept {
+			const T denom = p.normal & direction;
+			if (denom == T(0)) return false;
+			const T h = -p.distance(origin) / denom;
+			if (h < T(0)) return false;
+			t = h;
+			return true;
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_RAY_H
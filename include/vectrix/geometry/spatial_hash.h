@@ -0,0 +1,260 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SPATIAL_HASH_H
+#define VECTRIX_SPATIAL_HASH_H
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "vectrix/core/soa_vector.h"
+#include "vectrix/core/vector3.h"
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/parallel/radix_sort.h"
+#include "vectrix/simd/dispatch.h"
+
+namespace vtx {
+	// Raw arrays of a spatial_hash<T> read by the query kernels, and its cell keys
+	template <typename T>
+	struct spatial_hash_view {
+		const T *xyz[3];               // positions in cell order
+		const std::uint32_t *ids;      // particle indices in cell order
+		const std::uint32_t *starts;   // first particle of every cell, cells + 1 entries
+		size_t n;                      // particles
+		std::uint32_t mask;            // cells per axis - 1
+		T inv;                         // 1 / cell size
+
+		// Low 10 bits of v moved to every third bit
+		static std::uint32_t spread(std::uint32_t v) noexcept {
+			v &= 0x3FFu;
+			v = (v | v << 16) & 0x030000FFu;
+			v = (v | v << 8) & 0x0300F00Fu;
+			v = (v | v << 4) & 0x030C30C3u;
+			return (v | v << 2) & 0x09249249u;
+		}
+
+		// Unwrapped grid coordinate of a position on one axis
+		std::int64_t coord(const T v) const noexcept { return std::int64_t(std::floor(v * inv)); }
+
+		// Morton key of cell (x, y, z) wrapped onto the table
+		std::uint32_t key(const std::int64_t x, const std::int64_t y, const std::int64_t z) const noexcept {
+			return spread(std::uint32_t(x) & mask) | spread(std::uint32_t(y) & mask) << 1 |
+			    spread(std::uint32_t(z) & mask) << 2;
+		}
+	};
+}  // namespace vtx
+
+#define VTX_SIMD_KERNELS "vectrix/geometry/detail/spatial_hash_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
+
+namespace vtx {
+	// Uniform grid of particles for fixed-radius neighbour search (SPH kernels, crowd avoidance).
+	// Space is cut into cubes of the cell size; a cell (x, y, z) goes to the table entry of the
+	// Morton key of (x, y, z) modulo 2^bits() per axis, so the grid repeats every 2^bits() cells
+	// and distant cells may share an entry (their particles fail the distance test). The table has
+	// about one entry per particle, at least 4 per axis so the 27 cells around one are distinct.
+	// build() is a counting sort by key: a stable parallel radix sort of the particle keys, then
+	// the first particle of every cell, with no storage per cell beyond its offset. Positions are
+	// copied in cell order into SoA streams, so nearby cells are nearby in memory and the queries
+	// test one SIMD register of particles per step. The result does not depend on the policy.
+	template <typename T>
+	class spatial_hash {
+	public:
+		// Particle indices of a neighbour pair
+		using proxy_pair = std::pair<std::uint32_t, std::uint32_t>;
+
+		// Particles per task of the build, cells per task of pairs(), queries per task of radius()
+		static constexpr size_t BUILD_GRAIN = 16384, CELL_GRAIN = 4096, QUERY_GRAIN = 256;
+
+		// Bounds of bits(): the table holds 2^(3 bits()) cells
+		static constexpr size_t MIN_BITS = 2, MAX_BITS = 8;
+
+		explicit spatial_hash(const T cell) noexcept : cellSize(cell), inv(T(1) / cell) {
+			assert(cell > T(0));
+		}
+
+		void build(const vector<T, 3> *points, const size_t count,
+		    const parallel::policy pol = parallel::policy::seq) {
+			build(count, pol, [points](const size_t i) { return points[i]; });
+		}
+
+		void build(const soa_vector<T, 3> &points, const parallel::policy pol = parallel::policy::seq) {
+			const T *x = points.data(0), *y = points.data(1), *z = points.data(2);
+			build(points.size(), pol, [x, y, z](const size_t i) { return vector<T, 3>(x[i], y[i], z[i]); });
+		}
+
+		size_t size() const noexcept { return ids.size(); }
+		T cell() const noexcept { return cellSize; }
+
+		// Cells per axis of the table, log2
+		size_t bits() const noexcept { return tableBits; }
+
+		// Particle indices in cell order (ascending key, ascending index within a cell)
+		const std::vector<std::uint32_t> &order() const noexcept { return ids; }
+
+		// Particles of cell k are order()[cellStarts()[k], cellStarts()[k + 1])
+		const std::vector<std::uint32_t> &cellStarts() const noexcept { return starts; }
+
+		// Table entry of the cell holding p
+		std::uint32_t key(const vector<T, 3> &p) const noexcept {
+			const spatial_hash_view<T> v = view();
+			return v.key(v.coord(p[0]), v.coord(p[1]), v.coord(p[2]));
+		}
+
+		// Pairs of particles at most r apart (r up to the cell size) as (smaller index, larger
+		// index), by cell in Morton order under both policies. Writes at most 'capacity' pairs to
+		// 'out' and returns the number of pairs: a larger result asks for a larger buffer.
+		// Under policy::par chunks of cells fill buffers of their own, kept for the next steps
+		size_t pairs(const T r, proxy_pair *out, const size_t capacity,
+		    const parallel::policy pol = parallel::policy::seq) {
+			assert(r <= cellSize);
+			if (ids.empty()) return 0;
+			const size_t cells = starts.size() - 1;
+			const spatial_hash_view<T> v = view();
+			const auto kernel = simd::select(VTX_SIMD_FN(hashPairs<T>));
+			if (pol == parallel::policy::seq || cells <= CELL_GRAIN)
+				return kernel(v, 0, cells, r * r, out, capacity);
+
+			const size_t chunks = (cells + CELL_GRAIN - 1) / CELL_GRAIN;
+			parts.resize(chunks);
+			counts.resize(chunks);
+			parallel::parallel_for(0, chunks, 1, [&](const size_t cb, const size_t ce) {
+				for (size_t c = cb; c < ce; ++c) {
+					const size_t b = c * CELL_GRAIN, e = cells - b < CELL_GRAIN ? cells : b + CELL_GRAIN;
+					auto &part = parts[c];
+					counts[c] = kernel(v, b, e, r * r, part.data(), part.size());
+					if (counts[c] <= part.size()) continue;
+					part.resize(counts[c]);
+					kernel(v, b, e, r * r, part.data(), part.size());
+				}
+			});
+
+			size_t total = 0;
+			for (size_t c = 0; c < chunks; ++c) {
+				if (total < capacity) {
+					const size_t take = capacity - total < counts[c] ? capacity - total : counts[c];
+					std::copy(parts[c].begin(), parts[c].begin() + take, out + total);
+				}
+				total += counts[c];
+			}
+			return total;
+		}
+
+		// Particles within r of q (boundary included, r up to the cell size) appended to 'out' in
+		// no particular order. Returns their count
+		size_t radius(const vector<T, 3> &q, const T r, std::vector<std::uint32_t> &out) const {
+			assert(r <= cellSize);
+			size_t count = 0;
+			if (!ids.empty()) simd::select(VTX_SIMD_FN(hashRadius<T>))(view(), &q, 1, r, out, &count);
+			return count;
+		}
+
+		// Particles within r of every query: neighbours of query i are found[offsets[i], offsets[i + 1])
+		// (offsets gets count + 1 entries)
+		void radius(const vector<T, 3> *queries, const size_t count, const T r,
+		    std::vector<std::uint32_t> &found, std::vector<size_t> &offsets,
+		    const parallel::policy pol = parallel::policy::seq) const {
+			assert(r <= cellSize);
+			offsets.assign(count + 1, 0);
+			found.clear();
+			if (ids.empty()) return;
+			const auto kernel = simd::select(VTX_SIMD_FN(hashRadius<T>));
+			const spatial_hash_view<T> v = view();
+			if (pol == parallel::policy::seq || count <= QUERY_GRAIN) {
+				kernel(v, queries, count, r, found, offsets.data() + 1);
+				for (size_t i = 0; i < count; ++i) offsets[i + 1] += offsets[i];
+				return;
+			}
+
+			// Fixed chunks with their own buffers, then copied in order
+			const size_t chunks = (count + QUERY_GRAIN - 1) / QUERY_GRAIN;
+			std::vector<std::vector<std::uint32_t>> chunkIds(chunks);
+			parallel::parallel_for(0, chunks, 1, [&](const size_t cb, const size_t ce) {
+				for (size_t c = cb; c < ce; ++c) {
+					const size_t b = c * QUERY_GRAIN, e = count - b < QUERY_GRAIN ? count : b + QUERY_GRAIN;
+					kernel(v, queries + b, e - b, r, chunkIds[c], offsets.data() + 1 + b);
+				}
+			});
+			for (size_t i = 0; i < count; ++i) offsets[i + 1] += offsets[i];
+			found.resize(offsets[count]);
+			parallel::parallel_for(0, chunks, 1, [&](const size_t cb, const size_t ce) {
+				for (size_t c = cb; c < ce; ++c) {
+					const auto &part = chunkIds[c];
+					std::copy(part.begin(), part.end(), found.begin() + offsets[c * QUERY_GRAIN]);
+				}
+			});
+		}
+
+	private:
+		T cellSize, inv;
+		size_t tableBits = MIN_BITS;
+
+		// Particle keys and indices in cell order, scratch of the sort, first particle per cell
+		std::vector<std::uint32_t> keys, ids, tmpKeys, tmpIds, starts;
+
+		// Positions in cell order
+		std::vector<T> coords[3];
+
+		// Pair buffers and counts of the parallel chunks of pairs()
+		std::vector<std::vector<proxy_pair>> parts;
+		std::vector<size_t> counts;
+
+		spatial_hash_view<T> view() const noexcept {
+			return spatial_hash_view<T>{{coords[0].data(), coords[1].data(), coords[2].data()}, ids.data(),
+			    starts.data(), ids.size(), std::uint32_t((size_t(1) << tableBits) - 1), inv};
+		}
+
+		template <typename Point>
+		void build(const size_t n, const parallel::policy pol, Point &&point) {
+			assert(n < size_t(UINT32_MAX));
+			tableBits = MIN_BITS;
+			while (tableBits < MAX_BITS && size_t(1) << 3 * tableBits < n) ++tableBits;
+			const size_t cells = size_t(1) << 3 * tableBits;
+			keys.resize(n);
+			ids.resize(n);
+			tmpKeys.resize(n);
+			tmpIds.resize(n);
+			starts.resize(cells + 1);
+			for (auto &c : coords) c.resize(n);
+
+			const spatial_hash_view<T> v = view();
+			run(n, pol, [&](const size_t b, const size_t e) {
+				for (size_t i = b; i < e; ++i) {
+					const vector<T, 3> p = point(i);
+					keys[i] = v.key(v.coord(p[0]), v.coord(p[1]), v.coord(p[2]));
+					ids[i] = std::uint32_t(i);
+				}
+			});
+			const bool seq = pol == parallel::policy::seq;
+			parallel::radix_sort(keys.data(), ids.data(), n, tmpKeys.data(), tmpIds.data(),
+			    seq ? n : parallel::RADIX_GRAIN);
+
+			// Particle i starts the cells after the key of particle i - 1 up to its own key
+			run(n, pol, [&](const size_t b, const size_t e) {
+				for (size_t i = b; i < e; ++i) {
+					const size_t first = i == 0 ? 0 : size_t(keys[i - 1]) + 1;
+					for (size_t k = first; k <= keys[i]; ++k) starts[k] = std::uint32_t(i);
+					const vector<T, 3> p = point(ids[i]);
+					for (size_t c = 0; c < 3; ++c) coords[c][i] = p[c];
+				}
+			});
+			const size_t tail = n == 0 ? 0 : size_t(keys[n - 1]) + 1;
+			std::fill(starts.begin() + tail, starts.end(), std::uint32_t(n));
+		}
+
+		template <typename F>
+		static void run(const size_t n, const parallel::policy pol, F &&fn) {
+			if (pol == parallel::policy::seq)
+				fn(0, n);
+			else
+				parallel::parallel_for(0, n, BUILD_GRAIN, fn);
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_SPATIAL_HASH_H
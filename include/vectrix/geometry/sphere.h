@@ -0,0 +1,58 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SPHERE_H
+#define VECTRIX_SPHERE_H
+
+#include "aabb.h"
+
+#include "vectrix/core/vector3.h"
+
+namespace vtx {
+	// Bounding sphere. 4 packed elements (center, then radius): arrays of spheres are culled
+	// as is (see frustum<T>).
+	template <typename T>
+	class sphere {
+	public:
+		vector<T, 3> center;
+		T radius;
+
+		// Class default constructor
+		constexpr sphere() = default;
+
+		constexpr sphere(const vector<T, 3> &c, const T r) noexcept : center(c), radius(r) {}
+
+		// Sphere around the box
+		constexpr explicit sphere(const aabb<T> &b) noexcept
+		    : center(b.center()), radius(b.extent().length()) {}
+
+		// Spheres equality operator
+		constexpr bool operator==(const sphere &s) const noexcept {
+			return center == s.center && radius == s.radius;
+		}
+
+		// Spheres inequality operator
+		constexpr bool operator!=(const sphere &s) const noexcept { return !(*this == s); }
+
+		// Bounding box
+		constexpr aabb<T> bounds() const noexcept {
+			return aabb<T>::fromCenter(center, vector<T, 3>(radius));
+		}
+
+		constexpr bool contains(const vector<T, 3> &p) const noexcept {
+			return (p - center).squaredLength() <= radius * radius;
+		}
+
+		constexpr bool intersects(const sphere &s) const noexcept {
+			const T r = radius + s.radius;
+			return (s.center - center).squaredLength() <= r * r;
+		}
+
+		constexpr bool intersects(const aabb<T> &b) const noexcept {
+			return b.squaredDistance(center) <= radius * radius;
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_SPHERE_H
@@ -0,0 +1,192 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SWEEP_AND_PRUNE_H
+#define VECTRIX_SWEEP_AND_PRUNE_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "vectrix/core/soa_vector.h"
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/parallel/radix_sort.h"
+#include "vectrix/simd/dispatch.h"
+
+#define VTX_SIMD_KERNELS "vectrix/geometry/detail/sweep_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
+
+namespace vtx {
+	// Sweep and prune broadphase over boxes [min[i], max[i]] in soa_vector streams.
+	// Boxes are kept sorted by their minimum on one sweep axis (best: the axis the scene spreads
+	// along). Between frames update() repairs the previous order by insertion sort, nearly free
+	// when few boxes pass each other; the first frame, a changed box count or a frame that breaks
+	// the order sorts from scratch by parallel radix sort.
+	// The sorted bounds are copied into six streams, so pairs() sweeps contiguous memory and tests
+	// one box against a batch of following boxes on all three axes at once.
+	template <typename T>
+	class sweep_and_prune {
+	public:
+		// Box indices of an overlapping pair
+		using proxy_pair = std::pair<std::uint32_t, std::uint32_t>;
+
+		// Sorted boxes per task when pairs() or the copy of the bounds are split across threads
+		static constexpr size_t SWEEP_GRAIN = 2048, GATHER_GRAIN = 16384;
+
+		// Insertion sort moves per box after which update() sorts from scratch
+		static constexpr size_t MAX_MOVES = 8;
+
+		explicit sweep_and_prune(const size_t axis = 0) noexcept : sweepAxis(axis) { assert(axis < 3); }
+
+		size_t axis() const noexcept { return sweepAxis; }
+		size_t size() const noexcept { return ids.size(); }
+
+		// Box indices by the minimum on the sweep axis
+		const std::vector<std::uint32_t> &order() const noexcept { return ids; }
+
+		// New bounds of the frame. Returns true if the boxes were sorted from scratch
+		bool update(const soa_vector<T, 3> &min, const soa_vector<T, 3> &max,
+		    const parallel::policy pol = parallel::policy::seq) {
+			assert(min.size() == max.size());
+			const size_t n = min.size();
+			if (n != ids.size()) {
+				rebuild(min, max, pol);
+				return true;
+			}
+
+			// Previous order with the new minima, sorted in place
+			const T *lo = min.data(sweepAxis);
+			T *key = streams[0].data();
+			for (size_t k = 0; k < n; ++k) key[k] = lo[ids[k]];
+			const size_t budget = MAX_MOVES * n;
+			size_t moves = 0;
+			for (size_t k = 1; k < n; ++k) {
+				const T v = key[k];
+				if (!(v < key[k - 1])) continue;
+				const std::uint32_t id = ids[k];
+				size_t j = k;
+				do {
+					key[j] = key[j - 1];
+					ids[j] = ids[j - 1];
+				} while (--j > 0 && v < key[j - 1]);
+				key[j] = v;
+				ids[j] = id;
+				moves += k - j;
+				if (moves > budget) {
+					rebuild(min, max, pol);
+					return true;
+				}
+			}
+			gather(min, max, 1, pol);
+			return false;
+		}
+
+		// Sort from scratch
+		void rebuild(const soa_vector<T, 3> &min, const soa_vector<T, 3> &max,
+		    const parallel::policy pol = parallel::policy::seq) {
+			assert(min.size() == max.size());
+			const size_t n = min.size();
+			assert(n <= size_t(UINT32_MAX));
+			ids.resize(n);
+			tmpIds.resize(n);
+			keys.resize(n);
+			tmpKeys.resize(n);
+			for (auto &s : streams) s.resize(n);
+
+			const T *lo = min.data(sweepAxis);
+			auto init = [&](const size_t b, const size_t e) {
+				for (size_t i = b; i < e; ++i) {
+					keys[i] = parallel::radix_key(lo[i]);
+					ids[i] = std::uint32_t(i);
+				}
+			};
+			const bool seq = pol == parallel::policy::seq;
+			if (seq)
+				init(0, n);
+			else
+				parallel::parallel_for(0, n, GATHER_GRAIN, init);
+			parallel::radix_sort(keys.data(), ids.data(), n, tmpKeys.data(), tmpIds.data(),
+			    seq ? n : parallel::RADIX_GRAIN);
+			gather(min, max, 0, pol);
+		}
+
+		// Overlapping pairs of boxes (touching included) as (smaller index, larger index), in the
+		// sweep order under both policies. Writes at most 'capacity' pairs to 'out' and returns the
+		// number of pairs: a larger result asks for a larger buffer.
+		// Under policy::par chunks of the sweep fill buffers of their own, kept for the next frames
+		size_t pairs(proxy_pair *out, const size_t capacity,
+		    const parallel::policy pol = parallel::policy::seq) {
+			const size_t n = ids.size();
+			const T *s[6];
+			for (size_t k = 0; k < 6; ++k) s[k] = streams[k].data();
+			const auto kernel = simd::select(VTX_SIMD_FN(sweepPairs<T>));
+			if (pol == parallel::policy::seq || n <= SWEEP_GRAIN)
+				return kernel(s, ids.data(), n, 0, n, out, capacity);
+
+			const size_t chunks = (n + SWEEP_GRAIN - 1) / SWEEP_GRAIN;
+			parts.resize(chunks);
+			counts.resize(chunks);
+			parallel::parallel_for(0, chunks, 1, [&](const size_t cb, const size_t ce) {
+				for (size_t c = cb; c < ce; ++c) {
+					const size_t b = c * SWEEP_GRAIN, e = n - b < SWEEP_GRAIN ? n : b + SWEEP_GRAIN;
+					auto &part = parts[c];
+					counts[c] = kernel(s, ids.data(), n, b, e, part.data(), part.size());
+					if (counts[c] <= part.size()) continue;
+					part.resize(counts[c]);
+					kernel(s, ids.data(), n, b, e, part.data(), part.size());
+				}
+			});
+
+			size_t total = 0;
+			for (size_t c = 0; c < chunks; ++c) {
+				if (total < capacity) {
+					const size_t take = capacity - total < counts[c] ? capacity - total : counts[c];
+					std::copy(parts[c].begin(), parts[c].begin() + take, out + total);
+				}
+				total += counts[c];
+			}
+			return total;
+		}
+
+	private:
+		using key_type = decltype(parallel::radix_key(T()));
+
+		size_t sweepAxis;
+
+		// Sorted box indices, sweep minima as radix sort keys and scratch of the sort
+		std::vector<std::uint32_t> ids, tmpIds;
+		std::vector<key_type> keys, tmpKeys;
+
+		// Sorted bounds: sweep min, sweep max, min and max of the next axis, of the last axis
+		std::vector<T> streams[6];
+
+		// Pair buffers and counts of the parallel sweep chunks
+		std::vector<std::vector<proxy_pair>> parts;
+		std::vector<size_t> counts;
+
+		// Bounds in sorted order, from stream 'first' on (the sweep minima may be in place already)
+		void gather(const soa_vector<T, 3> &min, const soa_vector<T, 3> &max, const size_t first,
+		    const parallel::policy pol) {
+			const T *src[6];
+			for (size_t k = 0; k < 3; ++k) {
+				src[2 * k] = min.data((sweepAxis + k) % 3);
+				src[2 * k + 1] = max.data((sweepAxis + k) % 3);
+			}
+			auto copy = [&](const size_t b, const size_t e) {
+				for (size_t k = first; k < 6; ++k) {
+					T *dst = streams[k].data();
+					for (size_t i = b; i < e; ++i) dst[i] = src[k][ids[i]];
+				}
+			};
+			if (pol == parallel::policy::seq)
+				copy(0, ids.size());
+			else
+				parallel::parallel_for(0, ids.size(), GATHER_GRAIN, copy);
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_SWEEP_AND_PRUNE_H
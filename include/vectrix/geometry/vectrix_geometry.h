@@ -0,0 +1,34 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_VECTRIX_GEOMETRY_H
+#define VECTRIX_VECTRIX_GEOMETRY_H
+
+// Bounding volumes
+#include "aabb.h"
+#include "sphere.h"
+
+// Plane and ray
+#include "plane.h"
+#include "ray.h"
+
+// View frustum and batch culling
+#include "frustum.h"
+
+// Bounding volume hierarchy of triangle meshes (ray queries)
+#include "bvh.h"
+
+// Dynamic AABB tree broadphase of moving boxes
+#include "dynamic_aabb_tree.h"
+
+// Sweep and prune broadphase of boxes in SoA streams
+#include "sweep_and_prune.h"
+
+// k-d tree of point clouds (nearest neighbour and radius queries)
+#include "kd_tree.h"
+
+// Uniform grid spatial hash of particles (fixed-radius neighbour pairs)
+#include "spatial_hash.h"
+
+#endif //VECTRIX_VECTRIX_GEOMETRY_H
@@ -19,6 +19,21 @@
 #define VTX_CONSTEXPR_IF
 #endif // __cpp_if_constexpr >= 201606
 
+// Detect constant evaluation to keep runtime-only (SIMD) paths out of constexpr contexts.
+// Without compiler support the runtime paths are never taken.
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define VTX_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif // __has_builtin(__builtin_is_constant_evaluated)
+#endif // defined(__has_builtin)
+#if !defined(VTX_IS_CONSTANT_EVALUATED) && \
+    ((defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925))
+#define VTX_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif // GCC 9, MSVC 16.5
+#ifndef VTX_IS_CONSTANT_EVALUATED
+#define VTX_IS_CONSTANT_EVALUATED() true
+#endif // VTX_IS_CONSTANT_EVALUATED
+
 #if defined(__GNUC__) || defined(__clang__)
 #define VTX_LIKELY(x) __builtin_expect(!!(x), 1)
 #define VTX_UNLIKELY(x) __builtin_expect(!!(x), 0)
@@ -0,0 +1,97 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Stream kernels of the counter-based bulk random fill (vtx::random::fill).
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// Philox4x32-10 rounds work on SoA lanes of GROUP blocks in plain integer loops: the target
+// options of the enclosing backend vectorize them (32x32 -> 64 bit multiplies).
+// Value k of a stream depends only on key, stream and k, so any split of a range gives the
+// same numbers. No include guard on purpose.
+
+namespace random_detail {
+	// Blocks generated per step
+	constexpr size_t GROUP = 64;
+
+	// Philox4x32-10 of L consecutive blocks: counter = (first + l, stream).
+	// The rounds are unrolled inside the lane loop, so the state stays in registers
+	template <size_t L>
+	VTX_FORCEINLINE void philoxBlocks(const std::uint32_t k0, const std::uint32_t k1,
+	    const std::uint64_t stream, const std::uint64_t first, std::uint32_t (&x)[4][L]) noexcept {
+		for (size_t l = 0; l < L; ++l) {
+			std::uint32_t x0 = static_cast<std::uint32_t>(first + l);
+			std::uint32_t x1 = static_cast<std::uint32_t>((first + l) >> 32);
+			std::uint32_t x2 = static_cast<std::uint32_t>(stream);
+			std::uint32_t x3 = static_cast<std::uint32_t>(stream >> 32);
+			std::uint32_t a = k0, b = k1;
+			for (int r = 0; r < 10; ++r) {
+				const auto h0 = static_cast<std::uint32_t>((std::uint64_t(0xD2511F53u) * x0) >> 32);
+				const auto h1 = static_cast<std::uint32_t>((std::uint64_t(0xCD9E8D57u) * x2) >> 32);
+				const std::uint32_t y1 = 0xCD9E8D57u * x2, y3 = 0xD2511F53u * x0;
+				x0 = h1 ^ x1 ^ a;
+				x2 = h0 ^ x3 ^ b;
+				x1 = y1;
+				x3 = y3;
+				a += 0x9E3779B9u;
+				b += 0xBB67AE85u;
+			}
+			x[0][l] = x0;
+			x[1][l] = x1;
+			x[2][l] = x2;
+			x[3][l] = x3;
+		}
+	}
+
+	// Uniform [0, 1) from the top bits of a block word, exponent trick (no integer conversion)
+	VTX_FORCEINLINE float unit(const std::uint32_t lo, const std::uint32_t, float) noexcept {
+		const std::uint32_t bits = (lo >> 9) | 0x3F800000u;
+		float f;
+		std::memcpy(&f, &bits, sizeof(f));
+		return f - 1.0f;
+	}
+
+	// Uniform [0, 1) from the top bits of two block words (low word first)
+	VTX_FORCEINLINE double unit(const std::uint32_t lo, const std::uint32_t hi, double) noexcept {
+		const std::uint64_t bits = ((std::uint64_t(hi) << 32 | lo) >> 12) | 0x3FF0000000000000ull;
+		double f;
+		std::memcpy(&f, &bits, sizeof(f));
+		return f - 1.0;
+	}
+
+	// Values of one group of GROUP blocks in the order of philox4x32 draws: word set j (1 word
+	// per float, 2 per double) of block l is value l * 4 / W + j
+	template <typename T>
+	VTX_FORCEINLINE void convert(const std::uint32_t (&x)[4][GROUP], T *out, const T lo,
+	    const T span) noexcept {
+		constexpr size_t W = sizeof(T) / 4;
+		for (size_t l = 0; l < GROUP; ++l)
+			for (size_t j = 0; j < 4 / W; ++j)
+				out[l * (4 / W) + j] = lo + span * unit(x[W * j][l], x[W * j + W - 1][l], T());
+	}
+}  // namespace random_detail
+
+// Write values first .. first + n - 1 of stream (key k0, k1) scaled to [lo, lo + span).
+// Value k comes from group k / (GROUP * per block), so it does not depend on the range split
+template <typename T>
+inline void philoxFill(const std::uint32_t k0, const std::uint32_t k1, const std::uint64_t stream,
+    const std::uint64_t first, const size_t n, T *out, const T lo, const T span) noexcept {
+	using random_detail::GROUP;
+	constexpr size_t PER_GROUP = GROUP * (4 / (sizeof(T) / 4));
+	std::uint32_t x[4][GROUP];
+
+	std::uint64_t group = first / PER_GROUP;
+	size_t skip = static_cast<size_t>(first % PER_GROUP), i = 0;
+	for (; i < n; ++group, skip = 0) {
+		random_detail::philoxBlocks(k0, k1, stream, group * GROUP, x);
+		if (skip == 0 && n - i >= PER_GROUP) {
+			random_detail::convert(x, out + i, lo, span);
+			i += PER_GROUP;
+			continue;
+		}
+
+		// Partial group at either end of the range
+		T v[PER_GROUP];
+		random_detail::convert(x, v, lo, span);
+		for (size_t j = skip; j < PER_GROUP && i < n; ++j, ++i) out[i] = v[j];
+	}
+}
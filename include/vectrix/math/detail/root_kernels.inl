@@ -0,0 +1,153 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Stream kernels of the batch polynomial root solvers (solver::Square / solver::Cubic).
+// Included once per backend namespace by vectrix/simd/foreach_backend.h.
+// Every case of the scalar solvers is evaluated for all lanes and picked with masks,
+// so there are no data dependent branches. Roots beyond the count are 0.
+// No include guard on purpose.
+
+namespace root_detail {
+	// Apply scalar function to the lanes selected by m (functions without a batch form),
+	// other lanes are 0. Lanes of other cases cost nothing
+	template <typename B, typename M, typename F>
+	VTX_FORCEINLINE B lanewise(const M m, const B x, F fn) noexcept {
+		alignas(64) typename B::value_type v[B::size];
+		x.store(v);
+		const unsigned bits = m.bits();
+		for (size_t l = 0; l < B::size; ++l)
+			v[l] = (bits >> l) & 1u ? fn(v[l]) : typename B::value_type(0);
+		return B::load(v);
+	}
+
+	// Store root count batch as bytes
+	template <typename B>
+	VTX_FORCEINLINE void storeCount(const B c, std::uint8_t *out) noexcept {
+		alignas(64) typename B::value_type v[B::size];
+		c.store(v);
+		for (size_t l = 0; l < B::size; ++l) out[l] = static_cast<std::uint8_t>(v[l]);
+	}
+
+	// A * x^2 + B * x + C = 0, same cases as solver::Square
+	template <typename B>
+	VTX_FORCEINLINE B squareStep(const B a, const B b, const B c, B &r0, B &r1) noexcept {
+		using T = typename B::value_type;
+		const B zero = B::zero(), one = B::set1(T(1)), two = B::set1(T(2));
+
+		const auto linear = a == zero, constant = b == zero;
+		const B d = b * b - a * c * B::set1(T(4));
+		const B inv2A = one / (two * a);
+		const B sq = B::sqrt(B::max(d, zero));
+		const auto twoRoots = d > zero, oneRoot = d == zero;
+
+		const B x0 = (-b + sq) * inv2A, x1 = (-b - sq) * inv2A, xl = -c / b;
+		r0 = B::select(
+		    linear, B::select(constant, zero, xl), B::select(twoRoots | oneRoot, x0, zero));
+		r1 = B::select(!linear & twoRoots, x1, zero);
+		return B::select(linear, B::select(constant, zero, one),
+		    B::select(twoRoots, two, B::select(oneRoot, one, zero)));
+	}
+
+	// A * x^3 + B * x^2 + C * x + D = 0, same cases as solver::Cubic.
+	// Cube roots, acos and cos run per lane (no batch forms) and only in lanes of their case
+	template <typename B>
+	VTX_FORCEINLINE B cubicStep(
+	    const B a, const B b, const B c, const B d, B &r0, B &r1, B &r2) noexcept {
+		using T = typename B::value_type;
+		const B zero = B::zero(), one = B::set1(T(1)), two = B::set1(T(2)), three = B::set1(T(3));
+		const B rev2 = B::set1(T(0.5)), rev3 = B::set1(T(1.0 / 3));
+
+		const B aa = a * a, bb = b * b;
+		const B p = (three * a * c - bb) / (three * aa);
+		const B q = (two * bb * b - B::set1(T(9)) * a * b * c + B::set1(T(27)) * aa * d) /
+		    (B::set1(T(27)) * aa * a);
+		const B p3 = p * rev3, q2 = q * rev2;
+		const B disc = p3 * p3 * p3 + q2 * q2;
+		const B b3a = b / (three * a);
+		const auto single = disc > zero, twice = disc == zero, triple = disc < zero;
+
+		// One real root (disc > 0) and double root (disc == 0, gamma == 0)
+		const auto cbrt = [](const T v) { return vtx::math::policy::cbrt(v); };
+		const B gamma = B::sqrt(B::max(disc, zero));
+		const B alpha = lanewise(single | twice, -q2 + gamma, cbrt);
+		const B beta = lanewise(single, -q2 - gamma, cbrt);
+
+		// Three real roots (disc < 0): cos(t + 2pi/3) and cos(t + 4pi/3) from cos(t), sin(t),
+		// t = phi / 3 lies in [0, pi / 3]
+		const B r = B::sqrt(B::max(-(p * p * p) / B::set1(T(27)), zero));
+		const B cosPhi = B::min(B::max(-q / (two * r), -one), one);
+		const B t = lanewise(triple, cosPhi, [](const T v) { return vtx::math::policy::acos(v) * T(1.0 / 3); });
+		const B cosT = lanewise(triple, t, [](const T v) { return vtx::math::policy::cos(v); });
+		const B sinT = B::sqrt(B::max(one - cosT * cosT, zero)) * B::set1(T(0.86602540378443865));
+		const B sqrt2p3 = two * B::sqrt(B::max(-p * rev3, zero));
+		const B t0 = sqrt2p3 * cosT - b3a;
+		const B t1 = sqrt2p3 * (-cosT * rev2 - sinT) - b3a;
+		const B t2 = sqrt2p3 * (-cosT * rev2 + sinT) - b3a;
+
+		r0 = B::select(single, alpha + beta - b3a,
+		    B::select(twice, two * alpha - b3a, B::select(triple, t0, zero)));
+		r1 = B::select(twice, -alpha - b3a, B::select(triple, t1, zero));
+		r2 = B::select(triple, t2, zero);
+		B count = B::select(single, one, B::select(twice, two, B::select(triple, three, zero)));
+
+		// Leading zero coefficient: quadratic of the rest
+		const auto quadratic = a == zero;
+		B s0, s1;
+		const B sc = root_detail::squareStep(b, c, d, s0, s1);
+		r0 = B::select(quadratic, s0, r0);
+		r1 = B::select(quadratic, s1, r1);
+		r2 = B::select(quadratic, zero, r2);
+		return B::select(quadratic, sc, count);
+	}
+}  // namespace root_detail
+
+// Solve n square equations (coefficient streams a, b, c)
+template <typename T>
+inline void squareStream(const T *a, const T *b, const T *c, const size_t n, T *r0, T *r1,
+    std::uint8_t *count) noexcept {
+	using W = typename batch_for<T>::type;
+	using S = scalar::batch<T>;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) {
+		W x0, x1;
+		const W k = root_detail::squareStep(W::load(a + i), W::load(b + i), W::load(c + i), x0, x1);
+		x0.store(r0 + i);
+		x1.store(r1 + i);
+		root_detail::storeCount(k, count + i);
+	}
+	for (; i < n; ++i) {
+		S x0, x1;
+		const S k = root_detail::squareStep(S::load(a + i), S::load(b + i), S::load(c + i), x0, x1);
+		x0.store(r0 + i);
+		x1.store(r1 + i);
+		root_detail::storeCount(k, count + i);
+	}
+}
+
+// Solve n cubic equations (coefficient streams a, b, c, d)
+template <typename T>
+inline void cubicStream(const T *a, const T *b, const T *c, const T *d, const size_t n, T *r0,
+    T *r1, T *r2, std::uint8_t *count) noexcept {
+	using W = typename batch_for<T>::type;
+	using S = scalar::batch<T>;
+	size_t i = 0;
+	for (; i + W::size <= n; i += W::size) {
+		W x0, x1, x2;
+		const W k = root_detail::cubicStep(
+		    W::load(a + i), W::load(b + i), W::load(c + i), W::load(d + i), x0, x1, x2);
+		x0.store(r0 + i);
+		x1.store(r1 + i);
+		x2.store(r2 + i);
+		root_detail::storeCount(k, count + i);
+	}
+	for (; i < n; ++i) {
+		S x0, x1, x2;
+		const S k = root_detail::cubicStep(
+		    S::load(a + i), S::load(b + i), S::load(c + i), S::load(d + i), x0, x1, x2);
+		x0.store(r0 + i);
+		x1.store(r1 + i);
+		x2.store(r2 + i);
+		root_detail::storeCount(k, count + i);
+	}
+}
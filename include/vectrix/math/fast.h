@@ -0,0 +1,455 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_FAST_H
+#define VECTRIX_FAST_H
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "common.h"
+
+// Compile-time math policy of the core types: with VTX_FAST_MATH defined, the hot paths
+// (vector normalization, rotation matrices, quaternion slerp, cubic solver) call the
+// vtx::math::fast approximations at accuracy VTX_FAST_MATH_ACCURACY (low, medium or high).
+// Constant evaluation always takes the std:: functions.
+#ifndef VTX_FAST_MATH_ACCURACY
+#define VTX_FAST_MATH_ACCURACY high
+#endif // VTX_FAST_MATH_ACCURACY
+
+namespace vtx {
+	namespace math {
+		// Approximations built from multiplies, adds, compares and bit casts only: no tables and
+		// no data dependent branches, so loops over arrays vectorize (GCC needs -fno-math-errno
+		// and -fno-trapping-math for the functions with selects, rsqrt and sincos vectorize as is).
+		// Not -ffast-math: reassociation breaks the split constant argument reductions.
+		// Special values are noted per function.
+		//
+		// Bounds of the maximum error in ulp of T over the sweeps of tests/math/test_fast_math.cpp
+		// (float / double):
+		//
+		//              low              medium          high
+		//   rsqrt      3e4 / 2e13       80 / 3e5        2 / 2
+		//   sincos     700 / 4e11       2 / 4e7         2 / 2
+		//   acos       2e3 / 1e12       2 / 5e7         2 / 2
+		//   cbrt       300 / 2e11       3 / 40          3 / 3
+		//   exp        700 / 4e11       2 / 1e7         2 / 2
+		//   log        3e3 / 2e12       3 / 6e8         2 / 2
+		//
+		// low is about 1e-3 relative, medium is float precision, high is within a few ulp of T.
+		namespace fast {
+			enum class accuracy { low, medium, high };
+
+			namespace fast_detail {
+				template <typename T>
+				struct ieee;
+
+				template <>
+				struct ieee<float> {
+					using uint = std::uint32_t;
+					using sint = std::int32_t;
+					static constexpr int mantissa = 23, bias = 127;
+				};
+
+				template <>
+				struct ieee<double> {
+					using uint = std::uint64_t;
+					using sint = std::int64_t;
+					static constexpr int mantissa = 52, bias = 1023;
+				};
+
+				template <typename To, typename From>
+				inline To bitCast(const From v) noexcept {
+					static_assert(sizeof(To) == sizeof(From), "Bit cast between different sizes");
+					To r;
+					std::memcpy(&r, &v, sizeof(r));
+					return r;
+				}
+
+				// c[0] + c[1] * x + ... + c[K - 1] * x^(K - 1), Horner scheme
+				template <typename T, size_t K>
+				inline T poly(const T x, const double (&c)[K]) noexcept {
+					T r = T(c[K - 1]);
+					for (size_t i = K - 1; i-- > 0;) r = r * x + T(c[i]);
+					return r;
+				}
+
+				// Nearest integer of x (ties away from zero), saturated to [-2^30, 2^30] with NaN at
+				// the top so the conversion is always defined. 32 bit for both types: converts in
+				// vector registers without AVX-512
+				template <typename T>
+				inline std::int32_t roundInt(const T x) noexcept {
+					const T limit = T(1 << 30);
+					const T xc = x < limit ? (x > -limit ? x : -limit) : limit;
+					return static_cast<std::int32_t>(xc + std::copysign(T(0.5), xc));
+				}
+
+				// v * 2^k for k in [-2 * bias + 2, 2 * bias]: two normal powers, so a subnormal
+				// result is rounded once
+				template <typename T>
+				inline T scale(const T v, const std::int32_t k) noexcept {
+					using U = typename ieee<T>::uint;
+					const std::int32_t h = k / 2;
+					const T a = bitCast<T>(U(h + ieee<T>::bias) << ieee<T>::mantissa);
+					const T b = bitCast<T>(U(k - h + ieee<T>::bias) << ieee<T>::mantissa);
+					return v * a * b;
+				}
+
+				// Minimax fits of sin(r) = r + r z P(z), cos(r) = 1 - z / 2 + z^2 Q(z) (z = r^2,
+				// |r| <= pi / 4) and asin(s) = s + s z R(z) (z = s^2, s <= 0.5): F for float and
+				// medium, D and the rational Num / Den for double high. Shared with the batch kernels
+				static constexpr double sinF[] = {-1.6666654611e-1, 8.3321608736e-3, -1.9515295891e-4};
+				static constexpr double cosF[] = {
+				    4.166664568298827e-2, -1.388731625493765e-3, 2.443315711809948e-5};
+				static constexpr double sinD[] = {-1.66666666666666307295e-1, 8.33333333332211858878e-3,
+				    -1.98412698295895385996e-4, 2.75573136213857245213e-6, -2.50507477628578072866e-8,
+				    1.58962301576546568060e-10};
+				static constexpr double cosD[] = {4.16666666666665929218e-2, -1.38888888888730564116e-3,
+				    2.48015872888517045348e-5, -2.75573141792967388112e-7, 2.08757008419747316778e-9,
+				    -1.13585365213876817300e-11};
+				static constexpr double asinF[] = {1.6666752422e-1, 7.4953002686e-2, 4.5470025998e-2,
+				    2.4181311049e-2, 4.2163199048e-2};
+				static constexpr double asinNum[] = {1.66666666666666657415e-1, -3.25565818622400915405e-1,
+				    2.01212532134862925881e-1, -4.00555345006794114027e-2, 7.91534994289814532176e-4,
+				    3.47933107596021167570e-5};
+				static constexpr double asinDen[] = {1.0, -2.40339491173441421878e+0,
+				    2.02094576023350569471e+0, -6.88283971605453293030e-1, 7.70381505559019352791e-2};
+
+				// Types of the approximations
+				template <typename T>
+				struct supported : std::integral_constant<bool,
+				    std::is_same<T, float>::value || std::is_same<T, double>::value> {};
+
+				template <typename T>
+				inline void requireFloat() noexcept {
+					static_assert(supported<T>::value, "vtx::math::fast supports float and double");
+				}
+			}  // namespace fast_detail
+
+			// 1 / sqrt(x), x > 0. Bit trick seed refined by Newton steps (1, 2 | 3 for double);
+			// high is the exact division, which is as fast as extra steps on current CPUs
+			template <accuracy A = accuracy::high, typename T>
+			inline T rsqrt(const T x) noexcept {
+				fast_detail::requireFloat<T>();
+				if VTX_CONSTEXPR_IF (A == accuracy::high) return T(1) / std::sqrt(x);
+
+				using U = typename fast_detail::ieee<T>::uint;
+				const U magic = sizeof(T) == 4 ? U(0x5F375A86u) : U(0x5FE6EB50C7B537A9ull);
+				T y = fast_detail::bitCast<T>(U(magic - (fast_detail::bitCast<U>(x) >> 1)));
+				const T h = T(0.5) * x;
+				const int steps = A == accuracy::low ? 1 : (sizeof(T) == 4 ? 2 : 3);
+				for (int i = 0; i < steps; ++i) y = y * (T(1.5) - h * y * y);
+				return y;
+			}
+
+			// Sine and cosine of one argument. Cody-Waite reduction to |r| <= pi / 4 (accurate
+			// for |x| below 1e5, meaningless but defined past 2^30 * pi / 2 where the quadrant
+			// saturates), then polynomials for sin(r), cos(r) and a quadrant swap
+			template <accuracy A = accuracy::high, typename T>
+			inline void sincos(const T x, T &s, T &c) noexcept {
+				fast_detail::requireFloat<T>();
+				const bool single = sizeof(T) == 4;
+				const auto q = fast_detail::roundInt(x * T(2 / PI));
+				// float reduces in double: exact products up to |x| ~ 1e6 without a fourth part
+				const double k = double(q);
+				const T r = single ? T((double(x) - k * 1.57079632673412561417) - k * 6.07710050650619224932e-11)
+				                   : T(((double(x) - k * 1.57079625129699707031) - k * 7.54978941586159635336e-8) -
+				                         k * 5.39030285815811905290e-15);
+				const T z = r * r;
+
+				// Taylor terms for low, minimax fits (fast_detail) for medium and high
+				static constexpr double sinLow[] = {-1.0 / 6, 1.0 / 120};
+				static constexpr double cosLow[] = {1.0 / 24, -1.0 / 720};
+
+				T ps, pc;
+				if VTX_CONSTEXPR_IF (A == accuracy::low) {
+					ps = fast_detail::poly(z, sinLow);
+					pc = fast_detail::poly(z, cosLow);
+				} else if (A == accuracy::medium || single) {
+					ps = fast_detail::poly(z, fast_detail::sinF);
+					pc = fast_detail::poly(z, fast_detail::cosF);
+				} else {
+					ps = fast_detail::poly(z, fast_detail::sinD);
+					pc = fast_detail::poly(z, fast_detail::cosD);
+				}
+				const T sr = r + r * z * ps;
+				const T cr = (T(1) - T(0.5) * z) + z * z * pc;
+
+				// x = q * pi / 2 + r: odd quadrants swap, quadrants 2, 3 negate sin, 1, 2 negate cos
+				const bool odd = (q & 1) != 0;
+				const T sv = odd ? cr : sr, cv = odd ? sr : cr;
+				s = (q & 2) != 0 ? -sv : sv;
+				c = ((q + 1) & 2) != 0 ? -cv : cv;
+			}
+
+			template <accuracy A = accuracy::high, typename T>
+			inline T sin(const T x) noexcept {
+				T s, c;
+				sincos<A>(x, s, c);
+				return s;
+			}
+
+			template <accuracy A = accuracy::high, typename T>
+			inline T cos(const T x) noexcept {
+				T s, c;
+				sincos<A>(x, s, c);
+				return c;
+			}
+
+			// Arc cosine, x in [-1, 1] (NaN outside). asin polynomial on [0, 0.5]; above 0.5
+			// acos(x) = 2 asin(sqrt((1 - x) / 2))
+			template <accuracy A = accuracy::high, typename T>
+			inline T acos(const T x) noexcept {
+				fast_detail::requireFloat<T>();
+				const T a = std::fabs(x);
+				const bool big = a > T(0.5);
+				const T zBig = (T(1) - a) * T(0.5), zSmall = a * a;
+				const T z = big ? zBig : zSmall;
+				const T root = std::sqrt(z);
+				const T s = big ? root : a;
+
+				// asin(s) = s + s * z * R(z)
+				static constexpr double low[] = {1.0 / 6, 3.0 / 40, 15.0 / 336};
+
+				T rz;
+				if VTX_CONSTEXPR_IF (A == accuracy::low)
+					rz = fast_detail::poly(z, low);
+				else if (A == accuracy::medium || sizeof(T) == 4)
+					rz = fast_detail::poly(z, fast_detail::asinF);
+				else
+					rz = fast_detail::poly(z, fast_detail::asinNum) /
+					    fast_detail::poly(z, fast_detail::asinDen);
+				const T p = s + s * z * rz;
+
+				const T halfPi = T(PI / 2);
+				const T twoP = T(2) * p;
+				const T pos = big ? twoP : halfPi - p;
+				const T neg = big ? T(PI) - twoP : halfPi + p;
+				return x < T(0) ? neg : pos;
+			}
+
+			// Cube root of any finite x. Bit trick seed (exponent / 3) refined by Halley steps
+			// (cubic convergence): 1 for low, 2 for medium and float high, 3 for double high
+			template <accuracy A = accuracy::high, typename T>
+			inline T cbrt(const T x) noexcept {
+				fast_detail::requireFloat<T>();
+				using U = typename fast_detail::ieee<T>::uint;
+				const T a = std::fabs(x);
+				// Seed from the high 32 bits (a 32 bit division vectorizes, a 64 bit one does not)
+				const unsigned shift = sizeof(T) == 4 ? 0u : 32u;
+				const auto high = static_cast<std::uint32_t>(fast_detail::bitCast<U>(a) >> shift);
+				const std::uint32_t magic = sizeof(T) == 4 ? 0x2A5137A0u : 0x2A9F7893u;
+				T y = fast_detail::bitCast<T>(U(high / 3 + magic) << shift);
+
+				const int steps = A == accuracy::low ? 1 : (A == accuracy::high && sizeof(T) == 8 ? 3 : 2);
+				for (int i = 0; i < steps; ++i) {
+					const T y3 = y * y * y;
+					y = y * (y3 + T(2) * a) / (T(2) * y3 + a);
+				}
+				y = a == T(0) || !(a <= std::numeric_limits<T>::max()) ? a : y;
+				return x < T(0) ? -y : y;
+			}
+
+			// e^x. x = k ln2 + r, |r| <= ln2 / 2, polynomial for e^r, scaled by 2^k.
+			// Overflows to infinity, underflows through subnormals to 0
+			template <accuracy A = accuracy::high, typename T>
+			inline T exp(const T x) noexcept {
+				fast_detail::requireFloat<T>();
+				const bool single = sizeof(T) == 4;
+				// Clamped just outside the finite range: the scaling itself gives infinity and 0
+				const T maxArg = T(single ? 89 : 710), minArg = T(single ? -110 : -750);
+				const T xc = x < maxArg ? (x > minArg ? x : minArg) : maxArg;
+
+				const auto q = fast_detail::roundInt(xc * T(1.4426950408889634));
+				const T k = T(q);
+				const T r = (xc - k * T(single ? 0.693359375 : 6.93145751953125e-1)) -
+				    k * T(single ? -2.12194440e-4 : 1.42860682030941723212e-6);
+
+				// e^r = 1 + r + r^2 * P(r)
+				static constexpr double low[] = {1.0 / 2, 1.0 / 6, 1.0 / 24};
+				static constexpr double medium[] = {5.0000001201e-1, 1.6666665459e-1, 4.1665795894e-2,
+				    8.3334519073e-3, 1.3981999507e-3, 1.9875691500e-4};
+				static constexpr double high[] = {1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720,
+				    1.0 / 5040, 1.0 / 40320, 1.0 / 362880, 1.0 / 3628800, 1.0 / 39916800,
+				    1.0 / 479001600, 1.0 / 6227020800};
+
+				T p;
+				if VTX_CONSTEXPR_IF (A == accuracy::low)
+					p = fast_detail::poly(r, low);
+				else if (A == accuracy::medium || single)
+					p = fast_detail::poly(r, medium);
+				else
+					p = fast_detail::poly(r, high);
+				const T e = fast_detail::scale(T(1) + r + r * r * p, q);
+
+				// NaN went to maxArg above, add it back
+				const T nan = x != x ? x : T(0);
+				return e + nan;
+			}
+
+			// Natural logarithm. x = 2^e * m, m in [sqrt(2) / 2, sqrt(2)),
+			// log(m) = 2 atanh(s) with s = (m - 1) / (m + 1) as an odd series in s.
+			// log(0) = -inf, negative x gives NaN, log(inf) = inf
+			template <accuracy A = accuracy::high, typename T>
+			inline T log(const T x) noexcept {
+				fast_detail::requireFloat<T>();
+				using I = fast_detail::ieee<T>;
+				using U = typename I::uint;
+				using L = std::numeric_limits<T>;
+				const bool single = sizeof(T) == 4;
+
+				// Subnormals: scale into the normal range first
+				const bool sub = x < L::min();
+				const T scaled = x * T(single ? 16777216.0 : 18014398509481984.0);
+				const T xs = sub ? scaled : x;
+				const U bits = fast_detail::bitCast<U>(xs);
+				auto e = static_cast<std::int32_t>((bits >> I::mantissa) & U(2 * I::bias + 1)) - I::bias -
+				    (sub ? (single ? 24 : 54) : 0);
+				T m = fast_detail::bitCast<T>(
+				    U((bits & ((U(1) << I::mantissa) - 1)) | (U(I::bias) << I::mantissa)));
+				const bool high = m > T(1.4142135623730951);
+				const T half = m * T(0.5);
+				m = high ? half : m;
+				e += high ? 1 : 0;
+
+				const T f = m - T(1);
+				const T s = f / (T(2) + f), z = s * s;
+
+				// log(m) = 2s + 2s * z * P(z), P = 1/3 + z/5 + z^2/7 ...
+				static constexpr double low[] = {1.0 / 3};
+				static constexpr double medium[] = {1.0 / 3, 1.0 / 5, 1.0 / 7};
+				static constexpr double highF[] = {1.0 / 3, 1.0 / 5, 1.0 / 7, 1.0 / 9};
+				static constexpr double highD[] = {1.0 / 3, 1.0 / 5, 1.0 / 7, 1.0 / 9, 1.0 / 11,
+				    1.0 / 13, 1.0 / 15, 1.0 / 17, 1.0 / 19, 1.0 / 21};
+
+				T p;
+				if VTX_CONSTEXPR_IF (A == accuracy::low)
+					p = fast_detail::poly(z, low);
+				else if (A == accuracy::medium)
+					p = fast_detail::poly(z, medium);
+				else if (single)
+					p = fast_detail::poly(z, highF);
+				else
+					p = fast_detail::poly(z, highD);
+				const T ek = T(e);
+				const T logm = T(2) * s + T(2) * s * z * p;
+				const T result = ek * T(single ? 0.693359375 : 6.93145751953125e-1) +
+				    (logm + ek * T(single ? -2.12194440e-4 : 1.42860682030941723212e-6));
+
+				const T special = x == T(0) ? -L::infinity() : (x == L::infinity() ? x : L::quiet_NaN());
+				return x > T(0) && x < L::infinity() ? result : special;
+			}
+		}  // namespace fast
+
+		// Functions used by the hot paths of the core types (see VTX_FAST_MATH above)
+		namespace policy {
+			namespace policy_detail {
+				// The approximations for float and double, std:: for the other types (integers,
+				// long double), which keep the path they had without VTX_FAST_MATH
+				template <typename T, bool = fast::fast_detail::supported<T>::value>
+				struct runtime {
+					static T rsqrt(const T x) noexcept { return T(1) / std::sqrt(x); }
+
+					template <typename X>
+					static void sincos(const X x, T &s, T &c) noexcept {
+						s = T(std::sin(x));
+						c = T(std::cos(x));
+					}
+
+					static T sin(const T x) noexcept { return std::sin(x); }
+					static T cos(const T x) noexcept { return std::cos(x); }
+					static T acos(const T x) noexcept { return std::acos(x); }
+					static T cbrt(const T x) noexcept { return std::cbrt(x); }
+				};
+
+				template <typename T>
+				struct runtime<T, true> {
+					static constexpr fast::accuracy A = fast::accuracy::VTX_FAST_MATH_ACCURACY;
+
+					static T rsqrt(const T x) noexcept { return fast::rsqrt<A>(x); }
+
+					template <typename X>
+					static void sincos(const X x, T &s, T &c) noexcept { fast::sincos<A>(T(x), s, c); }
+
+					static T sin(const T x) noexcept { return fast::sin<A>(x); }
+					static T cos(const T x) noexcept { return fast::cos<A>(x); }
+					static T acos(const T x) noexcept { return fast::acos<A>(x); }
+					static T cbrt(const T x) noexcept { return fast::cbrt<A>(x); }
+				};
+			}  // namespace policy_detail
+
+			template <typename T>
+			constexpr T rsqrt(const T x) noexcept {
+#ifdef VTX_FAST_MATH
+				if (!VTX_IS_CONSTANT_EVALUATED()) return policy_detail::runtime<T>::rsqrt(x);
+#endif // VTX_FAST_MATH
+				return T(1) / std::sqrt(x);
+			}
+
+			// v / |v| from the squared length sq of v (nonzero): multiplied by rsqrt() for float and
+			// double under VTX_FAST_MATH, divided by the length otherwise. Shared by the vector classes
+			template <typename V, typename T>
+			constexpr V normalized(const V &v, const T sq) noexcept {
+#ifdef _DEBUG
+				assert(sq != T(0));
+#endif // _DEBUG
+#ifdef VTX_FAST_MATH
+				if (fast::fast_detail::supported<T>::value) return v * rsqrt(sq);
+#endif // VTX_FAST_MATH
+				return v / T(std::sqrt(sq));
+			}
+
+			// The argument may be wider than the results (degrees to radians in double)
+			template <typename X, typename T>
+			constexpr void sincos(const X x, T &s, T &c) noexcept {
+#ifdef VTX_FAST_MATH
+				if (!VTX_IS_CONSTANT_EVALUATED()) {
+					policy_detail::runtime<T>::sincos(x, s, c);
+					return;
+				}
+#endif // VTX_FAST_MATH
+				s = T(std::sin(x));
+				c = T(std::cos(x));
+			}
+
+			template <typename T>
+			constexpr T sin(const T x) noexcept {
+#ifdef VTX_FAST_MATH
+				if (!VTX_IS_CONSTANT_EVALUATED()) return policy_detail::runtime<T>::sin(x);
+#endif // VTX_FAST_MATH
+				return std::sin(x);
+			}
+
+			template <typename T>
+			constexpr T cos(const T x) noexcept {
+#ifdef VTX_FAST_MATH
+				if (!VTX_IS_CONSTANT_EVALUATED()) return policy_detail::runtime<T>::cos(x);
+#endif // VTX_FAST_MATH
+				return std::cos(x);
+			}
+
+			template <typename T>
+			constexpr T acos(const T x) noexcept {
+#ifdef VTX_FAST_MATH
+				if (!VTX_IS_CONSTANT_EVALUATED()) return policy_detail::runtime<T>::acos(x);
+#endif // VTX_FAST_MATH
+				return std::acos(x);
+			}
+
+			template <typename T>
+			constexpr T cbrt(const T x) noexcept {
+#ifdef VTX_FAST_MATH
+				if (!VTX_IS_CONSTANT_EVALUATED()) return policy_detail::runtime<T>::cbrt(x);
+#endif // VTX_FAST_MATH
+				return std::cbrt(x);
+			}
+		}  // namespace policy
+	}  // namespace math
+}  // namespace vtx
+
+#endif  // VECTRIX_FAST_H
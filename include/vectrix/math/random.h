@@ -5,39 +5,364 @@
 #ifndef VECTRIX_RANDOM_H
 #define VECTRIX_RANDOM_H
 
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
 #include "vectrix/core/vectrix_core.h"
+#include "vectrix/parallel/parallel_for.h"
+#include "vectrix/simd/dispatch.h"
+
+#define VTX_SIMD_KERNELS "vectrix/math/detail/random_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
 
 namespace vtx {
     namespace random {
 
-        // Set universal-limited random float-point vector
-        template<typename T, size_t N>
-        typename std::enable_if<std::is_floating_point<T>::value, vtx::vector<T, N>>::type
-        vector( T min, T max ) {
-            static_assert(std::is_arithmetic_v<T>, "T must be arithmetic for random_vector!");
-            static thread_local std::mt19937 gen(std::random_device{}());
+        //*************************************
+        // Engines
+        //*************************************
+        // All engines model UniformRandomBitGenerator, so they work with <random> distributions too.
+
+        // SplitMix64 step: expands one 64-bit seed into well mixed state words
+        inline std::uint64_t splitmix64( std::uint64_t &state ) noexcept {
+            std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        // xoshiro256++: 32 bytes of state, period 2^256 - 1, the fastest general purpose engine here.
+        // jump() advances by 2^128 draws: engines jumped 0, 1, 2... times from one seed give
+        // non-overlapping sequences for parallel use.
+        class xoshiro256pp {
+        public:
+            using result_type = std::uint64_t;
+
+            static constexpr result_type min( ) noexcept { return 0; }
+            static constexpr result_type max( ) noexcept { return std::numeric_limits<result_type>::max(); }
+
+            // State from seed through SplitMix64 (never all zero)
+            explicit xoshiro256pp( std::uint64_t seed = 0x853C49E6748FEA9Bull ) noexcept {
+                for (auto &w : s)
+                    w = splitmix64(seed);
+            }
+
+            result_type operator()( ) noexcept {
+                const std::uint64_t result = rotl(s[0] + s[3], 23) + s[0];
+                const std::uint64_t t = s[1] << 17;
+                s[2] ^= s[0];
+                s[3] ^= s[1];
+                s[1] ^= s[2];
+                s[0] ^= s[3];
+                s[2] ^= t;
+                s[3] = rotl(s[3], 45);
+                return result;
+            }
+
+            // Advance by 2^128 draws
+            void jump( ) noexcept {
+                static constexpr std::uint64_t poly[] = {
+                        0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull
+                };
+                advance(poly);
+            }
+
+            // Advance by 2^192 draws (2^64 starting points, each with room for 2^64 jump()s)
+            void longJump( ) noexcept {
+                static constexpr std::uint64_t poly[] = {
+                        0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull
+                };
+                advance(poly);
+            }
+
+            void discard( unsigned long long n ) noexcept {
+                for (; n > 0; --n)
+                    (*this)();
+            }
+
+            friend bool operator==( const xoshiro256pp &a, const xoshiro256pp &b ) noexcept {
+                return std::memcmp(a.s, b.s, sizeof(a.s)) == 0;
+            }
+            friend bool operator!=( const xoshiro256pp &a, const xoshiro256pp &b ) noexcept { return !(a == b); }
+
+        private:
+            std::uint64_t s[4];
+
+            static std::uint64_t rotl( const std::uint64_t x, const int k ) noexcept {
+                return (x << k) | (x >> (64 - k));
+            }
+
+            // Multiply state by jump polynomial
+            void advance( const std::uint64_t (&poly)[4] ) noexcept {
+                std::uint64_t r[4] = {};
+                for (const std::uint64_t word : poly)
+                    for (int b = 0; b < 64; ++b) {
+                        if (word & (std::uint64_t(1) << b))
+                            for (int i = 0; i < 4; ++i)
+                                r[i] ^= s[i];
+                        (*this)();
+                    }
+                std::memcpy(s, r, sizeof(s));
+            }
+        };
+
+        // PCG32 (XSH RR 64/32): 16 bytes of state, 2^63 independent streams selected by 'stream',
+        // O(log n) skip ahead with advance().
+        class pcg32 {
+        public:
+            using result_type = std::uint32_t;
+
+            static constexpr result_type min( ) noexcept { return 0; }
+            static constexpr result_type max( ) noexcept { return std::numeric_limits<result_type>::max(); }
+
+            explicit pcg32( const std::uint64_t seed = 0x853C49E6748FEA9Bull, const std::uint64_t stream = 0 ) noexcept
+                    : state(0), inc((stream << 1) | 1) {
+                (*this)();
+                state += seed;
+                (*this)();
+            }
+
+            result_type operator()( ) noexcept {
+                const std::uint64_t old = state;
+                state = old * MULT + inc;
+                const auto xorshifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+                const auto rot = static_cast<std::uint32_t>(old >> 59);
+                return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+            }
+
+            // Skip 'delta' draws in O(log delta)
+            void advance( std::uint64_t delta ) noexcept {
+                std::uint64_t mult = MULT, plus = inc, accMult = 1, accPlus = 0;
+                for (; delta > 0; delta >>= 1) {
+                    if (delta & 1) {
+                        accMult *= mult;
+                        accPlus = accPlus * mult + plus;
+                    }
+                    plus = (mult + 1) * plus;
+                    mult *= mult;
+                }
+                state = accMult * state + accPlus;
+            }
+
+            void discard( const unsigned long long n ) noexcept { advance(n); }
+
+            friend bool operator==( const pcg32 &a, const pcg32 &b ) noexcept {
+                return a.state == b.state && a.inc == b.inc;
+            }
+            friend bool operator!=( const pcg32 &a, const pcg32 &b ) noexcept { return !(a == b); }
+
+        private:
+            static constexpr std::uint64_t MULT = 6364136223846793005ull;
+            std::uint64_t state, inc;
+        };
+
+        // Philox4x32-10: counter-based engine, output block n is a pure function of
+        // (seed, stream, n). Streams and positions are free to pick, discard() is O(1), and
+        // bulk fills split across threads reproduce the single thread output exactly.
+        class philox4x32 {
+        public:
+            using result_type = std::uint32_t;
+
+            static constexpr result_type min( ) noexcept { return 0; }
+            static constexpr result_type max( ) noexcept { return std::numeric_limits<result_type>::max(); }
+
+            explicit philox4x32( const std::uint64_t seed = 0, const std::uint64_t stream = 0 ) noexcept
+                    : key{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)},
+                      streamId(stream), counter(0), buffer{}, index(4) {}
+
+            result_type operator()( ) noexcept {
+                if (index == 4) {
+                    const std::uint32_t c[4] = {
+                            static_cast<std::uint32_t>(counter), static_cast<std::uint32_t>(counter >> 32),
+                            static_cast<std::uint32_t>(streamId), static_cast<std::uint32_t>(streamId >> 32)
+                    };
+                    block(c, key, buffer);
+                    ++counter;
+                    index = 0;
+                }
+                return buffer[index++];
+            }
+
+            // Skip n draws in O(1)
+            void discard( const unsigned long long n ) noexcept {
+                const unsigned long long pos = position() + n;
+                counter = pos / 4;
+                index = 4;
+                if (pos % 4 != 0) {
+                    (*this)();
+                    index = static_cast<unsigned>(pos % 4);
+                }
+            }
+
+            // Draws made so far
+            unsigned long long position( ) const noexcept { return counter * 4 - (4 - index); }
+
+            std::uint64_t seed( ) const noexcept { return std::uint64_t(key[1]) << 32 | key[0]; }
+            std::uint64_t stream( ) const noexcept { return streamId; }
+
+            // Philox4x32-10 bijection of counter c under key k
+            static void block( const std::uint32_t (&c)[4], const std::uint32_t (&k)[2],
+                               std::uint32_t (&out)[4] ) noexcept {
+                std::uint32_t x0 = c[0], x1 = c[1], x2 = c[2], x3 = c[3], k0 = k[0], k1 = k[1];
+                for (int r = 0; r < 10; ++r) {
+                    const std::uint64_t p0 = std::uint64_t(0xD2511F53u) * x0;
+                    const std::uint64_t p1 = std::uint64_t(0xCD9E8D57u) * x2;
+                    x0 = static_cast<std::uint32_t>(p1 >> 32) ^ x1 ^ k0;
+                    x1 = static_cast<std::uint32_t>(p1);
+                    x2 = static_cast<std::uint32_t>(p0 >> 32) ^ x3 ^ k1;
+                    x3 = static_cast<std::uint32_t>(p0);
+                    k0 += 0x9E3779B9u;
+                    k1 += 0xBB67AE85u;
+                }
+                out[0] = x0;
+                out[1] = x1;
+                out[2] = x2;
+                out[3] = x3;
+            }
+
+            friend bool operator==( const philox4x32 &a, const philox4x32 &b ) noexcept {
+                return a.seed() == b.seed() && a.streamId == b.streamId && a.position() == b.position();
+            }
+            friend bool operator!=( const philox4x32 &a, const philox4x32 &b ) noexcept { return !(a == b); }
+
+        private:
+            std::uint32_t key[2];
+            std::uint64_t streamId, counter;
+            std::uint32_t buffer[4];
+            unsigned index;
+        };
+
+        // Engine of the calls without an explicit engine (one per thread, seeded from random_device)
+        inline xoshiro256pp &threadEngine( ) {
+            static thread_local xoshiro256pp engine(
+                    std::uint64_t(std::random_device{}()) << 32 ^ std::random_device{}());
+            return engine;
+        }
+
+        //*************************************
+        // Uniform values
+        //*************************************
+
+        // 64 random bits (two draws of 32-bit engines, low word first)
+        template<typename Engine>
+        std::uint64_t bits64( Engine &engine ) {
+            if VTX_CONSTEXPR_IF (std::numeric_limits<typename Engine::result_type>::digits >= 64)
+                return static_cast<std::uint64_t>(engine());
+            const std::uint64_t lo = static_cast<std::uint32_t>(engine());
+            return std::uint64_t(static_cast<std::uint32_t>(engine())) << 32 | lo;
+        }
+
+        // 32 random bits (top bits of wider engines)
+        template<typename Engine>
+        std::uint32_t bits32( Engine &engine ) {
+            constexpr int shift = std::numeric_limits<typename Engine::result_type>::digits - 32;
+            return static_cast<std::uint32_t>(static_cast<std::uint64_t>(engine()) >> (shift > 0 ? shift : 0));
+        }
+
+        // Uniform float in [0, 1): top 23 bits of one draw
+        template<typename Engine>
+        float unitFloat( Engine &engine ) {
+            const std::uint32_t bits = (bits32(engine) >> 9) | 0x3F800000u;
+            float f;
+            std::memcpy(&f, &bits, sizeof(f));
+            return f - 1.0f;
+        }
+
+        // Uniform double in [0, 1): top 52 bits of 64
+        template<typename Engine>
+        double unitDouble( Engine &engine ) {
+            const std::uint64_t bits = (bits64(engine) >> 12) | 0x3FF0000000000000ull;
+            double f;
+            std::memcpy(&f, &bits, sizeof(f));
+            return f - 1.0;
+        }
+
+        // Uniform real value in [min, max)
+        template<typename T, typename Engine>
+        typename std::enable_if<std::is_floating_point<T>::value, T>::type
+        uniform( Engine &engine, const T min, const T max ) {
+            if VTX_CONSTEXPR_IF (sizeof(T) <= sizeof(float))
+                return min + (max - min) * T(unitFloat(engine));
+            return min + (max - min) * T(unitDouble(engine));
+        }
+
+        // Uniform integer value in [min, max], unbiased (rejection of the short last interval)
+        template<typename T, typename Engine>
+        typename std::enable_if<std::is_integral<T>::value, T>::type
+        uniform( Engine &engine, const T min, const T max ) {
+            const std::uint64_t range = std::uint64_t(max) - std::uint64_t(min) + 1;
+            if (range == 0)
+                return static_cast<T>(bits64(engine));
+            const std::uint64_t threshold = (0 - range) % range;
+            std::uint64_t r = bits64(engine);
+            while (r < threshold)
+                r = bits64(engine);
+            return static_cast<T>(std::uint64_t(min) + r % range);
+        }
+
+        //*************************************
+        // Random vectors
+        //*************************************
+
+        // Random vector with components uniform in [min, max) (real) or [min, max] (integer)
+        template<typename T, size_t N, typename Engine>
+        vtx::vector<T, N> vector( Engine &engine, const T min, const T max ) {
+            static_assert(std::is_arithmetic<T>::value, "T must be arithmetic for random_vector!");
 
             vtx::vector<T, N> result;
-            std::uniform_real_distribution<T> dist(min, max);
             for (size_t i = 0; i < N; ++i)
-                result[i] = dist(gen);
-
+                result[i] = uniform<T>(engine, min, max);
             return result;
         }
 
-        // Set universal-limited random integer vector
+        // Set universal-limited random vector (per-thread engine)
         template<typename T, size_t N>
-        typename std::enable_if<std::is_integral<T>::value, vtx::vector<T, N>>::type
-        vector( T min, T max ) {
-            static_assert(std::is_arithmetic_v<T>, "T must be arithmetic for random_vector!");
-            static thread_local std::mt19937 gen(std::random_device{}());
+        vtx::vector<T, N> vector( const T min, const T max ) {
+            return vector<T, N>(threadEngine(), min, max);
+        }
 
-            vtx::vector<T, N> result;
-            std::uniform_int_distribution<T> dist(min, max);
-            for (size_t i = 0; i < N; ++i)
-                result[i] = dist(gen);
+        //*************************************
+        // Bulk fill
+        //*************************************
+        // Components come from philox4x32(seed, stream) in draw order: component c of out[i] is
+        // value i * N + c, made of draw i * N + c for float and of draws 2 (i * N + c) (low word)
+        // and 2 (i * N + c) + 1 for double, computed from its counter alone. Output does not
+        // depend on the policy or thread count, and fill(out + k, ..., k) continues fill(out, ...)
+        // exactly.
+        // Philox rounds run in SIMD lanes of the active backend.
 
-            return result;
+        // Elements per task when a fill is split across threads
+        constexpr size_t FILL_GRAIN = 16384;
+
+        // Fill count vectors with components uniform in [min, max). 'first' is the index of out[0]
+        // in the stream.
+        template<typename T, size_t N>
+        void fill( vtx::vector<T, N> *out, const size_t count, const T min, const T max,
+                   const std::uint64_t seed, const std::uint64_t stream = 0, const std::uint64_t first = 0,
+                   const parallel::policy pol = parallel::policy::seq ) {
+            static_assert(std::is_floating_point<T>::value, "Bulk fill supports float-point vectors only");
+            static_assert(sizeof(vtx::vector<T, N>) == N * sizeof(T), "Vector components must be packed");
+
+            const auto kernel = simd::select(VTX_SIMD_FN(philoxFill<T>));
+            const auto k0 = static_cast<std::uint32_t>(seed), k1 = static_cast<std::uint32_t>(seed >> 32);
+            T *dst = reinterpret_cast<T *>(out);
+
+            if (pol == parallel::policy::seq) {
+                kernel(k0, k1, stream, first * N, count * N, dst, min, max - min);
+                return;
+            }
+            parallel::parallel_for(0, count, FILL_GRAIN, [&]( const size_t b, const size_t e ) {
+                kernel(k0, k1, stream, (first + b) * N, (e - b) * N, dst + b * N, min, max - min);
+            });
+        }
+
+        template<typename T, size_t N>
+        void fill( std::vector<vtx::vector<T, N>> &out, const T min, const T max, const std::uint64_t seed,
+                   const std::uint64_t stream = 0, const parallel::policy pol = parallel::policy::seq ) {
+            fill(out.data(), out.size(), min, max, seed, stream, 0, pol);
         }
 
     } // namespace random
@@ -5,7 +5,16 @@
 #ifndef VECTRIX_SOLVERS_H
 #define VECTRIX_SOLVERS_H
 
+#include <cstdint>
+#include <limits>
+
 #include "common.h"
+#include "fast.h"
+#include "vectrix/core/base_matrix.h"
+#include "vectrix/simd/dispatch.h"
+
+#define VTX_SIMD_KERNELS "vectrix/math/detail/root_kernels.inl"
+#include "vectrix/simd/foreach_backend.h"
 
 namespace vtx {
     namespace solver {
@@ -42,7 +51,10 @@ namespace vtx {
         {
             constexpr T Rev2 = T(0.5), Rev3 = T(1.0 / 3);
             if (VTX_UNLIKELY(A == 0))
-                return Square(B, C, D);
+            {
+                const auto sq = Square(B, C, D);
+                return {{sq.first[0], sq.first[1]}, sq.second};
+            }
 
             std::pair<std::array<T, 3>, size_t> ans;
             const T
@@ -55,70 +67,276 @@ namespace vtx {
             {
                 const T
                     gamma = vtx::math::sqrt(DNew),
-                    alpha = vtx::math::cbrt(-q * Rev2 + gamma),
-                    beta = vtx::math::cbrt(-q * Rev2 - gamma);
+                    alpha = vtx::math::policy::cbrt(-q * Rev2 + gamma),
+                    beta = vtx::math::policy::cbrt(-q * Rev2 - gamma);
                 ans = {{(alpha + beta) - B3A}, 1};
             }
             else if (DNew == 0)
             {
-                const T alpha = vtx::math::cbrt(-q * Rev2);
+                const T alpha = vtx::math::policy::cbrt(-q * Rev2);
                 ans = {{2 * alpha - B3A, (-alpha) - B3A}, 2};
             }
             else if (DNew < 0)
             {
                 const T
                     r = vtx::math::sqrt(-(p * p * p) / 27),
-                    phi = vtx::math::acos(-q / (2 * r)),
+                    phi = vtx::math::policy::acos(-q / (2 * r)),
                     sqrt2p3 = 2 * vtx::math::sqrt(-p * Rev3);
 
                 ans = {{
-                    sqrt2p3 * vtx::math::cos(phi * Rev3) - B3A,
-                    sqrt2p3 * vtx::math::cos((phi + 2 * vtx::math::PI) * Rev3) - B3A,
-                    sqrt2p3 * vtx::math::cos((phi + 4 * vtx::math::PI) * Rev3) - B3A
+                    sqrt2p3 * vtx::math::policy::cos(phi * Rev3) - B3A,
+                    sqrt2p3 * vtx::math::policy::cos((phi + T(2 * vtx::math::PI)) * Rev3) - B3A,
+                    sqrt2p3 * vtx::math::policy::cos((phi + T(4 * vtx::math::PI)) * Rev3) - B3A
                 }, 3};
             }
 
             return ans;
         }
 
+        // Kind of linear system solution
+        enum class solution_kind {
+            none,       // inconsistent system (some right-hand side has no solution)
+            unique,     // full rank
+            infinite,   // rank deficient: particular solution + nullspace
+        };
+
+        // Result of linSystem for N unknowns and K right-hand sides
+        template<typename T, size_t N, size_t K>
+        struct lin_solution {
+            solution_kind kind = solution_kind::none;
+
+            // Rank of A
+            size_t rank = 0;
+
+            // Largest / smallest pivot magnitude: cheap lower estimate of the condition number
+            // (infinity if A is singular)
+            T condition = T(0);
+
+            // Solution columns (with free unknowns set to zero if not unique)
+            matrix<T, N, K> x;
+
+            // First N - rank columns span the nullspace of A
+            matrix<T, N, N> nullspace;
+
+            // Solution exists
+            constexpr explicit operator bool( ) const noexcept {
+                return kind != solution_kind::none;
+            }
+
+            // Nullspace dimension
+            constexpr size_t nullity( ) const noexcept {
+                return N - rank;
+            }
+
+            // Solution of right-hand side k
+            constexpr vector<T, N> solution( const size_t k = 0 ) const noexcept {
+                vector<T, N> v;
+                for (size_t i = 0; i < N; ++i)
+                    v[i] = x[i][k];
+                return v;
+            }
+
+            // Nullspace basis vector i (i < nullity())
+            constexpr vector<T, N> basis( const size_t i ) const noexcept {
+                vector<T, N> v;
+                for (size_t r = 0; r < N; ++r)
+                    v[r] = nullspace[r][i];
+                return v;
+            }
+        };
+
+        // Batch square equation solver over coefficient streams (SoA): for i < n solves
+        // A[i]x^2 + B[i]x + C[i] = 0 into root0[i], root1[i] and count[i].
+        // SIMD lanes evaluate every case and select with masks (no branches to mispredict).
+        // Unused roots are 0. Roots match Square() within a few ulp (relative to the larger
+        // root); counts can differ only for discriminants within rounding of zero.
+        template<typename T>
+        inline void Square( const T *A, const T *B, const T *C, const size_t n,
+                            T *root0, T *root1, std::uint8_t *count ) noexcept
+        {
+            simd::select(VTX_SIMD_FN(squareStream<T>))(A, B, C, n, root0, root1, count);
+        }
+
+        // Batch cubic equation solver over coefficient streams (SoA), as the batch Square.
+        // Cube roots and trigonometry run per lane, everything else in SIMD lanes.
+        // Roots match Cubic() within a few ulp for well separated roots; clustered roots are
+        // ill-conditioned, there the difference stays below 2e-3 (float) / 1e-9 (double)
+        // relative to the largest root magnitude. Counts can differ only for discriminants
+        // within rounding of zero.
+        template<typename T>
+        inline void Cubic( const T *A, const T *B, const T *C, const T *D, const size_t n,
+                           T *root0, T *root1, T *root2, std::uint8_t *count ) noexcept
+        {
+            simd::select(VTX_SIMD_FN(cubicStream<T>))(A, B, C, D, n, root0, root1, root2, count);
+        }
+
+        namespace lin_detail {
+            // Elimination step: pivot of column c moved to row r, column c cleared below it.
+            // Returns |pivot| or 0 if the column has no pivot above tol
+            template<typename T, size_t a, size_t b>
+            constexpr T eliminate( matrix<T, a, b>& m, const size_t r, const size_t c, const T tol ) noexcept {
+                size_t p = r;
+                T best = T(0);
+                for (size_t i = r; i < a; ++i)
+                {
+                    const T v = m[i][c] < T(0) ? -m[i][c] : m[i][c];
+                    if (v > best)
+                    {
+                        best = v;
+                        p = i;
+                    }
+                }
+                if (best <= tol)
+                    return T(0);
+
+                if (p != r)
+                    for (size_t j = c; j < b; ++j)
+                    {
+                        const T t = m[r][j];
+                        m[r][j] = m[p][j];
+                        m[p][j] = t;
+                    }
+
+                const T inv = T(1) / m[r][c];
+                for (size_t i = r + 1; i < a; ++i)
+                {
+                    const T l = m[i][c] * inv;
+                    m[i][c] = T(0);
+                    for (size_t j = c + 1; j < b; ++j)
+                        m[i][j] -= l * m[r][j];
+                }
+                return best;
+            }
+
+            // Back substitution over row echelon form m with 'rank' pivots: x[pivot] from
+            // column rhs (none if rhs == b) and the unknowns to the right of the pivot.
+            // inv holds reciprocal pivots
+            template<typename T, size_t a, size_t b>
+            constexpr void backSubstitute( const matrix<T, a, b>& m, const size_t *pivots, const T *inv,
+                                           const size_t rank, const size_t rhs, T *x ) noexcept {
+                for (size_t i = rank; i-- > 0;)
+                {
+                    const size_t c = pivots[i];
+                    T s = rhs < b ? m[i][rhs] : T(0);
+                    for (size_t j = c + 1; j < a; ++j)
+                        s -= m[i][j] * x[j];
+                    x[c] = s * inv[i];
+                }
+            }
+        } // namespace lin_detail
+
         // Linear equations system solver
-        // Input data is matrix with coefficients
+        // Input data is matrix with coefficients and K = b - a right-hand side columns
         //
         //  {A11*x + A12*y + ... + A1n*z = B1}           | A11  A12  ...  A1n B1 |
         //  {...   + ...   + ... + ...   = ..}  ==>  m = | ...  ...  ...  ... .. |
         //  {An1*x + An2*y + ... + Ann*z = Bn}           | An1  An2  ...  Ann Bn |
         //
-        // Answer is <{array of x, y, ...}, flag if solution exists>
+        // Gaussian elimination with partial pivoting runs in place on the (copied) augmented
+        // matrix: O(a^2 * b), no inverse and no allocations. Pivots not above
+        // eps * a * (largest pivot so far) count as zero.
+        // Homogeneous systems (B = 0) get the trivial solution and a nullspace basis.
         template<typename T, size_t a, size_t b>
-        constexpr std::pair<std::array<T, a>, bool> linSystem( const matrix<T, a, b>& m ) noexcept {
-            static_assert(a == b - 1, "Matrix A must be square (a == b - 1)");
+        constexpr lin_solution<T, a, b - a> linSystem( matrix<T, a, b> m ) noexcept {
+            static_assert(b > a, "Matrix must have at least one right-hand side column (b > a)");
+            static_assert(std::is_floating_point<T>::value, "Linear systems need floating point type");
+            constexpr size_t K = b - a;
 
-            matrix<T, a, b-1> A = m.template block<a, b-1>(0, 0);
-            matrix<T, a, 1> B = m.template block<a, 1>(0, b-1);
+            lin_solution<T, a, K> res;
 
-            const T DetA = A.determinant();
+            const T eps = std::numeric_limits<T>::epsilon() * T(a);
 
-            // Check whether the system of equations is homogeneous
-            bool Bis0 = true;
-            for (const T &el : B)
-                if (el != 0)
-                {
-                    Bis0 = false;
+            // Forward elimination to row echelon form.
+            // While the rank is full pivot row == pivot column (fixed trip counts, fast path)
+            size_t pivots[a] = {};
+            T inv[a] = {};
+            T minPivot = T(0), maxPivot = T(0);
+            size_t r = 0, c = 0;
+            for (; c < a; ++c)
+            {
+                const T piv = lin_detail::eliminate(m, c, c, eps * maxPivot);
+                if (piv == T(0))
                     break;
+                minPivot = c == 0 || piv < minPivot ? piv : minPivot;
+                maxPivot = piv > maxPivot ? piv : maxPivot;
+                inv[c] = T(1) / m[c][c];
+                pivots[c] = c;
+            }
+            r = c;
+
+            // Rank deficient: remaining columns, pivot rows lag behind
+            for (++c; c < a && r < a; ++c)
+            {
+                const T piv = lin_detail::eliminate(m, r, c, eps * maxPivot);
+                if (piv == T(0))
+                    continue;
+                maxPivot = piv > maxPivot ? piv : maxPivot;
+                inv[r] = T(1) / m[r][c];
+                pivots[r++] = c;
+            }
+
+            res.rank = r;
+            res.condition = r == a ? maxPivot / minPivot : std::numeric_limits<T>::infinity();
+
+            // Zero rows of A must have zero right-hand sides
+            res.kind = r == a ? solution_kind::unique : solution_kind::infinite;
+            if (r < a)
+            {
+                T scaleB = maxPivot;
+                for (size_t i = 0; i < a; ++i)
+                    for (size_t k = a; k < b; ++k)
+                        scaleB = vtx::math::max(scaleB, m[i][k] < T(0) ? -m[i][k] : m[i][k]);
+                for (size_t i = r; i < a; ++i)
+                    for (size_t k = a; k < b; ++k)
+                        if (m[i][k] > eps * scaleB || m[i][k] < -eps * scaleB)
+                            res.kind = solution_kind::none;
+            }
+
+            T x[a] = {};
+            if (res.kind != solution_kind::none)
+                for (size_t k = 0; k < K; ++k)
+                {
+                    for (size_t j = 0; j < a; ++j)
+                        x[j] = T(0);
+                    lin_detail::backSubstitute(m, pivots, inv, r, a + k, x);
+                    for (size_t j = 0; j < a; ++j)
+                        res.x[j][k] = x[j];
                 }
 
-            if (Bis0) {
-                if (DetA != 0)
-                    return {{}, false};
-                return {{}, true};  /// TODO: solution for homogeneous system
+            // Nullspace: one basis vector per free unknown (free = 1, other free = 0)
+            size_t n = 0;
+            for (size_t f = 0, i = 0; f < a; ++f)
+            {
+                if (i < r && pivots[i] == f)
+                {
+                    ++i;
+                    continue;
+                }
+                for (size_t j = 0; j < a; ++j)
+                    x[j] = T(0);
+                x[f] = T(1);
+                lin_detail::backSubstitute(m, pivots, inv, r, b, x);
+                for (size_t j = 0; j < a; ++j)
+                    res.nullspace[j][n] = x[j];
+                ++n;
             }
 
-            matrix<T, a, 1> X = A.inverse() * B;
-            if (DetA != 0)
-                return {{X.array()}, true};
-            return {{}, false};
+            return res;
         }
 
+        // Solve A * X = B for K right-hand side columns at once
+        template<typename T, size_t N, size_t K>
+        constexpr lin_solution<T, N, K> linSystem( const matrix<T, N, N>& A, const matrix<T, N, K>& B ) noexcept {
+            matrix<T, N, N + K> m;
+            for (size_t i = 0; i < N; ++i)
+            {
+                for (size_t j = 0; j < N; ++j)
+                    m[i][j] = A[i][j];
+                for (size_t k = 0; k < K; ++k)
+                    m[i][N + k] = B[i][k];
+            }
+            return linSystem(m);
+        }
 
     } // namespace solvers
 } // namespace vtx
@@ -0,0 +1,162 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_PARALLEL_PARALLEL_FOR_H
+#define VECTRIX_PARALLEL_PARALLEL_FOR_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+#include "thread_pool.h"
+#include "vectrix/math/common.h"
+
+namespace vtx {
+	namespace parallel {
+		// Execution policy of batch operations
+		enum class policy {
+			seq,  // calling thread only
+			par,  // split across the default thread pool
+		};
+
+		// Combination order of parallel_reduce
+		enum class reduction {
+			fast,           // partial results combined as they finish
+			deterministic,  // fixed chunks combined left to right (same result for any thread count)
+		};
+
+		// Chunks of a deterministic reduction (fewer if the grain is larger)
+		constexpr size_t REDUCE_CHUNKS = 1024;
+
+		// Run fn(chunkBegin, chunkEnd) over [begin, end) split into chunks of at least
+		// 'grain' indices. The calling thread takes part and returns when every chunk is done.
+		// Chunk sizes adapt to the work left (guided scheduling): every chunk is half of an even
+		// share of the remaining range, rounded down to a multiple of grain, so the first chunks
+		// are large and the last ones small enough to balance the load.
+		// Nested calls from pool threads split too; a waiting thread runs queued tasks meanwhile.
+		// If fn throws, no further chunks are started and the first exception is rethrown on the
+		// calling thread once every running chunk has finished.
+		template <typename F>
+		void parallel_for(
+		    const size_t begin, const size_t end, const size_t grain, F &&fn,
+		    thread_pool &pool = defaultPool()) {
+			if (end <= begin) return;
+			const size_t n = end - begin, g = grain > 0 ? grain : 1;
+			if (pool.size() == 0 || n <= g) {
+				fn(begin, end);
+				return;
+			}
+
+			const size_t threads = pool.size() + 1;
+			std::atomic<size_t> next{begin};
+			std::mutex mutex;
+			std::exception_ptr error;
+			// Keeps the first exception and hands out no more chunks
+			auto fail = [&] {
+				std::lock_guard<std::mutex> lock(mutex);
+				if (!error) error = std::current_exception();
+				next.store(end, std::memory_order_relaxed);
+			};
+			auto run = [&] {
+				try {
+					for (;;) {
+						size_t b = next.load(std::memory_order_relaxed), e;
+						do {
+							if (b >= end) return;
+							const size_t share = (end - b) / (2 * threads);
+							const size_t chunk = share <= g ? g : share / g * g;
+							e = end - b <= chunk ? end : b + chunk;
+						} while (!next.compare_exchange_weak(b, e, std::memory_order_relaxed));
+						fn(b, e);
+					}
+				} catch (...) {
+					fail();
+				}
+			};
+
+			const size_t chunks = (n + g - 1) / g;
+			const size_t helpers = pool.size() < chunks - 1 ? pool.size() : chunks - 1;
+			size_t remaining = helpers;
+			std::condition_variable finished;
+			for (size_t h = 0; h < helpers; ++h) {
+				try {
+					pool.submit([&] {
+						run();
+						std::lock_guard<std::mutex> lock(mutex);
+						if (--remaining == 0) finished.notify_one();
+					});
+				} catch (...) {
+					fail();
+					std::lock_guard<std::mutex> lock(mutex);
+					remaining -= helpers - h;
+					break;
+				}
+			}
+
+			run();
+			// Help with queued tasks (unstarted helpers, nested calls) until the helpers are done:
+			// they use this frame, so it may not unwind before
+			for (;;) {
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					if (remaining == 0) break;
+				}
+				if (pool.tryRunOne()) continue;
+				std::unique_lock<std::mutex> lock(mutex);
+				if (finished.wait_for(lock, std::chrono::microseconds(200), [&] { return remaining == 0; }))
+					break;
+			}
+			if (error) std::rethrow_exception(error);
+		}
+
+		// parallel_for with the grain left to the scheduler (one index minimum)
+		template <typename F>
+		void parallel_for(const size_t begin, const size_t end, F &&fn, thread_pool &pool = defaultPool()) {
+			parallel_for(begin, end, 1, static_cast<F &&>(fn), pool);
+		}
+
+		// Reduce [begin, end): map(chunkBegin, chunkEnd) returns the value of a chunk,
+		// combine(a, b) merges two values, identity is the neutral value of combine.
+		// reduction::deterministic splits the range by its length and the grain alone and combines
+		// the chunks in order, so floating-point results repeat bit for bit on any thread count
+		// (policy::seq included); reduction::fast combines in completion order.
+		template <typename T, typename Map, typename Combine>
+		T parallel_reduce(
+		    const size_t begin, const size_t end, const size_t grain, const T &identity, Map &&map,
+		    Combine &&combine, const reduction mode = reduction::fast, thread_pool &pool = defaultPool()) {
+			if (end <= begin) return identity;
+			const size_t n = end - begin, g = grain > 0 ? grain : 1;
+
+			if (mode == reduction::deterministic) {
+				const size_t minChunk = (n + REDUCE_CHUNKS - 1) / REDUCE_CHUNKS;
+				const size_t chunk = g > minChunk ? g : minChunk, chunks = (n + chunk - 1) / chunk;
+				std::vector<T> partial(chunks, identity);
+				parallel_for(0, chunks, 1, [&](const size_t cb, const size_t ce) {
+					for (size_t c = cb; c < ce; ++c) {
+						const size_t b = begin + c * chunk;
+						partial[c] = map(b, end - b < chunk ? end : b + chunk);
+					}
+				}, pool);
+
+				T result = identity;
+				for (const auto &p : partial) result = combine(result, p);
+				return result;
+			}
+
+			T result = identity;
+			std::mutex mutex;
+			parallel_for(begin, end, g, [&](const size_t b, const size_t e) {
+				const T value = map(b, e);
+				std::lock_guard<std::mutex> lock(mutex);
+				result = combine(result, value);
+			}, pool);
+			return result;
+		}
+	}  // namespace parallel
+}  // namespace vtx
+
+#endif //VECTRIX_PARALLEL_PARALLEL_FOR_H
@@ -0,0 +1,102 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_PARALLEL_RADIX_SORT_H
+#define VECTRIX_PARALLEL_RADIX_SORT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "parallel_for.h"
+
+namespace vtx {
+	namespace parallel {
+		// Keys per chunk of a radix sort pass
+		constexpr size_t RADIX_GRAIN = 65536;
+
+		// Unsigned key ordered as the floating-point value (-0 before +0, NaNs at the ends)
+		inline std::uint32_t radix_key(const float v) noexcept {
+			std::uint32_t bits;
+			std::memcpy(&bits, &v, sizeof(bits));
+			return bits ^ (bits >> 31 ? 0xFFFFFFFFu : 0x80000000u);
+		}
+
+		inline std::uint64_t radix_key(const double v) noexcept {
+			std::uint64_t bits;
+			std::memcpy(&bits, &v, sizeof(bits));
+			return bits ^ (bits >> 63 ? 0xFFFFFFFFFFFFFFFFull : 0x8000000000000000ull);
+		}
+
+		// Stable LSD radix sort of keys with their values, 8 bits per pass. keys and values are
+		// sorted in place, tmpKeys and tmpValues are scratch of n elements.
+		// Every pass counts the digits of fixed chunks of 'grain' keys in parallel, then each chunk
+		// scatters its keys to the offsets of its digits; passes where all keys share the digit
+		// are skipped. The result does not depend on the grain or the thread count
+		// (grain >= n sorts on the calling thread).
+		template <typename K, typename V>
+		void radix_sort(K *keys, V *values, const size_t n, K *tmpKeys, V *tmpValues,
+		    const size_t grain = RADIX_GRAIN, thread_pool &pool = defaultPool()) {
+			static_assert(std::is_unsigned<K>::value, "Radix sort keys must be unsigned integers");
+			constexpr size_t DIGITS = 256;
+			if (n < 2) return;
+			const size_t g = grain > 0 ? grain : 1, chunks = (n + g - 1) / g;
+			std::vector<size_t> offsets(chunks * DIGITS);
+
+			K *srcKeys = keys, *dstKeys = tmpKeys;
+			V *srcValues = values, *dstValues = tmpValues;
+			for (size_t shift = 0; shift < 8 * sizeof(K); shift += 8) {
+				parallel_for(0, chunks, 1, [&](const size_t cb, const size_t ce) {
+					for (size_t c = cb; c < ce; ++c) {
+						size_t *count = offsets.data() + c * DIGITS;
+						std::fill(count, count + DIGITS, size_t(0));
+						const size_t e = n - c * g < g ? n : c * g + g;
+						for (size_t i = c * g; i < e; ++i) ++count[srcKeys[i] >> shift & 0xFF];
+					}
+				}, pool);
+
+				// Digit-major exclusive scan: chunk c of digit d starts after every key of a smaller
+				// digit and after chunks < c of digit d
+				size_t sum = 0;
+				bool single = false;
+				for (size_t d = 0; d < DIGITS && !single; ++d) {
+					size_t total = 0;
+					for (size_t c = 0; c < chunks; ++c) {
+						const size_t count = offsets[c * DIGITS + d];
+						offsets[c * DIGITS + d] = sum;
+						sum += count;
+						total += count;
+					}
+					single = total == n;
+				}
+				if (single) continue;
+
+				parallel_for(0, chunks, 1, [&](const size_t cb, const size_t ce) {
+					for (size_t c = cb; c < ce; ++c) {
+						size_t *offset = offsets.data() + c * DIGITS;
+						const size_t e = n - c * g < g ? n : c * g + g;
+						for (size_t i = c * g; i < e; ++i) {
+							const size_t to = offset[srcKeys[i] >> shift & 0xFF]++;
+							dstKeys[to] = srcKeys[i];
+							dstValues[to] = srcValues[i];
+						}
+					}
+				}, pool);
+				std::swap(srcKeys, dstKeys);
+				std::swap(srcValues, dstValues);
+			}
+
+			if (srcKeys != keys)
+				parallel_for(0, n, g, [&](const size_t b, const size_t e) {
+					std::copy(srcKeys + b, srcKeys + e, keys + b);
+					std::copy(srcValues + b, srcValues + e, values + b);
+				}, pool);
+		}
+	}  // namespace parallel
+}  // namespace vtx
+
+#endif //VECTRIX_PARALLEL_RADIX_SORT_H
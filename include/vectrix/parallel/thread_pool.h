@@ -0,0 +1,161 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_PARALLEL_THREAD_POOL_H
+#define VECTRIX_PARALLEL_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vtx {
+	namespace parallel {
+		// Fixed set of worker threads with a task deque each (work stealing).
+		// A worker runs its own deque newest first (tasks it submitted itself stay in its cache)
+		// and, when that is empty, steals the oldest task of another deque. Tasks submitted from
+		// outside the pool are spread over the deques round robin.
+		class thread_pool {
+		public:
+			// Pool with 'workers' threads (0 - every task runs on the submitting thread)
+			explicit thread_pool(const size_t workers) {
+				queues.reserve(workers);
+				for (size_t i = 0; i < workers; ++i) queues.emplace_back(new task_queue);
+				threads.reserve(workers);
+				for (size_t i = 0; i < workers; ++i) threads.emplace_back([this, i] { workerLoop(i); });
+			}
+
+			thread_pool(const thread_pool &) = delete;
+			thread_pool &operator=(const thread_pool &) = delete;
+
+			~thread_pool() {
+				{
+					std::lock_guard<std::mutex> lock(sleepMutex);
+					stopping = true;
+				}
+				wake.notify_all();
+				for (auto &t : threads) t.join();
+			}
+
+			// Worker threads count
+			size_t size() const noexcept { return threads.size(); }
+
+			// Queue task for execution
+			void submit(std::function<void()> task) {
+				if (threads.empty()) {
+					task();
+					return;
+				}
+
+				const worker_id &self = currentWorker();
+				const size_t q = self.pool == this ? self.index : nextQueue.fetch_add(1) % queues.size();
+				// Counted before it is visible, so 'pending' never drops below the queued tasks
+				pending.fetch_add(1);
+				{
+					std::lock_guard<std::mutex> lock(queues[q]->mutex);
+					queues[q]->tasks.push_back(std::move(task));
+				}
+				{
+					std::lock_guard<std::mutex> lock(sleepMutex);
+				}
+				wake.notify_one();
+			}
+
+			// Run one queued task on the calling thread (its own deque first, then the others).
+			// Threads waiting for their tasks call this to help instead of blocking.
+			// Returns false when every deque is empty.
+			bool tryRunOne() {
+				std::function<void()> task;
+				if (!take(task)) return false;
+				task();
+				return true;
+			}
+
+			// True on threads owned by any pool
+			static bool insideWorker() noexcept { return currentWorker().pool != nullptr; }
+
+		private:
+			struct task_queue {
+				std::mutex mutex;
+				std::deque<std::function<void()>> tasks;
+			};
+
+			struct worker_id {
+				const thread_pool *pool = nullptr;
+				size_t index = 0;
+			};
+
+			std::vector<std::unique_ptr<task_queue>> queues;
+			std::vector<std::thread> threads;
+			std::atomic<size_t> pending{0}, nextQueue{0};
+			std::mutex sleepMutex;
+			std::condition_variable wake;
+			bool stopping = false;
+
+			static worker_id &currentWorker() noexcept {
+				static thread_local worker_id id;
+				return id;
+			}
+
+			bool popBack(task_queue &q, std::function<void()> &task) {
+				std::lock_guard<std::mutex> lock(q.mutex);
+				if (q.tasks.empty()) return false;
+				task = std::move(q.tasks.back());
+				q.tasks.pop_back();
+				pending.fetch_sub(1);
+				return true;
+			}
+
+			bool popFront(task_queue &q, std::function<void()> &task) {
+				std::lock_guard<std::mutex> lock(q.mutex);
+				if (q.tasks.empty()) return false;
+				task = std::move(q.tasks.front());
+				q.tasks.pop_front();
+				pending.fetch_sub(1);
+				return true;
+			}
+
+			bool take(std::function<void()> &task) {
+				const size_t n = queues.size();
+				if (n == 0 || pending.load() == 0) return false;
+
+				const worker_id &self = currentWorker();
+				const bool own = self.pool == this;
+				const size_t first = own ? self.index : 0;
+				if (own && popBack(*queues[first], task)) return true;
+				for (size_t i = own ? 1 : 0; i < n; ++i)
+					if (popFront(*queues[(first + i) % n], task)) return true;
+				return false;
+			}
+
+			void workerLoop(const size_t index) {
+				currentWorker() = {this, index};
+				for (;;) {
+					std::function<void()> task;
+					if (take(task)) {
+						task();
+						continue;
+					}
+
+					std::unique_lock<std::mutex> lock(sleepMutex);
+					wake.wait(lock, [this] { return stopping || pending.load() > 0; });
+					if (stopping && pending.load() == 0) return;
+				}
+			}
+		};
+
+		// Shared pool sized to the machine (the calling thread is the extra worker)
+		inline thread_pool &defaultPool() {
+			static thread_pool pool(
+			    std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+			return pool;
+		}
+	}  // namespace parallel
+}  // namespace vtx
+
+#endif //VECTRIX_PARALLEL_THREAD_POOL_H
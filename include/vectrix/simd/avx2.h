@@ -0,0 +1,419 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SIMD_AVX2_H
+#define VECTRIX_SIMD_AVX2_H
+
+#include <cstdint>
+
+#include "config.h"
+#include "scalar.h"
+
+#if VTX_SIMD_X86
+
+VTX_SIMD_TARGET_AVX2_BEGIN
+
+namespace vtx {
+	namespace simd {
+		// AVX2 + FMA backend
+		namespace avx2 {
+
+			template <typename T>
+			struct pack4;
+
+			// 4 floats in one XMM register (VEX encoded, fused multiply-add)
+			template <>
+			struct pack4<float> {
+				__m128 v;
+
+				static VTX_FORCEINLINE pack4 load(const float *p) noexcept {
+					return {_mm_loadu_ps(p)};
+				}
+				VTX_FORCEINLINE void store(float *p) const noexcept { _mm_storeu_ps(p, v); }
+				static VTX_FORCEINLINE pack4 set1(const float s) noexcept {
+					return {_mm_set1_ps(s)};
+				}
+				static VTX_FORCEINLINE pack4 set(float a, float b, float c, float d) noexcept {
+					return {_mm_setr_ps(a, b, c, d)};
+				}
+
+				VTX_FORCEINLINE float lane(const int i) const noexcept {
+					alignas(16) float tmp[4];
+					_mm_store_ps(tmp, v);
+					return tmp[i];
+				}
+
+				friend VTX_FORCEINLINE pack4 operator+(pack4 a, pack4 b) noexcept {
+					return {_mm_add_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE pack4 operator-(pack4 a, pack4 b) noexcept {
+					return {_mm_sub_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE pack4 operator*(pack4 a, pack4 b) noexcept {
+					return {_mm_mul_ps(a.v, b.v)};
+				}
+
+				static VTX_FORCEINLINE pack4 fmadd(pack4 a, pack4 b, pack4 c) noexcept {
+					return {_mm_fmadd_ps(a.v, b.v, c.v)};
+				}
+
+				template <int i0, int i1, int i2, int i3>
+				VTX_FORCEINLINE pack4 swizzle() const noexcept {
+					return {_mm_permute_ps(v, _MM_SHUFFLE(i3, i2, i1, i0))};
+				}
+
+				template <int i0, int i1, int i2, int i3>
+				static VTX_FORCEINLINE pack4 shuffle(pack4 a, pack4 b) noexcept {
+					return {_mm_shuffle_ps(a.v, b.v, _MM_SHUFFLE(i3, i2, i1, i0))};
+				}
+
+				VTX_FORCEINLINE float hsum() const noexcept {
+					const __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+					return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehdup_ps(s)));
+				}
+
+				static VTX_FORCEINLINE void transpose(pack4 &r0, pack4 &r1, pack4 &r2, pack4 &r3) noexcept {
+					_MM_TRANSPOSE4_PS(r0.v, r1.v, r2.v, r3.v);
+				}
+			};
+
+			// 4 doubles in one YMM register
+			template <>
+			struct pack4<double> {
+				__m256d v;
+
+				static VTX_FORCEINLINE pack4 load(const double *p) noexcept {
+					return {_mm256_loadu_pd(p)};
+				}
+				VTX_FORCEINLINE void store(double *p) const noexcept { _mm256_storeu_pd(p, v); }
+				static VTX_FORCEINLINE pack4 set1(const double s) noexcept {
+					return {_mm256_set1_pd(s)};
+				}
+				static VTX_FORCEINLINE pack4 set(double a, double b, double c, double d) noexcept {
+					return {_mm256_setr_pd(a, b, c, d)};
+				}
+
+				VTX_FORCEINLINE double lane(const int i) const noexcept {
+					alignas(32) double tmp[4];
+					_mm256_store_pd(tmp, v);
+					return tmp[i];
+				}
+
+				friend VTX_FORCEINLINE pack4 operator+(pack4 a, pack4 b) noexcept {
+					return {_mm256_add_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE pack4 operator-(pack4 a, pack4 b) noexcept {
+					return {_mm256_sub_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE pack4 operator*(pack4 a, pack4 b) noexcept {
+					return {_mm256_mul_pd(a.v, b.v)};
+				}
+
+				static VTX_FORCEINLINE pack4 fmadd(pack4 a, pack4 b, pack4 c) noexcept {
+					return {_mm256_fmadd_pd(a.v, b.v, c.v)};
+				}
+
+				template <int i0, int i1, int i2, int i3>
+				VTX_FORCEINLINE pack4 swizzle() const noexcept {
+					return {_mm256_permute4x64_pd(v, _MM_SHUFFLE(i3, i2, i1, i0))};
+				}
+
+				template <int i0, int i1, int i2, int i3>
+				static VTX_FORCEINLINE pack4 shuffle(pack4 a, pack4 b) noexcept {
+					return {_mm256_blend_pd(_mm256_permute4x64_pd(a.v, _MM_SHUFFLE(i1, i0, i1, i0)),
+					    _mm256_permute4x64_pd(b.v, _MM_SHUFFLE(i3, i2, i3, i2)),
+					    0xC)};
+				}
+
+				VTX_FORCEINLINE double hsum() const noexcept {
+					const __m128d s =
+					    _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+					return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+				}
+
+				static VTX_FORCEINLINE void transpose(pack4 &r0, pack4 &r1, pack4 &r2, pack4 &r3) noexcept {
+					const __m256d t0 = _mm256_unpacklo_pd(r0.v, r1.v),
+					              t1 = _mm256_unpackhi_pd(r0.v, r1.v),
+					              t2 = _mm256_unpacklo_pd(r2.v, r3.v),
+					              t3 = _mm256_unpackhi_pd(r2.v, r3.v);
+					r0.v = _mm256_permute2f128_pd(t0, t2, 0x20);
+					r1.v = _mm256_permute2f128_pd(t1, t3, 0x20);
+					r2.v = _mm256_permute2f128_pd(t0, t2, 0x31);
+					r3.v = _mm256_permute2f128_pd(t1, t3, 0x31);
+				}
+			};
+
+#include "detail/kernels4.inl"
+
+			// Wide batches for stream kernels
+			template <typename T>
+			struct batch;
+
+			// Widest batch of the backend for T (types without one run lane by lane)
+			template <typename T>
+			struct batch_for {
+				using type = scalar::batch<T>;
+			};
+			template <>
+			struct batch_for<float> {
+				using type = batch<float>;
+			};
+			template <>
+			struct batch_for<double> {
+				using type = batch<double>;
+			};
+
+			template <>
+			struct batch<float> {
+				using value_type = float;
+				static constexpr size_t size = 8;
+
+				// Lane mask (all bits set in active lanes)
+				struct mask {
+					__m256 m;
+
+					friend VTX_FORCEINLINE mask operator&(mask a, mask b) noexcept {
+						return {_mm256_and_ps(a.m, b.m)};
+					}
+					friend VTX_FORCEINLINE mask operator|(mask a, mask b) noexcept {
+						return {_mm256_or_ps(a.m, b.m)};
+					}
+					friend VTX_FORCEINLINE mask operator!(mask a) noexcept {
+						return {_mm256_xor_ps(a.m, _mm256_castsi256_ps(_mm256_set1_epi32(-1)))};
+					}
+					VTX_FORCEINLINE bool any() const noexcept { return _mm256_movemask_ps(m) != 0; }
+					VTX_FORCEINLINE bool all() const noexcept {
+						return _mm256_movemask_ps(m) == 0xFF;
+					}
+					VTX_FORCEINLINE unsigned bits() const noexcept {
+						return static_cast<unsigned>(_mm256_movemask_ps(m));
+					}
+				};
+
+				__m256 v;
+
+				static VTX_FORCEINLINE batch load(const float *p) noexcept {
+					return {_mm256_loadu_ps(p)};
+				}
+				VTX_FORCEINLINE void store(float *p) const noexcept { _mm256_storeu_ps(p, v); }
+				static VTX_FORCEINLINE batch set1(const float s) noexcept {
+					return {_mm256_set1_ps(s)};
+				}
+				static VTX_FORCEINLINE batch zero() noexcept { return {_mm256_setzero_ps()}; }
+
+				friend VTX_FORCEINLINE batch operator+(batch a, batch b) noexcept {
+					return {_mm256_add_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator-(batch a, batch b) noexcept {
+					return {_mm256_sub_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator*(batch a, batch b) noexcept {
+					return {_mm256_mul_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator/(batch a, batch b) noexcept {
+					return {_mm256_div_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator-(batch a) noexcept {
+					return {_mm256_xor_ps(a.v, _mm256_set1_ps(-float(0)))};
+				}
+
+				friend VTX_FORCEINLINE mask operator<(batch a, batch b) noexcept {
+					return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator<=(batch a, batch b) noexcept {
+					return {_mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator>(batch a, batch b) noexcept {
+					return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator>=(batch a, batch b) noexcept {
+					return {_mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator==(batch a, batch b) noexcept {
+					return {_mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator!=(batch a, batch b) noexcept {
+					return {_mm256_cmp_ps(a.v, b.v, _CMP_NEQ_UQ)};
+				}
+
+				// a * b + c
+				static VTX_FORCEINLINE batch fmadd(batch a, batch b, batch c) noexcept {
+					return {_mm256_fmadd_ps(a.v, b.v, c.v)};
+				}
+				// c - a * b
+				static VTX_FORCEINLINE batch fnmadd(batch a, batch b, batch c) noexcept {
+					return {_mm256_fnmadd_ps(a.v, b.v, c.v)};
+				}
+
+				static VTX_FORCEINLINE batch min(batch a, batch b) noexcept {
+					return {_mm256_min_ps(a.v, b.v)};
+				}
+				static VTX_FORCEINLINE batch max(batch a, batch b) noexcept {
+					return {_mm256_max_ps(a.v, b.v)};
+				}
+				static VTX_FORCEINLINE batch sqrt(batch a) noexcept {
+					return {_mm256_sqrt_ps(a.v)};
+				}
+				static VTX_FORCEINLINE batch abs(batch a) noexcept {
+					return {_mm256_andnot_ps(_mm256_set1_ps(-float(0)), a.v)};
+				}
+
+				// m ? a : b
+				static VTX_FORCEINLINE batch select(mask m, batch a, batch b) noexcept {
+					return {_mm256_blendv_ps(b.v, a.v, m.m)};
+				}
+
+				VTX_FORCEINLINE float hsum() const noexcept {
+					alignas(64) float tmp[size];
+					store(tmp);
+					float s = tmp[0];
+					for (size_t i = 1; i < size; ++i) s += tmp[i];
+					return s;
+				}
+			};
+
+			template <>
+			struct batch<double> {
+				using value_type = double;
+				static constexpr size_t size = 4;
+
+				// Lane mask (all bits set in active lanes)
+				struct mask {
+					__m256d m;
+
+					friend VTX_FORCEINLINE mask operator&(mask a, mask b) noexcept {
+						return {_mm256_and_pd(a.m, b.m)};
+					}
+					friend VTX_FORCEINLINE mask operator|(mask a, mask b) noexcept {
+						return {_mm256_or_pd(a.m, b.m)};
+					}
+					friend VTX_FORCEINLINE mask operator!(mask a) noexcept {
+						return {_mm256_xor_pd(a.m, _mm256_castsi256_pd(_mm256_set1_epi32(-1)))};
+					}
+					VTX_FORCEINLINE bool any() const noexcept { return _mm256_movemask_pd(m) != 0; }
+					VTX_FORCEINLINE bool all() const noexcept {
+						return _mm256_movemask_pd(m) == 0xF;
+					}
+					VTX_FORCEINLINE unsigned bits() const noexcept {
+						return static_cast<unsigned>(_mm256_movemask_pd(m));
+					}
+				};
+
+				__m256d v;
+
+				static VTX_FORCEINLINE batch load(const double *p) noexcept {
+					return {_mm256_loadu_pd(p)};
+				}
+				VTX_FORCEINLINE void store(double *p) const noexcept { _mm256_storeu_pd(p, v); }
+				static VTX_FORCEINLINE batch set1(const double s) noexcept {
+					return {_mm256_set1_pd(s)};
+				}
+				static VTX_FORCEINLINE batch zero() noexcept { return {_mm256_setzero_pd()}; }
+
+				friend VTX_FORCEINLINE batch operator+(batch a, batch b) noexcept {
+					return {_mm256_add_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator-(batch a, batch b) noexcept {
+					return {_mm256_sub_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator*(batch a, batch b) noexcept {
+					return {_mm256_mul_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator/(batch a, batch b) noexcept {
+					return {_mm256_div_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator-(batch a) noexcept {
+					return {_mm256_xor_pd(a.v, _mm256_set1_pd(-double(0)))};
+				}
+
+				friend VTX_FORCEINLINE mask operator<(batch a, batch b) noexcept {
+					return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator<=(batch a, batch b) noexcept {
+					return {_mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator>(batch a, batch b) noexcept {
+					return {_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator>=(batch a, batch b) noexcept {
+					return {_mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator==(batch a, batch b) noexcept {
+					return {_mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator!=(batch a, batch b) noexcept {
+					return {_mm256_cmp_pd(a.v, b.v, _CMP_NEQ_UQ)};
+				}
+
+				// a * b + c
+				static VTX_FORCEINLINE batch fmadd(batch a, batch b, batch c) noexcept {
+					return {_mm256_fmadd_pd(a.v, b.v, c.v)};
+				}
+				// c - a * b
+				static VTX_FORCEINLINE batch fnmadd(batch a, batch b, batch c) noexcept {
+					return {_mm256_fnmadd_pd(a.v, b.v, c.v)};
+				}
+
+				static VTX_FORCEINLINE batch min(batch a, batch b) noexcept {
+					return {_mm256_min_pd(a.v, b.v)};
+				}
+				static VTX_FORCEINLINE batch max(batch a, batch b) noexcept {
+					return {_mm256_max_pd(a.v, b.v)};
+				}
+				static VTX_FORCEINLINE batch sqrt(batch a) noexcept {
+					return {_mm256_sqrt_pd(a.v)};
+				}
+				static VTX_FORCEINLINE batch abs(batch a) noexcept {
+					return {_mm256_andnot_pd(_mm256_set1_pd(-double(0)), a.v)};
+				}
+
+				// m ? a : b
+				static VTX_FORCEINLINE batch select(mask m, batch a, batch b) noexcept {
+					return {_mm256_blendv_pd(b.v, a.v, m.m)};
+				}
+
+				VTX_FORCEINLINE double hsum() const noexcept {
+					alignas(64) double tmp[size];
+					store(tmp);
+					double s = tmp[0];
+					for (size_t i = 1; i < size; ++i) s += tmp[i];
+					return s;
+				}
+			};
+
+			// Same 4 floats in both 128-bit halves
+			VTX_FORCEINLINE __m256 broadcastRow(const float *p) noexcept {
+				const __m128 row = _mm_loadu_ps(p);
+				return _mm256_insertf128_ps(_mm256_castps128_ps256(row), row, 1);
+			}
+
+			// Float product with two rows per YMM register
+			template <>
+			inline void mat4Mul<float>(const float *a, const float *b, float *r) noexcept {
+				const __m256 a01 = _mm256_loadu_ps(a), a23 = _mm256_loadu_ps(a + 8);
+				const __m256 b0 = broadcastRow(b), b1 = broadcastRow(b + 4), b2 = broadcastRow(b + 8),
+				             b3 = broadcastRow(b + 12);
+
+				__m256 r01 = _mm256_mul_ps(_mm256_permute_ps(a01, 0x00), b0);
+				__m256 r23 = _mm256_mul_ps(_mm256_permute_ps(a23, 0x00), b0);
+				r01 = _mm256_fmadd_ps(_mm256_permute_ps(a01, 0x55), b1, r01);
+				r23 = _mm256_fmadd_ps(_mm256_permute_ps(a23, 0x55), b1, r23);
+				r01 = _mm256_fmadd_ps(_mm256_permute_ps(a01, 0xAA), b2, r01);
+				r23 = _mm256_fmadd_ps(_mm256_permute_ps(a23, 0xAA), b2, r23);
+				r01 = _mm256_fmadd_ps(_mm256_permute_ps(a01, 0xFF), b3, r01);
+				r23 = _mm256_fmadd_ps(_mm256_permute_ps(a23, 0xFF), b3, r23);
+
+				_mm256_storeu_ps(r, r01);
+				_mm256_storeu_ps(r + 8, r23);
+			}
+
+		}  // namespace avx2
+	}  // namespace simd
+}  // namespace vtx
+
+VTX_SIMD_TARGET_END
+
+#endif // VTX_SIMD_X86
+
+#endif //VECTRIX_SIMD_AVX2_H
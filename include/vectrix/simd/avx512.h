@@ -0,0 +1,328 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SIMD_AVX512_H
+#define VECTRIX_SIMD_AVX512_H
+
+#include "config.h"
+#include "scalar.h"
+
+#if VTX_SIMD_X86
+
+VTX_SIMD_TARGET_AVX512_BEGIN
+
+// GCC 12.1/12.2 report _mm512_undefined_*() inside its own intrinsics as uninitialized.
+// Batch min/max/sqrt use the zero-masked forms for the same reason.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif // GCC
+
+namespace vtx {
+	namespace simd {
+		// AVX-512 backend.
+		// Only kernels that gain from a whole matrix (or two rows of doubles) per register
+		// live here, the rest of the table is shared with the AVX2 backend.
+		namespace avx512 {
+
+			// Wide batches for stream kernels
+			template <typename T>
+			struct batch;
+
+			// Widest batch of the backend for T (types without one run lane by lane)
+			template <typename T>
+			struct batch_for {
+				using type = scalar::batch<T>;
+			};
+			template <>
+			struct batch_for<float> {
+				using type = batch<float>;
+			};
+			template <>
+			struct batch_for<double> {
+				using type = batch<double>;
+			};
+
+			template <>
+			struct batch<float> {
+				using value_type = float;
+				static constexpr size_t size = 16;
+
+				// Lane mask (opmask register)
+				struct mask {
+					__mmask16 m;
+
+					friend VTX_FORCEINLINE mask operator&(mask a, mask b) noexcept {
+						return {__mmask16(a.m & b.m)};
+					}
+					friend VTX_FORCEINLINE mask operator|(mask a, mask b) noexcept {
+						return {__mmask16(a.m | b.m)};
+					}
+					friend VTX_FORCEINLINE mask operator!(mask a) noexcept {
+						return {__mmask16(~a.m & 0xFFFF)};
+					}
+					VTX_FORCEINLINE bool any() const noexcept { return m != 0; }
+					VTX_FORCEINLINE bool all() const noexcept { return m == 0xFFFF; }
+					VTX_FORCEINLINE unsigned bits() const noexcept { return m; }
+				};
+
+				__m512 v;
+
+				static VTX_FORCEINLINE batch load(const float *p) noexcept {
+					return {_mm512_loadu_ps(p)};
+				}
+				VTX_FORCEINLINE void store(float *p) const noexcept { _mm512_storeu_ps(p, v); }
+				static VTX_FORCEINLINE batch set1(const float s) noexcept {
+					return {_mm512_set1_ps(s)};
+				}
+				static VTX_FORCEINLINE batch zero() noexcept { return {_mm512_setzero_ps()}; }
+
+				friend VTX_FORCEINLINE batch operator+(batch a, batch b) noexcept {
+					return {_mm512_add_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator-(batch a, batch b) noexcept {
+					return {_mm512_sub_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator*(batch a, batch b) noexcept {
+					return {_mm512_mul_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator/(batch a, batch b) noexcept {
+					return {_mm512_div_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator-(batch a) noexcept {
+					return {_mm512_xor_ps(a.v, _mm512_set1_ps(-float(0)))};
+				}
+
+				friend VTX_FORCEINLINE mask operator<(batch a, batch b) noexcept {
+					return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator<=(batch a, batch b) noexcept {
+					return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_LE_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator>(batch a, batch b) noexcept {
+					return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_GT_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator>=(batch a, batch b) noexcept {
+					return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_GE_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator==(batch a, batch b) noexcept {
+					return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_EQ_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator!=(batch a, batch b) noexcept {
+					return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_NEQ_UQ)};
+				}
+
+				// a * b + c
+				static VTX_FORCEINLINE batch fmadd(batch a, batch b, batch c) noexcept {
+					return {_mm512_fmadd_ps(a.v, b.v, c.v)};
+				}
+				// c - a * b
+				static VTX_FORCEINLINE batch fnmadd(batch a, batch b, batch c) noexcept {
+					return {_mm512_fnmadd_ps(a.v, b.v, c.v)};
+				}
+
+				static VTX_FORCEINLINE batch min(batch a, batch b) noexcept {
+					return {_mm512_maskz_min_ps(0xFFFF, a.v, b.v)};
+				}
+				static VTX_FORCEINLINE batch max(batch a, batch b) noexcept {
+					return {_mm512_maskz_max_ps(0xFFFF, a.v, b.v)};
+				}
+				static VTX_FORCEINLINE batch sqrt(batch a) noexcept {
+					return {_mm512_maskz_sqrt_ps(0xFFFF, a.v)};
+				}
+				static VTX_FORCEINLINE batch abs(batch a) noexcept { return {_mm512_abs_ps(a.v)}; }
+
+				// m ? a : b
+				static VTX_FORCEINLINE batch select(mask m, batch a, batch b) noexcept {
+					return {_mm512_mask_blend_ps(m.m, b.v, a.v)};
+				}
+
+				VTX_FORCEINLINE float hsum() const noexcept {
+					alignas(64) float tmp[size];
+					store(tmp);
+					float s = tmp[0];
+					for (size_t i = 1; i < size; ++i) s += tmp[i];
+					return s;
+				}
+			};
+
+			template <>
+			struct batch<double> {
+				using value_type = double;
+				static constexpr size_t size = 8;
+
+				// Lane mask (opmask register)
+				struct mask {
+					__mmask8 m;
+
+					friend VTX_FORCEINLINE mask operator&(mask a, mask b) noexcept {
+						return {__mmask8(a.m & b.m)};
+					}
+					friend VTX_FORCEINLINE mask operator|(mask a, mask b) noexcept {
+						return {__mmask8(a.m | b.m)};
+					}
+					friend VTX_FORCEINLINE mask operator!(mask a) noexcept {
+						return {__mmask8(~a.m & 0xFF)};
+					}
+					VTX_FORCEINLINE bool any() const noexcept { return m != 0; }
+					VTX_FORCEINLINE bool all() const noexcept { return m == 0xFF; }
+					VTX_FORCEINLINE unsigned bits() const noexcept { return m; }
+				};
+
+				__m512d v;
+
+				static VTX_FORCEINLINE batch load(const double *p) noexcept {
+					return {_mm512_loadu_pd(p)};
+				}
+				VTX_FORCEINLINE void store(double *p) const noexcept { _mm512_storeu_pd(p, v); }
+				static VTX_FORCEINLINE batch set1(const double s) noexcept {
+					return {_mm512_set1_pd(s)};
+				}
+				static VTX_FORCEINLINE batch zero() noexcept { return {_mm512_setzero_pd()}; }
+
+				friend VTX_FORCEINLINE batch operator+(batch a, batch b) noexcept {
+					return {_mm512_add_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator-(batch a, batch b) noexcept {
+					return {_mm512_sub_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator*(batch a, batch b) noexcept {
+					return {_mm512_mul_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator/(batch a, batch b) noexcept {
+					return {_mm512_div_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator-(batch a) noexcept {
+					return {_mm512_xor_pd(a.v, _mm512_set1_pd(-double(0)))};
+				}
+
+				friend VTX_FORCEINLINE mask operator<(batch a, batch b) noexcept {
+					return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator<=(batch a, batch b) noexcept {
+					return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_LE_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator>(batch a, batch b) noexcept {
+					return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_GT_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator>=(batch a, batch b) noexcept {
+					return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_GE_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator==(batch a, batch b) noexcept {
+					return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_EQ_OQ)};
+				}
+				friend VTX_FORCEINLINE mask operator!=(batch a, batch b) noexcept {
+					return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_NEQ_UQ)};
+				}
+
+				// a * b + c
+				static VTX_FORCEINLINE batch fmadd(batch a, batch b, batch c) noexcept {
+					return {_mm512_fmadd_pd(a.v, b.v, c.v)};
+				}
+				// c - a * b
+				static VTX_FORCEINLINE batch fnmadd(batch a, batch b, batch c) noexcept {
+					return {_mm512_fnmadd_pd(a.v, b.v, c.v)};
+				}
+
+				static VTX_FORCEINLINE batch min(batch a, batch b) noexcept {
+					return {_mm512_maskz_min_pd(0xFF, a.v, b.v)};
+				}
+				static VTX_FORCEINLINE batch max(batch a, batch b) noexcept {
+					return {_mm512_maskz_max_pd(0xFF, a.v, b.v)};
+				}
+				static VTX_FORCEINLINE batch sqrt(batch a) noexcept {
+					return {_mm512_maskz_sqrt_pd(0xFF, a.v)};
+				}
+				static VTX_FORCEINLINE batch abs(batch a) noexcept { return {_mm512_abs_pd(a.v)}; }
+
+				// m ? a : b
+				static VTX_FORCEINLINE batch select(mask m, batch a, batch b) noexcept {
+					return {_mm512_mask_blend_pd(m.m, b.v, a.v)};
+				}
+
+				VTX_FORCEINLINE double hsum() const noexcept {
+					alignas(64) double tmp[size];
+					store(tmp);
+					double s = tmp[0];
+					for (size_t i = 1; i < size; ++i) s += tmp[i];
+					return s;
+				}
+			};
+
+			inline void mat4Mul(const float *a, const float *b, float *r) noexcept {
+				const __m512 A = _mm512_loadu_ps(a);
+				const __m512 b0 = _mm512_broadcast_f32x4(_mm_loadu_ps(b)),
+				             b1 = _mm512_broadcast_f32x4(_mm_loadu_ps(b + 4)),
+				             b2 = _mm512_broadcast_f32x4(_mm_loadu_ps(b + 8)),
+				             b3 = _mm512_broadcast_f32x4(_mm_loadu_ps(b + 12));
+
+				// In-lane permutes broadcast a[i][k] over the 128-bit lane of row i
+				__m512 R = _mm512_mul_ps(_mm512_shuffle_ps(A, A, 0x00), b0);
+				R = _mm512_fmadd_ps(_mm512_shuffle_ps(A, A, 0x55), b1, R);
+				R = _mm512_fmadd_ps(_mm512_shuffle_ps(A, A, 0xAA), b2, R);
+				R = _mm512_fmadd_ps(_mm512_shuffle_ps(A, A, 0xFF), b3, R);
+				_mm512_storeu_ps(r, R);
+			}
+
+			inline void mat4Mul(const double *a, const double *b, double *r) noexcept {
+				const __m512d A01 = _mm512_loadu_pd(a), A23 = _mm512_loadu_pd(a + 8);
+				const __m512d b0 = _mm512_broadcast_f64x4(_mm256_loadu_pd(b)),
+				              b1 = _mm512_broadcast_f64x4(_mm256_loadu_pd(b + 4)),
+				              b2 = _mm512_broadcast_f64x4(_mm256_loadu_pd(b + 8)),
+				              b3 = _mm512_broadcast_f64x4(_mm256_loadu_pd(b + 12));
+
+				__m512d R01 = _mm512_mul_pd(_mm512_permutex_pd(A01, 0x00), b0);
+				__m512d R23 = _mm512_mul_pd(_mm512_permutex_pd(A23, 0x00), b0);
+				R01 = _mm512_fmadd_pd(_mm512_permutex_pd(A01, 0x55), b1, R01);
+				R23 = _mm512_fmadd_pd(_mm512_permutex_pd(A23, 0x55), b1, R23);
+				R01 = _mm512_fmadd_pd(_mm512_permutex_pd(A01, 0xAA), b2, R01);
+				R23 = _mm512_fmadd_pd(_mm512_permutex_pd(A23, 0xAA), b2, R23);
+				R01 = _mm512_fmadd_pd(_mm512_permutex_pd(A01, 0xFF), b3, R01);
+				R23 = _mm512_fmadd_pd(_mm512_permutex_pd(A23, 0xFF), b3, R23);
+
+				_mm512_storeu_pd(r, R01);
+				_mm512_storeu_pd(r + 8, R23);
+			}
+
+			inline void mat4MulVec(const float *a, const float *v, float *r) noexcept {
+				const __m512 V = _mm512_broadcast_f32x4(_mm_loadu_ps(v));
+				__m512 p = _mm512_mul_ps(_mm512_loadu_ps(a), V);
+
+				// Every lane of row i ends up with the full row sum
+				p = _mm512_add_ps(p, _mm512_shuffle_ps(p, p, _MM_SHUFFLE(2, 3, 0, 1)));
+				p = _mm512_add_ps(p, _mm512_shuffle_ps(p, p, _MM_SHUFFLE(1, 0, 3, 2)));
+
+				const __m512i idx = _mm512_setr_epi32(0, 4, 8, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+				_mm_storeu_ps(r, _mm512_castps512_ps128(_mm512_permutexvar_ps(idx, p)));
+			}
+
+			inline void mat4Transpose(const float *a, float *r) noexcept {
+				const __m512i idx =
+				    _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+				_mm512_storeu_ps(r, _mm512_permutexvar_ps(idx, _mm512_loadu_ps(a)));
+			}
+
+			inline void mat4Transpose(const double *a, double *r) noexcept {
+				const __m512d A01 = _mm512_loadu_pd(a), A23 = _mm512_loadu_pd(a + 8);
+				const __m512i idx01 = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13),
+				              idx23 = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+				const __m512d R01 = _mm512_permutex2var_pd(A01, idx01, A23),
+				              R23 = _mm512_permutex2var_pd(A01, idx23, A23);
+				_mm512_storeu_pd(r, R01);
+				_mm512_storeu_pd(r + 8, R23);
+			}
+
+		}  // namespace avx512
+	}  // namespace simd
+}  // namespace vtx
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif // GCC
+
+VTX_SIMD_TARGET_END
+
+#endif // VTX_SIMD_X86
+
+#endif //VECTRIX_SIMD_AVX512_H
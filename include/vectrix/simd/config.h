@@ -0,0 +1,48 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SIMD_CONFIG_H
+#define VECTRIX_SIMD_CONFIG_H
+
+#include "vectrix/math/common.h"
+
+// x86 SIMD backends (SSE2 is the baseline for every x86-64 target)
+#if !defined(VTX_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define VTX_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define VTX_SIMD_X86 0
+#endif // x86 SIMD
+
+// Code regions compiled for a wider ISA than the translation unit default.
+// MSVC exposes all intrinsics without target options, so nothing is required there.
+#if VTX_SIMD_X86 && defined(__clang__)
+#define VTX_SIMD_TARGET_AVX2_BEGIN \
+	_Pragma("clang attribute push(__attribute__((target(\"avx2,fma\"))), apply_to = function)")
+#define VTX_SIMD_TARGET_AVX512_BEGIN                                                      \
+	_Pragma("clang attribute push(__attribute__((target(\"avx512f,avx512dq,avx512vl,avx2,fma\"))), " \
+	        "apply_to = function)")
+#define VTX_SIMD_TARGET_END _Pragma("clang attribute pop")
+#elif VTX_SIMD_X86 && defined(__GNUC__)
+#define VTX_SIMD_TARGET_AVX2_BEGIN _Pragma("GCC push_options") _Pragma("GCC target(\"avx2,fma\")")
+#define VTX_SIMD_TARGET_AVX512_BEGIN \
+	_Pragma("GCC push_options") _Pragma("GCC target(\"avx512f,avx512dq,avx512vl,avx2,fma\")")
+#define VTX_SIMD_TARGET_END _Pragma("GCC pop_options")
+#else
+#define VTX_SIMD_TARGET_AVX2_BEGIN
+#define VTX_SIMD_TARGET_AVX512_BEGIN
+#define VTX_SIMD_TARGET_END
+#endif // target regions
+
+// Force inlining of small kernel helpers
+#if defined(__GNUC__) || defined(__clang__)
+#define VTX_FORCEINLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define VTX_FORCEINLINE __forceinline
+#else
+#define VTX_FORCEINLINE inline
+#endif // VTX_FORCEINLINE
+
+#endif //VECTRIX_SIMD_CONFIG_H
@@ -0,0 +1,98 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SIMD_CPU_H
+#define VECTRIX_SIMD_CPU_H
+
+#include "config.h"
+
+#if VTX_SIMD_X86 && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif // MSVC cpuid
+
+namespace vtx {
+	namespace simd {
+
+		// Instruction set levels, ordered from the narrowest to the widest
+		enum class backend : int {
+			scalar = 0,  // Plain C++ code, always available
+			sse2 = 1,    // 128-bit SSE2
+			avx2 = 2,    // 256-bit AVX2 + FMA
+			avx512 = 3,  // 512-bit AVX-512 F/DQ/VL
+		};
+
+		// Backend name (for logs and test output)
+		inline const char *name(backend b) noexcept {
+			switch (b) {
+				case backend::sse2:
+					return "sse2";
+				case backend::avx2:
+					return "avx2";
+				case backend::avx512:
+					return "avx512";
+				default:
+					return "scalar";
+			}
+		}
+
+		namespace detail {
+#if VTX_SIMD_X86 && defined(_MSC_VER) && !defined(__clang__)
+			inline backend detectBackend() noexcept {
+				int regs[4];
+				__cpuid(regs, 0);
+				const int maxLeaf = regs[0];
+
+				__cpuid(regs, 1);
+				const bool osxsave = (regs[2] & (1 << 27)) != 0;
+				const bool fma = (regs[2] & (1 << 12)) != 0;
+				const bool avx = (regs[2] & (1 << 28)) != 0;
+
+				// OS must save YMM (bits 1, 2) and ZMM/opmask (bits 5, 6, 7) state
+				const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+				const bool ymmState = (xcr0 & 0x6) == 0x6;
+				const bool zmmState = (xcr0 & 0xE6) == 0xE6;
+
+				if (maxLeaf < 7 || !avx || !fma || !ymmState) return backend::sse2;
+
+				__cpuidex(regs, 7, 0);
+				const bool avx2 = (regs[1] & (1 << 5)) != 0;
+				const bool avx512f = (regs[1] & (1 << 16)) != 0;
+				const bool avx512dq = (regs[1] & (1 << 17)) != 0;
+				const bool avx512vl = (regs[1] & (1 << 31)) != 0;
+
+				if (!avx2) return backend::sse2;
+				if (avx512f && avx512dq && avx512vl && zmmState) return backend::avx512;
+				return backend::avx2;
+			}
+#elif VTX_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+			inline backend detectBackend() noexcept {
+				// Builtins check OS support (XSAVE state) as well
+				__builtin_cpu_init();
+				if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("fma"))
+					return backend::sse2;
+				if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+				    __builtin_cpu_supports("avx512vl"))
+					return backend::avx512;
+				return backend::avx2;
+			}
+#else
+			inline backend detectBackend() noexcept { return backend::scalar; }
+#endif // CPU detection
+		}  // namespace detail
+
+		// Widest instruction set supported by the running CPU (detected once)
+		inline backend detected() noexcept {
+			static const backend b = detail::detectBackend();
+			return b;
+		}
+
+		// Check if backend can be executed on the running CPU
+		inline bool supported(backend b) noexcept {
+			return static_cast<int>(b) <= static_cast<int>(detected());
+		}
+
+	}  // namespace simd
+}  // namespace vtx
+
+#endif //VECTRIX_SIMD_CPU_H
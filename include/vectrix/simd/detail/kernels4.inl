@@ -0,0 +1,169 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Generic 4-lane kernels for vector<T, 4>, matrix<T, 4, 4> and affine3<T>.
+// This file is included by every x86 backend header inside its own namespace,
+// right after that backend declares pack4<float> and pack4<double>. Pack interface:
+//   load, store, set1, +, -, *, fmadd, swizzle<...>, shuffle<...>, hsum, transpose
+// No include guard on purpose.
+
+// Element-wise vector operations
+template <typename T>
+inline void vec4Add(const T *a, const T *b, T *r) noexcept {
+	(pack4<T>::load(a) + pack4<T>::load(b)).store(r);
+}
+
+template <typename T>
+inline void vec4Sub(const T *a, const T *b, T *r) noexcept {
+	(pack4<T>::load(a) - pack4<T>::load(b)).store(r);
+}
+
+template <typename T>
+inline void vec4Mul(const T *a, const T *b, T *r) noexcept {
+	(pack4<T>::load(a) * pack4<T>::load(b)).store(r);
+}
+
+template <typename T>
+inline void vec4Scale(const T *a, const T s, T *r) noexcept {
+	(pack4<T>::load(a) * pack4<T>::set1(s)).store(r);
+}
+
+template <typename T>
+inline T vec4Dot(const T *a, const T *b) noexcept {
+	return (pack4<T>::load(a) * pack4<T>::load(b)).hsum();
+}
+
+// Row-major matrix product: row i of result is sum(a[i][k] * b.row(k))
+template <typename T>
+inline void mat4Mul(const T *a, const T *b, T *r) noexcept {
+	const pack4<T> b0 = pack4<T>::load(b), b1 = pack4<T>::load(b + 4),
+	               b2 = pack4<T>::load(b + 8), b3 = pack4<T>::load(b + 12);
+	pack4<T> rows[4];
+
+	for (int i = 0; i < 4; ++i) {
+		const T *ai = a + 4 * i;
+		pack4<T> acc = pack4<T>::set1(ai[0]) * b0;
+		acc = pack4<T>::fmadd(pack4<T>::set1(ai[1]), b1, acc);
+		acc = pack4<T>::fmadd(pack4<T>::set1(ai[2]), b2, acc);
+		rows[i] = pack4<T>::fmadd(pack4<T>::set1(ai[3]), b3, acc);
+	}
+
+	for (int i = 0; i < 4; ++i) rows[i].store(r + 4 * i);
+}
+
+// Matrix by column vector product
+template <typename T>
+inline void mat4MulVec(const T *a, const T *v, T *r) noexcept {
+	const pack4<T> vv = pack4<T>::load(v);
+	pack4<T> p0 = pack4<T>::load(a) * vv, p1 = pack4<T>::load(a + 4) * vv,
+	         p2 = pack4<T>::load(a + 8) * vv, p3 = pack4<T>::load(a + 12) * vv;
+
+	pack4<T>::transpose(p0, p1, p2, p3);
+	((p0 + p1) + (p2 + p3)).store(r);
+}
+
+template <typename T>
+inline void mat4Transpose(const T *a, T *r) noexcept {
+	pack4<T> p0 = pack4<T>::load(a), p1 = pack4<T>::load(a + 4), p2 = pack4<T>::load(a + 8),
+	         p3 = pack4<T>::load(a + 12);
+
+	pack4<T>::transpose(p0, p1, p2, p3);
+	p0.store(r);
+	p1.store(r + 4);
+	p2.store(r + 8);
+	p3.store(r + 12);
+}
+
+// Batch composition of 3x4 affine transforms (affine3 storage, rows of 4): r[i] = a[i] * b[j],
+// j = bIndex[i] when bIndex is not null, i otherwise. Row c of r[i] combines the rows of a[i]
+// by row c of b[j], whose last element adds to the translation lane.
+// Every transform is loaded before it is written, so r may alias a or b.
+template <typename T>
+inline void affineCompose(
+    const T *a, const T *b, const std::uint32_t *bIndex, T *r, const size_t n) noexcept {
+	const pack4<T> w = pack4<T>::set(T(0), T(0), T(0), T(1));
+	for (size_t i = 0; i < n; ++i) {
+		const T *ai = a + 12 * i, *bi = b + 12 * (bIndex ? size_t(bIndex[i]) : i);
+		const pack4<T> a0 = pack4<T>::load(ai), a1 = pack4<T>::load(ai + 4), a2 = pack4<T>::load(ai + 8);
+		pack4<T> rows[3];
+
+		for (int c = 0; c < 3; ++c) {
+			const T *bc = bi + 4 * c;
+			pack4<T> acc = pack4<T>::set1(bc[0]) * a0;
+			acc = pack4<T>::fmadd(pack4<T>::set1(bc[1]), a1, acc);
+			acc = pack4<T>::fmadd(pack4<T>::set1(bc[2]), a2, acc);
+			rows[c] = pack4<T>::fmadd(pack4<T>::set1(bc[3]), w, acc);
+		}
+
+		for (int c = 0; c < 3; ++c) rows[c].store(r + 12 * i + 4 * c);
+	}
+}
+
+// 2x2 block helpers, 2x2 matrices are stored as [m00, m01, m10, m11]
+template <typename T>
+inline pack4<T> mat2Mul(const pack4<T> &a, const pack4<T> &b) noexcept {
+	return pack4<T>::fmadd(a, b.template swizzle<0, 3, 0, 3>(),
+	    a.template swizzle<1, 0, 3, 2>() * b.template swizzle<2, 1, 2, 1>());
+}
+
+// adj(a) * b
+template <typename T>
+inline pack4<T> mat2AdjMul(const pack4<T> &a, const pack4<T> &b) noexcept {
+	return a.template swizzle<3, 3, 0, 0>() * b -
+	    a.template swizzle<1, 1, 2, 2>() * b.template swizzle<2, 3, 0, 1>();
+}
+
+// a * adj(b)
+template <typename T>
+inline pack4<T> mat2MulAdj(const pack4<T> &a, const pack4<T> &b) noexcept {
+	return a * b.template swizzle<3, 0, 3, 0>() -
+	    a.template swizzle<1, 0, 3, 2>() * b.template swizzle<2, 1, 2, 1>();
+}
+
+// Inverse through 2x2 blocks (shares the six 2x2 sub-determinants of row pairs).
+// Returns false (and leaves r untouched) for a singular matrix.
+template <typename T>
+inline bool mat4Inverse(const T *m, T *r) noexcept {
+	const pack4<T> r0 = pack4<T>::load(m), r1 = pack4<T>::load(m + 4), r2 = pack4<T>::load(m + 8),
+	               r3 = pack4<T>::load(m + 12);
+
+	// Blocks | A B |
+	//        | C D |
+	const pack4<T> A = pack4<T>::template shuffle<0, 1, 0, 1>(r0, r1),
+	               B = pack4<T>::template shuffle<2, 3, 2, 3>(r0, r1),
+	               C = pack4<T>::template shuffle<0, 1, 0, 1>(r2, r3),
+	               D = pack4<T>::template shuffle<2, 3, 2, 3>(r2, r3);
+
+	// [det(A), det(B), det(C), det(D)]
+	const pack4<T> detSub = pack4<T>::template shuffle<0, 2, 0, 2>(r0, r2) *
+	        pack4<T>::template shuffle<1, 3, 1, 3>(r1, r3) -
+	    pack4<T>::template shuffle<1, 3, 1, 3>(r0, r2) *
+	        pack4<T>::template shuffle<0, 2, 0, 2>(r1, r3);
+	const pack4<T> detA = detSub.template swizzle<0, 0, 0, 0>(),
+	               detB = detSub.template swizzle<1, 1, 1, 1>(),
+	               detC = detSub.template swizzle<2, 2, 2, 2>(),
+	               detD = detSub.template swizzle<3, 3, 3, 3>();
+
+	const pack4<T> D_C = mat2AdjMul(D, C), A_B = mat2AdjMul(A, B);
+
+	pack4<T> X = detD * A - mat2Mul(B, D_C), W = detA * D - mat2Mul(C, A_B),
+	         Y = detB * C - mat2MulAdj(D, A_B), Z = detC * B - mat2MulAdj(A, D_C);
+
+	const T det = detSub.lane(0) * detSub.lane(3) + detSub.lane(1) * detSub.lane(2) -
+	    (A_B * D_C.template swizzle<0, 2, 1, 3>()).hsum();
+	if (det == T(0)) return false;
+
+	const T inv = T(1) / det;
+	const pack4<T> rDet = pack4<T>::set(inv, -inv, -inv, inv);
+	X = X * rDet;
+	Y = Y * rDet;
+	Z = Z * rDet;
+	W = W * rDet;
+
+	pack4<T>::template shuffle<3, 1, 3, 1>(X, Y).store(r);
+	pack4<T>::template shuffle<2, 0, 2, 0>(X, Y).store(r + 4);
+	pack4<T>::template shuffle<3, 1, 3, 1>(Z, W).store(r + 8);
+	pack4<T>::template shuffle<2, 0, 2, 0>(Z, W).store(r + 12);
+	return true;
+}
@@ -0,0 +1,274 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SIMD_DISPATCH_H
+#define VECTRIX_SIMD_DISPATCH_H
+
+#include <atomic>
+#include <cstdint>
+
+#include "cpu.h"
+#include "scalar.h"
+#include "sse2.h"
+#include "avx2.h"
+#include "avx512.h"
+
+namespace vtx {
+	namespace simd {
+
+		// Runtime-dispatched kernels of matrix<T, 4, 4> (row-major, 16 elements) and
+		// affine3<T> (3 rows of 4). Empty entries mean "use the scalar code of the caller".
+		template <typename T>
+		struct kernel_table {
+			void (*mat4Mul)(const T *a, const T *b, T *r);
+			void (*mat4MulVec)(const T *a, const T *v, T *r);
+			void (*mat4Transpose)(const T *a, T *r);
+			bool (*mat4Inverse)(const T *a, T *r);
+			void (*affineCompose)(const T *a, const T *b, const std::uint32_t *bIndex, T *r, size_t n);
+		};
+
+		namespace detail {
+			inline std::atomic<int> &activeBackend() noexcept {
+				static std::atomic<int> b{static_cast<int>(detected())};
+				return b;
+			}
+
+			// Tables indexed by backend
+			template <typename T>
+			inline const kernel_table<T> *tables() noexcept;
+
+#if VTX_SIMD_X86
+			template <>
+			inline const kernel_table<float> *tables<float>() noexcept {
+				static const kernel_table<float> t[4] = {
+				    {nullptr, nullptr, nullptr, nullptr, nullptr},
+				    {&sse2::mat4Mul<float>,
+				        &sse2::mat4MulVec<float>,
+				        &sse2::mat4Transpose<float>,
+				        &sse2::mat4Inverse<float>,
+				        &sse2::affineCompose<float>},
+				    {&avx2::mat4Mul<float>,
+				        &avx2::mat4MulVec<float>,
+				        &avx2::mat4Transpose<float>,
+				        &avx2::mat4Inverse<float>,
+				        &avx2::affineCompose<float>},
+				    {static_cast<void (*)(const float *, const float *, float *)>(&avx512::mat4Mul),
+				        static_cast<void (*)(const float *, const float *, float *)>(
+				            &avx512::mat4MulVec),
+				        static_cast<void (*)(const float *, float *)>(&avx512::mat4Transpose),
+				        &avx2::mat4Inverse<float>,
+				        &avx2::affineCompose<float>},
+				};
+				return t;
+			}
+
+			template <>
+			inline const kernel_table<double> *tables<double>() noexcept {
+				static const kernel_table<double> t[4] = {
+				    {nullptr, nullptr, nullptr, nullptr, nullptr},
+				    {&sse2::mat4Mul<double>,
+				        &sse2::mat4MulVec<double>,
+				        &sse2::mat4Transpose<double>,
+				        &sse2::mat4Inverse<double>,
+				        &sse2::affineCompose<double>},
+				    {&avx2::mat4Mul<double>,
+				        &avx2::mat4MulVec<double>,
+				        &avx2::mat4Transpose<double>,
+				        &avx2::mat4Inverse<double>,
+				        &avx2::affineCompose<double>},
+				    {static_cast<void (*)(const double *, const double *, double *)>(&avx512::mat4Mul),
+				        &avx2::mat4MulVec<double>,
+				        static_cast<void (*)(const double *, double *)>(&avx512::mat4Transpose),
+				        &avx2::mat4Inverse<double>,
+				        &avx2::affineCompose<double>},
+				};
+				return t;
+			}
+#endif // VTX_SIMD_X86
+		}  // namespace detail
+
+		// Argument list of select(): the kernel instantiated in every backend namespace
+#if VTX_SIMD_X86
+#define VTX_SIMD_FN(...)                                                                       \
+	&::vtx::simd::scalar::__VA_ARGS__, &::vtx::simd::sse2::__VA_ARGS__,                       \
+	    &::vtx::simd::avx2::__VA_ARGS__, &::vtx::simd::avx512::__VA_ARGS__
+#else
+#define VTX_SIMD_FN(...)                                                                       \
+	&::vtx::simd::scalar::__VA_ARGS__, &::vtx::simd::scalar::__VA_ARGS__,                     \
+	    &::vtx::simd::scalar::__VA_ARGS__, &::vtx::simd::scalar::__VA_ARGS__
+#endif // VTX_SIMD_X86
+
+		// Backend currently used by the dispatched kernels
+		inline backend active() noexcept {
+			return static_cast<backend>(detail::activeBackend().load(std::memory_order_relaxed));
+		}
+
+		// Force backend (test mode, benchmarks). False if CPU can't run it.
+		inline bool force(const backend b) noexcept {
+			if (!supported(b)) return false;
+			detail::activeBackend().store(static_cast<int>(b), std::memory_order_relaxed);
+			return true;
+		}
+
+		// Return to the widest backend of the running CPU
+		inline void reset() noexcept {
+			detail::activeBackend().store(static_cast<int>(detected()), std::memory_order_relaxed);
+		}
+
+		// Kernel table of the active backend
+		template <typename T>
+		inline const kernel_table<T> &kernels() noexcept {
+			return detail::tables<T>()[static_cast<int>(active())];
+		}
+
+		// Instantiation of a stream kernel (see foreach_backend.h) for the active backend
+		template <typename F>
+		inline F select(F scalarFn, F sse2Fn, F avx2Fn, F avx512Fn) noexcept {
+			switch (active()) {
+				case backend::sse2:
+					return sse2Fn;
+				case backend::avx2:
+					return avx2Fn;
+				case backend::avx512:
+					return avx512Fn;
+				default:
+					return scalarFn;
+			}
+		}
+
+		// matrix<T, 4, 4> hooks. Every call returns false when the caller must run its
+		// own scalar code (unsupported type, scalar backend, singular matrix for inverse).
+		template <typename T>
+		struct mat4 {
+			static constexpr bool enabled = false;
+
+			static bool mul(const T *, const T *, T *) noexcept { return false; }
+			static bool mulVec(const T *, const T *, T *) noexcept { return false; }
+			static bool transpose(const T *, T *) noexcept { return false; }
+			static bool inverse(const T *, T *) noexcept { return false; }
+		};
+
+		// affine3<T> hooks, false when the caller must run its own scalar code
+		template <typename T>
+		struct affine {
+			static constexpr bool enabled = false;
+
+			static bool compose(const T *, const T *, const std::uint32_t *, T *, size_t) noexcept {
+				return false;
+			}
+		};
+
+		// vector<T, 4> hooks. Element-wise operations on one 4-lane register gain nothing
+		// from a wider ISA, so they are inlined for the compile-time ISA instead of paying
+		// for an indirect call per operation.
+		template <typename T>
+		struct vec4 {
+			static constexpr bool enabled = false;
+
+			template <typename V>
+			static V add(const V &a, const V &) noexcept { return a; }
+			template <typename V>
+			static V sub(const V &a, const V &) noexcept { return a; }
+			template <typename V>
+			static V mul(const V &a, const V &) noexcept { return a; }
+			template <typename V>
+			static V scale(const V &a, T) noexcept { return a; }
+			template <typename V>
+			static T dot(const V &, const V &) noexcept { return T(0); }
+		};
+
+#if VTX_SIMD_X86
+#if defined(__AVX2__) && defined(__FMA__)
+		namespace native = avx2;
+#else
+		namespace native = sse2;
+#endif // compile-time ISA
+
+		template <typename T>
+		struct mat4_dispatch {
+			static constexpr bool enabled = true;
+
+			static bool mul(const T *a, const T *b, T *r) noexcept {
+				const auto f = kernels<T>().mat4Mul;
+				return f != nullptr && (f(a, b, r), true);
+			}
+			static bool mulVec(const T *a, const T *v, T *r) noexcept {
+				const auto f = kernels<T>().mat4MulVec;
+				return f != nullptr && (f(a, v, r), true);
+			}
+			static bool transpose(const T *a, T *r) noexcept {
+				const auto f = kernels<T>().mat4Transpose;
+				return f != nullptr && (f(a, r), true);
+			}
+			static bool inverse(const T *a, T *r) noexcept {
+				const auto f = kernels<T>().mat4Inverse;
+				return f != nullptr && f(a, r);
+			}
+		};
+
+		template <>
+		struct mat4<float> : mat4_dispatch<float> {};
+		template <>
+		struct mat4<double> : mat4_dispatch<double> {};
+
+		template <typename T>
+		struct affine_dispatch {
+			static constexpr bool enabled = true;
+
+			static bool compose(
+			    const T *a, const T *b, const std::uint32_t *bIndex, T *r, const size_t n) noexcept {
+				const auto f = kernels<T>().affineCompose;
+				return f != nullptr && (f(a, b, bIndex, r, n), true);
+			}
+		};
+
+		template <>
+		struct affine<float> : affine_dispatch<float> {};
+		template <>
+		struct affine<double> : affine_dispatch<double> {};
+
+		template <typename T>
+		struct vec4_native {
+			static constexpr bool enabled = true;
+
+			template <typename V>
+			static V add(const V &a, const V &b) noexcept {
+				V r;
+				native::vec4Add<T>(a.data(), b.data(), r.data());
+				return r;
+			}
+			template <typename V>
+			static V sub(const V &a, const V &b) noexcept {
+				V r;
+				native::vec4Sub<T>(a.data(), b.data(), r.data());
+				return r;
+			}
+			template <typename V>
+			static V mul(const V &a, const V &b) noexcept {
+				V r;
+				native::vec4Mul<T>(a.data(), b.data(), r.data());
+				return r;
+			}
+			template <typename V>
+			static V scale(const V &a, const T s) noexcept {
+				V r;
+				native::vec4Scale<T>(a.data(), s, r.data());
+				return r;
+			}
+			template <typename V>
+			static T dot(const V &a, const V &b) noexcept {
+				return native::vec4Dot<T>(a.data(), b.data());
+			}
+		};
+
+		template <>
+		struct vec4<float> : vec4_native<float> {};
+		template <>
+		struct vec4<double> : vec4_native<double> {};
+#endif // VTX_SIMD_X86
+
+	}  // namespace simd
+}  // namespace vtx
+
+#endif //VECTRIX_SIMD_DISPATCH_H
@@ -0,0 +1,69 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Instantiates a stream kernel file once per backend namespace.
+// Define VTX_SIMD_KERNELS as the quoted path of the file, then include this header:
+//
+//   #define VTX_SIMD_KERNELS "vectrix/core/detail/soa_kernels.inl"
+//   #include "vectrix/simd/foreach_backend.h"
+//
+// Kernel files are written against batch<T> of the enclosing namespace and use
+// scalar::batch<T> for loop tails. Pick the instantiation with simd::select(VTX_SIMD_FN(...)).
+// No include guard on purpose.
+
+#ifndef VTX_SIMD_KERNELS
+#error "Define VTX_SIMD_KERNELS before including vectrix/simd/foreach_backend.h"
+#endif // VTX_SIMD_KERNELS
+
+#include "scalar.h"
+#include "sse2.h"
+#include "avx2.h"
+#include "avx512.h"
+
+namespace vtx {
+	namespace simd {
+		namespace scalar {
+#include VTX_SIMD_KERNELS
+		}  // namespace scalar
+	}  // namespace simd
+}  // namespace vtx
+
+#if VTX_SIMD_X86
+namespace vtx {
+	namespace simd {
+		namespace sse2 {
+#include VTX_SIMD_KERNELS
+		}  // namespace sse2
+	}  // namespace simd
+}  // namespace vtx
+
+VTX_SIMD_TARGET_AVX2_BEGIN
+namespace vtx {
+	namespace simd {
+		namespace avx2 {
+#include VTX_SIMD_KERNELS
+		}  // namespace avx2
+	}  // namespace simd
+}  // namespace vtx
+VTX_SIMD_TARGET_END
+
+VTX_SIMD_TARGET_AVX512_BEGIN
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif // GCC
+namespace vtx {
+	namespace simd {
+		namespace avx512 {
+#include VTX_SIMD_KERNELS
+		}  // namespace avx512
+	}  // namespace simd
+}  // namespace vtx
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif // GCC
+VTX_SIMD_TARGET_END
+#endif // VTX_SIMD_X86
+
+#undef VTX_SIMD_KERNELS
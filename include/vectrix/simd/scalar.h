@@ -0,0 +1,84 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SIMD_SCALAR_H
+#define VECTRIX_SIMD_SCALAR_H
+
+#include "config.h"
+
+namespace vtx {
+	namespace simd {
+		// Scalar backend: one-lane batch, also used for the tails of wide loops
+		namespace scalar {
+
+			template <typename T>
+			struct batch {
+				using value_type = T;
+				static constexpr size_t size = 1;
+
+				// Lane mask
+				struct mask {
+					bool m;
+
+					friend VTX_FORCEINLINE mask operator&(mask a, mask b) noexcept { return {a.m && b.m}; }
+					friend VTX_FORCEINLINE mask operator|(mask a, mask b) noexcept { return {a.m || b.m}; }
+					friend VTX_FORCEINLINE mask operator!(mask a) noexcept { return {!a.m}; }
+					VTX_FORCEINLINE bool any() const noexcept { return m; }
+					VTX_FORCEINLINE bool all() const noexcept { return m; }
+					VTX_FORCEINLINE unsigned bits() const noexcept { return m ? 1u : 0u; }
+				};
+
+				T v;
+
+				static VTX_FORCEINLINE batch load(const T *p) noexcept { return {*p}; }
+				VTX_FORCEINLINE void store(T *p) const noexcept { *p = v; }
+				static VTX_FORCEINLINE batch set1(const T s) noexcept { return {s}; }
+				static VTX_FORCEINLINE batch zero() noexcept { return {T(0)}; }
+
+				friend VTX_FORCEINLINE batch operator+(batch a, batch b) noexcept { return {a.v + b.v}; }
+				friend VTX_FORCEINLINE batch operator-(batch a, batch b) noexcept { return {a.v - b.v}; }
+				friend VTX_FORCEINLINE batch operator*(batch a, batch b) noexcept { return {a.v * b.v}; }
+				friend VTX_FORCEINLINE batch operator/(batch a, batch b) noexcept { return {a.v / b.v}; }
+				friend VTX_FORCEINLINE batch operator-(batch a) noexcept { return {-a.v}; }
+
+				friend VTX_FORCEINLINE mask operator<(batch a, batch b) noexcept { return {a.v < b.v}; }
+				friend VTX_FORCEINLINE mask operator<=(batch a, batch b) noexcept { return {a.v <= b.v}; }
+				friend VTX_FORCEINLINE mask operator>(batch a, batch b) noexcept { return {a.v > b.v}; }
+				friend VTX_FORCEINLINE mask operator>=(batch a, batch b) noexcept { return {a.v >= b.v}; }
+				friend VTX_FORCEINLINE mask operator==(batch a, batch b) noexcept { return {a.v == b.v}; }
+				friend VTX_FORCEINLINE mask operator!=(batch a, batch b) noexcept { return {a.v != b.v}; }
+
+				// a * b + c
+				static VTX_FORCEINLINE batch fmadd(batch a, batch b, batch c) noexcept {
+					return {a.v * b.v + c.v};
+				}
+				// c - a * b
+				static VTX_FORCEINLINE batch fnmadd(batch a, batch b, batch c) noexcept {
+					return {c.v - a.v * b.v};
+				}
+
+				static VTX_FORCEINLINE batch min(batch a, batch b) noexcept { return {b.v < a.v ? b.v : a.v}; }
+				static VTX_FORCEINLINE batch max(batch a, batch b) noexcept { return {a.v < b.v ? b.v : a.v}; }
+				static VTX_FORCEINLINE batch sqrt(batch a) noexcept { return {std::sqrt(a.v)}; }
+				static VTX_FORCEINLINE batch abs(batch a) noexcept { return {std::abs(a.v)}; }
+
+				// m ? a : b
+				static VTX_FORCEINLINE batch select(mask m, batch a, batch b) noexcept {
+					return {m.m ? a.v : b.v};
+				}
+
+				VTX_FORCEINLINE T hsum() const noexcept { return v; }
+			};
+
+			// Widest batch of the backend for T
+			template <typename T>
+			struct batch_for {
+				using type = batch<T>;
+			};
+
+		}  // namespace scalar
+	}  // namespace simd
+}  // namespace vtx
+
+#endif //VECTRIX_SIMD_SCALAR_H
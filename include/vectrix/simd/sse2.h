@@ -0,0 +1,393 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_SIMD_SSE2_H
+#define VECTRIX_SIMD_SSE2_H
+
+#include <cstdint>
+
+#include "config.h"
+#include "scalar.h"
+
+#if VTX_SIMD_X86
+
+namespace vtx {
+	namespace simd {
+		// SSE2 backend (baseline of every x86-64 CPU)
+		namespace sse2 {
+
+			template <typename T>
+			struct pack4;
+
+			// 4 floats in one XMM register
+			template <>
+			struct pack4<float> {
+				__m128 v;
+
+				static VTX_FORCEINLINE pack4 load(const float *p) noexcept {
+					return {_mm_loadu_ps(p)};
+				}
+				VTX_FORCEINLINE void store(float *p) const noexcept { _mm_storeu_ps(p, v); }
+				static VTX_FORCEINLINE pack4 set1(const float s) noexcept {
+					return {_mm_set1_ps(s)};
+				}
+				static VTX_FORCEINLINE pack4 set(float a, float b, float c, float d) noexcept {
+					return {_mm_setr_ps(a, b, c, d)};
+				}
+
+				VTX_FORCEINLINE float lane(const int i) const noexcept {
+					alignas(16) float tmp[4];
+					_mm_store_ps(tmp, v);
+					return tmp[i];
+				}
+
+				friend VTX_FORCEINLINE pack4 operator+(pack4 a, pack4 b) noexcept {
+					return {_mm_add_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE pack4 operator-(pack4 a, pack4 b) noexcept {
+					return {_mm_sub_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE pack4 operator*(pack4 a, pack4 b) noexcept {
+					return {_mm_mul_ps(a.v, b.v)};
+				}
+
+				// a * b + c
+				static VTX_FORCEINLINE pack4 fmadd(pack4 a, pack4 b, pack4 c) noexcept {
+					return {_mm_add_ps(_mm_mul_ps(a.v, b.v), c.v)};
+				}
+
+				// [v[i0], v[i1], v[i2], v[i3]]
+				template <int i0, int i1, int i2, int i3>
+				VTX_FORCEINLINE pack4 swizzle() const noexcept {
+					return {_mm_shuffle_ps(v, v, _MM_SHUFFLE(i3, i2, i1, i0))};
+				}
+
+				// [a[i0], a[i1], b[i2], b[i3]]
+				template <int i0, int i1, int i2, int i3>
+				static VTX_FORCEINLINE pack4 shuffle(pack4 a, pack4 b) noexcept {
+					return {_mm_shuffle_ps(a.v, b.v, _MM_SHUFFLE(i3, i2, i1, i0))};
+				}
+
+				VTX_FORCEINLINE float hsum() const noexcept {
+					const __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+					return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+				}
+
+				static VTX_FORCEINLINE void transpose(pack4 &r0, pack4 &r1, pack4 &r2, pack4 &r3) noexcept {
+					_MM_TRANSPOSE4_PS(r0.v, r1.v, r2.v, r3.v);
+				}
+			};
+
+			// 4 doubles in two XMM registers (lanes 0-1 and 2-3)
+			template <>
+			struct pack4<double> {
+				__m128d lo, hi;
+
+				static VTX_FORCEINLINE pack4 load(const double *p) noexcept {
+					return {_mm_loadu_pd(p), _mm_loadu_pd(p + 2)};
+				}
+				VTX_FORCEINLINE void store(double *p) const noexcept {
+					_mm_storeu_pd(p, lo);
+					_mm_storeu_pd(p + 2, hi);
+				}
+				static VTX_FORCEINLINE pack4 set1(const double s) noexcept {
+					return {_mm_set1_pd(s), _mm_set1_pd(s)};
+				}
+				static VTX_FORCEINLINE pack4 set(double a, double b, double c, double d) noexcept {
+					return {_mm_setr_pd(a, b), _mm_setr_pd(c, d)};
+				}
+
+				VTX_FORCEINLINE double lane(const int i) const noexcept {
+					alignas(16) double tmp[4];
+					store(tmp);
+					return tmp[i];
+				}
+
+				friend VTX_FORCEINLINE pack4 operator+(pack4 a, pack4 b) noexcept {
+					return {_mm_add_pd(a.lo, b.lo), _mm_add_pd(a.hi, b.hi)};
+				}
+				friend VTX_FORCEINLINE pack4 operator-(pack4 a, pack4 b) noexcept {
+					return {_mm_sub_pd(a.lo, b.lo), _mm_sub_pd(a.hi, b.hi)};
+				}
+				friend VTX_FORCEINLINE pack4 operator*(pack4 a, pack4 b) noexcept {
+					return {_mm_mul_pd(a.lo, b.lo), _mm_mul_pd(a.hi, b.hi)};
+				}
+
+				static VTX_FORCEINLINE pack4 fmadd(pack4 a, pack4 b, pack4 c) noexcept {
+					return a * b + c;
+				}
+
+				// Register holding lane i
+				template <int i>
+				VTX_FORCEINLINE __m128d half() const noexcept {
+					return i < 2 ? lo : hi;
+				}
+
+				template <int i0, int i1, int i2, int i3>
+				VTX_FORCEINLINE pack4 swizzle() const noexcept {
+					return shuffle<i0, i1, i2, i3>(*this, *this);
+				}
+
+				template <int i0, int i1, int i2, int i3>
+				static VTX_FORCEINLINE pack4 shuffle(pack4 a, pack4 b) noexcept {
+					return {_mm_shuffle_pd(a.template half<i0>(), a.template half<i1>(),
+					            (i0 & 1) | ((i1 & 1) << 1)),
+					    _mm_shuffle_pd(
+					        b.template half<i2>(), b.template half<i3>(), (i2 & 1) | ((i3 & 1) << 1))};
+				}
+
+				VTX_FORCEINLINE double hsum() const noexcept {
+					const __m128d s = _mm_add_pd(lo, hi);
+					return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+				}
+
+				static VTX_FORCEINLINE void transpose(pack4 &r0, pack4 &r1, pack4 &r2, pack4 &r3) noexcept {
+					const pack4 t0 = {_mm_unpacklo_pd(r0.lo, r1.lo), _mm_unpacklo_pd(r2.lo, r3.lo)},
+					            t1 = {_mm_unpackhi_pd(r0.lo, r1.lo), _mm_unpackhi_pd(r2.lo, r3.lo)},
+					            t2 = {_mm_unpacklo_pd(r0.hi, r1.hi), _mm_unpacklo_pd(r2.hi, r3.hi)},
+					            t3 = {_mm_unpackhi_pd(r0.hi, r1.hi), _mm_unpackhi_pd(r2.hi, r3.hi)};
+					r0 = t0;
+					r1 = t1;
+					r2 = t2;
+					r3 = t3;
+				}
+			};
+
+#include "detail/kernels4.inl"
+
+			// Wide batches for stream kernels
+			template <typename T>
+			struct batch;
+
+			// Widest batch of the backend for T (types without one run lane by lane)
+			template <typename T>
+			struct batch_for {
+				using type = scalar::batch<T>;
+			};
+			template <>
+			struct batch_for<float> {
+				using type = batch<float>;
+			};
+			template <>
+			struct batch_for<double> {
+				using type = batch<double>;
+			};
+
+			template <>
+			struct batch<float> {
+				using value_type = float;
+				static constexpr size_t size = 4;
+
+				// Lane mask (all bits set in active lanes)
+				struct mask {
+					__m128 m;
+
+					friend VTX_FORCEINLINE mask operator&(mask a, mask b) noexcept {
+						return {_mm_and_ps(a.m, b.m)};
+					}
+					friend VTX_FORCEINLINE mask operator|(mask a, mask b) noexcept {
+						return {_mm_or_ps(a.m, b.m)};
+					}
+					friend VTX_FORCEINLINE mask operator!(mask a) noexcept {
+						return {_mm_xor_ps(a.m, _mm_castsi128_ps(_mm_set1_epi32(-1)))};
+					}
+					VTX_FORCEINLINE bool any() const noexcept { return _mm_movemask_ps(m) != 0; }
+					VTX_FORCEINLINE bool all() const noexcept { return _mm_movemask_ps(m) == 0xF; }
+					VTX_FORCEINLINE unsigned bits() const noexcept {
+						return static_cast<unsigned>(_mm_movemask_ps(m));
+					}
+				};
+
+				__m128 v;
+
+				static VTX_FORCEINLINE batch load(const float *p) noexcept {
+					return {_mm_loadu_ps(p)};
+				}
+				VTX_FORCEINLINE void store(float *p) const noexcept { _mm_storeu_ps(p, v); }
+				static VTX_FORCEINLINE batch set1(const float s) noexcept {
+					return {_mm_set1_ps(s)};
+				}
+				static VTX_FORCEINLINE batch zero() noexcept { return {_mm_setzero_ps()}; }
+
+				friend VTX_FORCEINLINE batch operator+(batch a, batch b) noexcept {
+					return {_mm_add_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator-(batch a, batch b) noexcept {
+					return {_mm_sub_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator*(batch a, batch b) noexcept {
+					return {_mm_mul_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator/(batch a, batch b) noexcept {
+					return {_mm_div_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator-(batch a) noexcept {
+					return {_mm_xor_ps(a.v, _mm_set1_ps(-float(0)))};
+				}
+
+				friend VTX_FORCEINLINE mask operator<(batch a, batch b) noexcept {
+					return {_mm_cmplt_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE mask operator<=(batch a, batch b) noexcept {
+					return {_mm_cmple_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE mask operator>(batch a, batch b) noexcept {
+					return {_mm_cmpgt_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE mask operator>=(batch a, batch b) noexcept {
+					return {_mm_cmpge_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE mask operator==(batch a, batch b) noexcept {
+					return {_mm_cmpeq_ps(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE mask operator!=(batch a, batch b) noexcept {
+					return {_mm_cmpneq_ps(a.v, b.v)};
+				}
+
+				// a * b + c
+				static VTX_FORCEINLINE batch fmadd(batch a, batch b, batch c) noexcept {
+					return {_mm_add_ps(_mm_mul_ps(a.v, b.v), c.v)};
+				}
+				// c - a * b
+				static VTX_FORCEINLINE batch fnmadd(batch a, batch b, batch c) noexcept {
+					return {_mm_sub_ps(c.v, _mm_mul_ps(a.v, b.v))};
+				}
+
+				static VTX_FORCEINLINE batch min(batch a, batch b) noexcept {
+					return {_mm_min_ps(a.v, b.v)};
+				}
+				static VTX_FORCEINLINE batch max(batch a, batch b) noexcept {
+					return {_mm_max_ps(a.v, b.v)};
+				}
+				static VTX_FORCEINLINE batch sqrt(batch a) noexcept { return {_mm_sqrt_ps(a.v)}; }
+				static VTX_FORCEINLINE batch abs(batch a) noexcept {
+					return {_mm_andnot_ps(_mm_set1_ps(-float(0)), a.v)};
+				}
+
+				// m ? a : b
+				static VTX_FORCEINLINE batch select(mask m, batch a, batch b) noexcept {
+					return {_mm_or_ps(_mm_and_ps(m.m, a.v), _mm_andnot_ps(m.m, b.v))};
+				}
+
+				VTX_FORCEINLINE float hsum() const noexcept {
+					alignas(64) float tmp[size];
+					store(tmp);
+					float s = tmp[0];
+					for (size_t i = 1; i < size; ++i) s += tmp[i];
+					return s;
+				}
+			};
+
+			template <>
+			struct batch<double> {
+				using value_type = double;
+				static constexpr size_t size = 2;
+
+				// Lane mask (all bits set in active lanes)
+				struct mask {
+					__m128d m;
+
+					friend VTX_FORCEINLINE mask operator&(mask a, mask b) noexcept {
+						return {_mm_and_pd(a.m, b.m)};
+					}
+					friend VTX_FORCEINLINE mask operator|(mask a, mask b) noexcept {
+						return {_mm_or_pd(a.m, b.m)};
+					}
+					friend VTX_FORCEINLINE mask operator!(mask a) noexcept {
+						return {_mm_xor_pd(a.m, _mm_castsi128_pd(_mm_set1_epi32(-1)))};
+					}
+					VTX_FORCEINLINE bool any() const noexcept { return _mm_movemask_pd(m) != 0; }
+					VTX_FORCEINLINE bool all() const noexcept { return _mm_movemask_pd(m) == 0x3; }
+					VTX_FORCEINLINE unsigned bits() const noexcept {
+						return static_cast<unsigned>(_mm_movemask_pd(m));
+					}
+				};
+
+				__m128d v;
+
+				static VTX_FORCEINLINE batch load(const double *p) noexcept {
+					return {_mm_loadu_pd(p)};
+				}
+				VTX_FORCEINLINE void store(double *p) const noexcept { _mm_storeu_pd(p, v); }
+				static VTX_FORCEINLINE batch set1(const double s) noexcept {
+					return {_mm_set1_pd(s)};
+				}
+				static VTX_FORCEINLINE batch zero() noexcept { return {_mm_setzero_pd()}; }
+
+				friend VTX_FORCEINLINE batch operator+(batch a, batch b) noexcept {
+					return {_mm_add_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator-(batch a, batch b) noexcept {
+					return {_mm_sub_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator*(batch a, batch b) noexcept {
+					return {_mm_mul_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator/(batch a, batch b) noexcept {
+					return {_mm_div_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE batch operator-(batch a) noexcept {
+					return {_mm_xor_pd(a.v, _mm_set1_pd(-double(0)))};
+				}
+
+				friend VTX_FORCEINLINE mask operator<(batch a, batch b) noexcept {
+					return {_mm_cmplt_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE mask operator<=(batch a, batch b) noexcept {
+					return {_mm_cmple_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE mask operator>(batch a, batch b) noexcept {
+					return {_mm_cmpgt_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE mask operator>=(batch a, batch b) noexcept {
+					return {_mm_cmpge_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE mask operator==(batch a, batch b) noexcept {
+					return {_mm_cmpeq_pd(a.v, b.v)};
+				}
+				friend VTX_FORCEINLINE mask operator!=(batch a, batch b) noexcept {
+					return {_mm_cmpneq_pd(a.v, b.v)};
+				}
+
+				// a * b + c
+				static VTX_FORCEINLINE batch fmadd(batch a, batch b, batch c) noexcept {
+					return {_mm_add_pd(_mm_mul_pd(a.v, b.v), c.v)};
+				}
+				// c - a * b
+				static VTX_FORCEINLINE batch fnmadd(batch a, batch b, batch c) noexcept {
+					return {_mm_sub_pd(c.v, _mm_mul_pd(a.v, b.v))};
+				}
+
+				static VTX_FORCEINLINE batch min(batch a, batch b) noexcept {
+					return {_mm_min_pd(a.v, b.v)};
+				}
+				static VTX_FORCEINLINE batch max(batch a, batch b) noexcept {
+					return {_mm_max_pd(a.v, b.v)};
+				}
+				static VTX_FORCEINLINE batch sqrt(batch a) noexcept { return {_mm_sqrt_pd(a.v)}; }
+				static VTX_FORCEINLINE batch abs(batch a) noexcept {
+					return {_mm_andnot_pd(_mm_set1_pd(-double(0)), a.v)};
+				}
+
+				// m ? a : b
+				static VTX_FORCEINLINE batch select(mask m, batch a, batch b) noexcept {
+					return {_mm_or_pd(_mm_and_pd(m.m, a.v), _mm_andnot_pd(m.m, b.v))};
+				}
+
+				VTX_FORCEINLINE double hsum() const noexcept {
+					alignas(64) double tmp[size];
+					store(tmp);
+					double s = tmp[0];
+					for (size_t i = 1; i < size; ++i) s += tmp[i];
+					return s;
+				}
+			};
+
+		}  // namespace sse2
+	}  // namespace simd
+}  // namespace vtx
+
+#endif // VTX_SIMD_X86
+
+#endif //VECTRIX_SIMD_SSE2_H
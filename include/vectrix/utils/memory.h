@@ -0,0 +1,77 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#ifndef VECTRIX_UTILS_MEMORY_H
+#define VECTRIX_UTILS_MEMORY_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+namespace vtx {
+	// Cache line (and widest SIMD register) size
+	constexpr size_t CACHE_LINE = 64;
+
+	// Allocate size bytes aligned to align (power of two). Throws std::bad_alloc.
+	inline void *alignedAlloc(const size_t size, const size_t align) {
+		if (size == 0) return nullptr;
+#if defined(_MSC_VER)
+		void *p = _aligned_malloc(size, align);
+#else
+		void *p = nullptr;
+		if (posix_memalign(&p, align < sizeof(void *) ? sizeof(void *) : align, size) != 0)
+			p = nullptr;
+#endif  // _MSC_VER
+		if (p == nullptr) throw std::bad_alloc();
+		return p;
+	}
+
+	// Free memory from alignedAlloc
+	inline void alignedFree(void *p) noexcept {
+#if defined(_MSC_VER)
+		_aligned_free(p);
+#else
+		free(p);
+#endif  // _MSC_VER
+	}
+
+	// Standard allocator returning Align-aligned storage (for SIMD streams)
+	template <typename T, size_t Align = CACHE_LINE>
+	class aligned_allocator {
+	public:
+		static_assert((Align & (Align - 1)) == 0, "Alignment must be a power of two");
+
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = std::ptrdiff_t;
+
+		template <typename U>
+		struct rebind {
+			using other = aligned_allocator<U, Align>;
+		};
+
+		aligned_allocator() noexcept = default;
+		template <typename U>
+		aligned_allocator(const aligned_allocator<U, Align> &) noexcept {}
+
+		T *allocate(const size_t n) {
+			if (n > std::numeric_limits<size_t>::max() / sizeof(T)) throw std::bad_alloc();
+			return static_cast<T *>(alignedAlloc(n * sizeof(T), Align));
+		}
+
+		void deallocate(T *p, size_t) noexcept { alignedFree(p); }
+
+		template <typename U>
+		bool operator==(const aligned_allocator<U, Align> &) const noexcept {
+			return true;
+		}
+		template <typename U>
+		bool operator!=(const aligned_allocator<U, Align> &) const noexcept {
+			return false;
+		}
+	};
+}  // namespace vtx
+
+#endif //VECTRIX_UTILS_MEMORY_H
@@ -0,0 +1,153 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/core/affine3.h"
+
+#include <random>
+
+namespace {
+    const vtx::simd::backend affineBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    template<typename T>
+    void requireClose( const vtx::matrix<T, 4, 4> &a, const vtx::matrix<T, 4, 4> &b, const double tol ) {
+        for (size_t r = 0; r < 4; ++r)
+            for (size_t c = 0; c < 4; ++c)
+                REQUIRE(a(r, c) == Catch::Approx(b(r, c)).margin(tol));
+    }
+
+    // Random affine transforms: scale * rotation * translation
+    template<typename T>
+    std::vector<vtx::affine3<T>> randomTransforms( const size_t n, const unsigned seed ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> dist(T(-1), T(1));
+        std::vector<vtx::affine3<T>> v(n);
+        for (auto &a : v) {
+            const vtx::vector<T, 3> axis = vtx::vector<T, 3>(dist(gen), dist(gen), T(2)).normalized();
+            const auto m = vtx::matrix<T, 4, 4>::scale({T(1.5) + dist(gen), T(1.5) + dist(gen), T(1)}) *
+                           vtx::matrix<T, 4, 4>::rotate(axis, dist(gen) * T(180)) *
+                           vtx::matrix<T, 4, 4>::translate({dist(gen), dist(gen), dist(gen)});
+            a = vtx::affine3<T>(m);
+        }
+        return v;
+    }
+}
+
+TEST_CASE("Affine 3x4 transform", "[affine3]") {
+    using mat = vtx::mat4x4<double>;
+    using aff = vtx::affine3<double>;
+    const vtx::vector<double, 3> axis = vtx::vector<double, 3>(0.3, -1.0, 0.6).normalized();
+    const vtx::vector<double, 3> t(1.5, -2.0, 4.0);
+    const mat rigidM = mat::rotate(axis, 37.0) * mat::translate(t);
+    const mat affineM = mat::scale({2.0, 0.5, -3.0}) * mat::rotateX(25.0) * mat::translate(t);
+    const aff rigid(rigidM), affine(affineM);
+
+    SECTION("Conversion to and from matrix<T, 4, 4>") {
+        REQUIRE(rigid.toMatrix() == rigidM);
+        REQUIRE(aff(affine.toMatrix()) == affine);
+        REQUIRE(affine(3, 1) == affineM(3, 1));
+        REQUIRE(aff::identity().toMatrix() == mat::identity());
+        REQUIRE(aff::translate(t).toMatrix() == mat::translate(t));
+        REQUIRE(aff::scale(t).toMatrix() == mat::scale(t));
+        REQUIRE(affine.linear()(1, 2) == affineM(1, 2));
+        REQUIRE(affine.translation()[2] == affineM(3, 2));
+        REQUIRE(affine.determinant() == Catch::Approx(affineM.determinant()));
+    }
+
+    SECTION("Composition and inverse") {
+        requireClose((rigid * affine).toMatrix(), rigidM * affineM, 1e-12);
+        requireClose((affine * rigid).toMatrix(), affineM * rigidM, 1e-12);
+        aff c = affine;
+        c *= rigid;
+        REQUIRE(c == affine * rigid);
+
+        requireClose(affine.inverse().toMatrix(), affineM.inverse(), 1e-12);
+        requireClose(rigid.inverseRigid().toMatrix(), rigidM.inverse(), 1e-12);
+        requireClose(rigid.inverse(vtx::transform_kind::rigid).toMatrix(), rigidM.inverse(), 1e-12);
+        requireClose((affine * affine.inverse()).toMatrix(), mat::identity(), 1e-12);
+        REQUIRE(aff::scale({1.0, 0.0, 1.0}).inverse() == aff::identity());
+    }
+
+    SECTION("Point, vector and normal transforms") {
+        const vtx::vector<double, 3> p(0.2, 0.9, -0.4);
+        for (size_t k = 0; k < 3; ++k) {
+            REQUIRE(affine.transformPoint(p)[k] == Catch::Approx(affineM.transformPoint(p)[k]));
+            REQUIRE(affine.transformVector(p)[k] == Catch::Approx(affineM.transformVector(p)[k]));
+            REQUIRE(affine.transformNormal(p)[k] == Catch::Approx(affineM.transformNormal(p)[k]));
+            REQUIRE(rigid.transformNormal(p, vtx::transform_kind::rigid)[k] ==
+                    Catch::Approx(rigidM.transformNormal(p)[k]));
+        }
+
+        std::vector<vtx::vector<double, 3>> points(11, p), normals(11, p);
+        affine.transformPoint(points.data(), points.data(), points.size());
+        affine.transformNormal(normals.data(), normals.data(), normals.size());
+        for (size_t i = 0; i < points.size(); ++i)
+            for (size_t k = 0; k < 3; ++k) {
+                REQUIRE(points[i][k] == Catch::Approx(affineM.transformPoint(p)[k]));
+                REQUIRE(normals[i][k] == Catch::Approx(affineM.transformNormal(p)[k]));
+            }
+    }
+
+    SECTION("Quaternion conversion") {
+        // Rotations hitting every branch of the matrix to quaternion conversion
+        const double angles[] = {30.0, 170.0, -175.0, 179.0};
+        const vtx::vector<double, 3> axes[] = {axis, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+        for (size_t i = 0; i < 4; ++i) {
+            const aff r(mat::rotate(axes[i], angles[i]) * mat::translate(t));
+            const auto q = r.toQuaternion();
+            const aff back(q, r.translation());
+            INFO("rotation " << i);
+            REQUIRE(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3] == Catch::Approx(1.0));
+            requireClose(back.toMatrix(), r.toMatrix(), 1e-12);
+        }
+
+        const vtx::quaternion<double> q(0.0, 0.0, std::sin(0.25), std::cos(0.25));
+        const auto m = aff(q).toMatrix();
+        REQUIRE(m(0, 0) == Catch::Approx(std::cos(0.5)));
+        REQUIRE(m(0, 1) == Catch::Approx(std::sin(0.5)));
+        REQUIRE(m(3, 3) == 1.0);
+    }
+}
+
+TEST_CASE("Affine 3x4 batch composition", "[affine3]") {
+    const size_t n = 157;
+    const auto a = randomTransforms<float>(n, 1), b = randomTransforms<float>(n, 2);
+    std::vector<std::uint32_t> parent(n);
+    for (size_t i = 0; i < n; ++i)
+        parent[i] = static_cast<std::uint32_t>((i * 7) % 13);
+
+    for (const auto be : affineBackends) {
+        if (!vtx::simd::force(be))
+            continue;
+        INFO("backend " << vtx::simd::name(be));
+
+        std::vector<vtx::affine3<float>> out(n), world(n), inPlace = a;
+        vtx::affine3<float>::compose(a.data(), b.data(), out.data(), n);
+        vtx::affine3<float>::compose(a.data(), b.data(), parent.data(), world.data(), n);
+        vtx::affine3<float>::compose(inPlace.data(), b.data(), inPlace.data(), n);
+
+        for (size_t i = 0; i < n; ++i) {
+            INFO("transform " << i);
+            const auto r = a[i] * b[i], w = a[i] * b[parent[i]];
+            for (size_t c = 0; c < 3; ++c)
+                for (size_t k = 0; k < 4; ++k) {
+                    REQUIRE(out[i].elements[c][k] == Catch::Approx(r.elements[c][k]).margin(1e-5));
+                    REQUIRE(world[i].elements[c][k] == Catch::Approx(w.elements[c][k]).margin(1e-5));
+                }
+            REQUIRE(inPlace[i] == out[i]);
+        }
+    }
+    vtx::simd::reset();
+
+    const auto big = randomTransforms<double>(20001, 3);
+    std::vector<vtx::affine3<double>> seq(big.size()), par(big.size());
+    vtx::affine3<double>::compose(big.data(), big.data(), seq.data(), big.size());
+    vtx::affine3<double>::compose(big.data(), big.data(), par.data(), big.size(), vtx::parallel::policy::par);
+    REQUIRE(seq == par);
+}
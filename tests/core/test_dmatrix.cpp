@@ -0,0 +1,159 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/core/dmatrix.h"
+
+#include <limits>
+#include <random>
+
+namespace {
+    const vtx::simd::backend gemmBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    template<typename T>
+    vtx::dmatrix<T> randomMatrix( const size_t rows, const size_t cols, const unsigned seed ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> dist(T(-1), T(1));
+        vtx::dmatrix<T> a(rows, cols);
+        for (size_t i = 0; i < rows; ++i)
+            for (size_t j = 0; j < cols; ++j)
+                a(i, j) = dist(gen);
+        return a;
+    }
+
+    // Reference alpha * a * b + beta * c in double
+    template<typename T>
+    vtx::dmatrix<double> naiveGemm( const T alpha, const vtx::dmatrix<T> &a, const vtx::dmatrix<T> &b,
+                                    const T beta, const vtx::dmatrix<T> &c ) {
+        vtx::dmatrix<double> r(a.rows(), b.cols());
+        for (size_t i = 0; i < a.rows(); ++i)
+            for (size_t j = 0; j < b.cols(); ++j) {
+                double sum = 0;
+                for (size_t p = 0; p < a.cols(); ++p)
+                    sum += double(a(i, p)) * double(b(p, j));
+                r(i, j) = alpha * sum + (beta == T(0) ? 0.0 : double(beta) * double(c(i, j)));
+            }
+        return r;
+    }
+
+    template<typename T>
+    void requireNear( const vtx::dmatrix<T> &a, const vtx::dmatrix<double> &ref, const double tol ) {
+        REQUIRE(a.rows() == ref.rows());
+        REQUIRE(a.cols() == ref.cols());
+        for (size_t i = 0; i < a.rows(); ++i)
+            for (size_t j = 0; j < a.cols(); ++j)
+                REQUIRE(double(a(i, j)) == Catch::Approx(ref(i, j)).margin(tol));
+    }
+
+    template<typename T>
+    void checkGemmShapes( const double tol ) {
+        // Tile, block and small-product edges of every backend
+        const size_t shapes[][3] = {
+            {1, 1, 1}, {7, 13, 5}, {33, 17, 70}, {65, 129, 257}, {121, 33, 300}, {12, 2050, 3}, {0, 5, 4}, {6, 4, 0}
+        };
+
+        for (const auto be : gemmBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+
+            for (const auto &s : shapes) {
+                INFO("m " << s[0] << " n " << s[1] << " k " << s[2]);
+                const auto a = randomMatrix<T>(s[0], s[2], 1), b = randomMatrix<T>(s[2], s[1], 2);
+                const auto c0 = randomMatrix<T>(s[0], s[1], 3);
+
+                requireNear(a * b, naiveGemm(T(1), a, b, T(0), c0), tol);
+
+                auto c = c0;
+                vtx::gemm(T(0.5), a, b, T(-2), c);
+                requireNear(c, naiveGemm(T(0.5), a, b, T(-2), c0), tol);
+
+                // beta == 0 must not read C
+                vtx::dmatrix<T> nan(s[0], s[1], std::numeric_limits<T>::quiet_NaN());
+                vtx::gemm(T(2), a, b, T(0), nan);
+                requireNear(nan, naiveGemm(T(2), a, b, T(0), c0), 2 * tol);
+            }
+        }
+        vtx::simd::reset();
+    }
+}
+
+TEST_CASE("dmatrix GEMM matches the naive product", "[dmatrix]") {
+    checkGemmShapes<float>(1e-3);
+    checkGemmShapes<double>(1e-10);
+}
+
+TEST_CASE("dmatrix construction and element access", "[dmatrix]") {
+    vtx::dmatrix<double> a = {{1, 2, 3}, {4, 5, 6}};
+    REQUIRE(a.rows() == 2);
+    REQUIRE(a.cols() == 3);
+    REQUIRE(a(1, 2) == 6);
+    REQUIRE(a[1][0] == 4);
+    REQUIRE(reinterpret_cast<uintptr_t>(a.data()) % vtx::CACHE_LINE == 0);
+
+    const auto t = a.transpose();
+    REQUIRE(t.rows() == 3);
+    REQUIRE(t(2, 1) == 6);
+    REQUIRE(t.transpose() == a);
+
+    const auto big = randomMatrix<float>(70, 45, 4);
+    const auto bigT = big.transpose();
+    for (size_t i = 0; i < big.rows(); ++i)
+        for (size_t j = 0; j < big.cols(); ++j)
+            REQUIRE(bigT(j, i) == big(i, j));
+
+    REQUIRE((a + a) == a * 2.0);
+    REQUIRE((a - a) == vtx::dmatrix<double>(2, 3));
+    REQUIRE(-a == a * -1.0);
+    REQUIRE(vtx::dmatrix<double>::identity(3).trace() == 3);
+    REQUIRE((a * vtx::dmatrix<double>::identity(3)) == a);
+}
+
+TEST_CASE("dmatrix and dvector interop with fixed-size types", "[dmatrix]") {
+    vtx::dmatrix<double> a(6, 6);
+    const vtx::matrix<double, 3, 3> m3 = {{1, 2, 3}, {4, 5, 6}, {7, 8, 10}};
+    a.setBlock(2, 3, m3);
+    REQUIRE(a(2, 3) == 1);
+    REQUIRE(a(4, 5) == 10);
+    REQUIRE(a.block<3, 3>(2, 3) == m3);
+    REQUIRE(a.block<2, 2>(0, 0) == vtx::matrix<double, 2, 2>(0));
+
+    const vtx::dmatrix<double> d3(m3);
+    const vtx::vector<double, 3> v3 = {1, -1, 2};
+    const vtx::dvector<double> dv(v3);
+    const auto r = d3 * dv;
+    const auto ref = m3 * v3;
+    for (size_t i = 0; i < 3; ++i)
+        REQUIRE(r[i] == Catch::Approx(ref[i]));
+
+    vtx::dvector<double> big(8);
+    big.setBlock(5, v3);
+    REQUIRE(big.block<3>(5) == v3);
+    REQUIRE(big.dot(big) == Catch::Approx(v3.dot(v3)));
+    REQUIRE(big.length() == Catch::Approx(v3.length()));
+    REQUIRE((big + big) == big * 2.0);
+}
+
+TEST_CASE("dmatrix parallel GEMM and transpose match the sequential ones", "[dmatrix][parallel]") {
+    const auto a = randomMatrix<float>(300, 257, 5), b = randomMatrix<float>(257, 411, 6);
+    vtx::dmatrix<float> seq, par;
+    vtx::gemm(1.0f, a, b, 0.0f, seq);
+    vtx::gemm(1.0f, a, b, 0.0f, par, vtx::parallel::policy::par);
+    // Every element sums its depth in the same order: results match bit for bit
+    REQUIRE(par == seq);
+
+    auto acc = seq;
+    vtx::gemm(-1.0f, a, b, 1.0f, acc, vtx::parallel::policy::par);
+    for (size_t i = 0; i < acc.rows(); ++i)
+        for (size_t j = 0; j < acc.cols(); ++j)
+            REQUIRE(acc(i, j) == Catch::Approx(0.0f).margin(1e-4));
+
+    const auto big = randomMatrix<double>(513, 300, 7);
+    REQUIRE(big.transpose(vtx::parallel::policy::par) == big.transpose());
+}
@@ -0,0 +1,63 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/core/dual_quaternion.h"
+
+namespace {
+    void requireClose( const vtx::mat4x4<double> &a, const vtx::mat4x4<double> &b ) {
+        for (size_t r = 0; r < 4; ++r)
+            for (size_t c = 0; c < 4; ++c)
+                REQUIRE(a(r, c) == Catch::Approx(b(r, c)).margin(1e-12));
+    }
+}
+
+TEST_CASE("Dual quaternion", "[dual_quaternion]") {
+    using mat = vtx::mat4x4<double>;
+    using dq = vtx::dual_quaternion<double>;
+    const vtx::vector<double, 3> axis = vtx::vector<double, 3>(0.3, -1.0, 0.6).normalized();
+    const mat am = mat::rotate(axis, 37.0) * mat::translate({1.5, -2.0, 4.0});
+    const mat bm = mat::rotateX(-80.0) * mat::translate({0.5, 3.0, -1.0});
+    const dq a(am), b(bm);
+
+    SECTION("Conversion to and from matrix<T, 4, 4>") {
+        requireClose(a.toMatrix(), am);
+        requireClose(dq::identity().toMatrix(), mat::identity());
+        requireClose(dq::translate({1.0, 2.0, 3.0}).toMatrix(), mat::translate({1.0, 2.0, 3.0}));
+        REQUIRE(a.translation()[2] == Catch::Approx(4.0));
+
+        const dq r(a.real, vtx::vector<double, 3>(0.5, 3.0, -1.0));
+        requireClose(r.toMatrix(), a.real.rotateMatr() * mat::translate({0.5, 3.0, -1.0}));
+    }
+
+    SECTION("Product, inverse and transforms") {
+        requireClose((a * b).toMatrix(), bm * am);
+        requireClose((a * a.inverse()).toMatrix(), mat::identity());
+        dq c = a;
+        c *= b;
+        REQUIRE(c == a * b);
+
+        const vtx::vector<double, 3> p(0.2, 0.9, -0.4);
+        for (size_t k = 0; k < 3; ++k) {
+            REQUIRE(a.transformPoint(p)[k] == Catch::Approx(am.transformPoint(p)[k]));
+            REQUIRE(a.transformVector(p)[k] == Catch::Approx(am.transformVector(p)[k]));
+        }
+    }
+
+    SECTION("Normalization of blends") {
+        const dq n = (a * 3.0).normalized();
+        requireClose(n.toMatrix(), am);
+
+        // Equal halves of one transform blend into it
+        const dq h = (a * 0.5 + a * 0.5).normalized();
+        requireClose(h.toMatrix(), am);
+
+        // The blend of two rigid transforms is rigid: unit real part orthogonal to the dual part
+        const dq m = (a * 0.3 + b * 0.7).normalize();
+        REQUIRE(m.real.length() == Catch::Approx(1.0));
+        const double rd =
+            m.real.X * m.dual.X + m.real.Y * m.dual.Y + m.real.Z * m.dual.Z + m.real.W * m.dual.W;
+        REQUIRE(rd == Catch::Approx(0.0).margin(1e-12));
+    }
+}
@@ -0,0 +1,61 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+
+#include "vectrix/core/base_matrix.h"
+
+#ifdef VTX_EXPR_TEMPLATES
+static_assert(vtx::expr::is_expression<
+                  decltype(vtx::vector<double, 8>() + vtx::vector<double, 8>())>::value,
+    "Vector sum must be lazy");
+static_assert(vtx::expr::is_expression<
+                  decltype(vtx::matrix<float, 2, 3>() * 2.0f - vtx::matrix<float, 2, 3>())>::value,
+    "Matrix chain must be lazy");
+static_assert(!vtx::expr::same_shape<vtx::vector<float, 5>, vtx::vector<float, 6>>::value,
+    "Different sizes must not combine");
+#endif // VTX_EXPR_TEMPLATES
+
+TEST_CASE("Element-wise vector chains", "[vector][expression]") {
+    vtx::vector<double, 6> a({1, 2, 3, 4, 5, 6});
+    vtx::vector<double, 6> b({6, 5, 4, 3, 2, 1});
+    vtx::vector<double, 6> c(0.5);
+
+    vtx::vector<double, 6> r = a + b * 2.0 - c;
+    for (size_t i = 0; i < 6; ++i)
+        REQUIRE(r[i] == Catch::Approx(a[i] + b[i] * 2.0 - c[i]));
+
+    r = -(a - b) / 2.0 + a * b / c;
+    for (size_t i = 0; i < 6; ++i)
+        REQUIRE(r[i] == Catch::Approx(-(a[i] - b[i]) / 2.0 + a[i] * b[i] / c[i]));
+
+    // Result aliasing an operand
+    r = a;
+    r = r + r * 3.0;
+    for (size_t i = 0; i < 6; ++i)
+        REQUIRE(r[i] == Catch::Approx(a[i] * 4.0));
+
+    r += a - b;
+    r -= c * 2.0;
+    for (size_t i = 0; i < 6; ++i)
+        REQUIRE(r[i] == Catch::Approx(a[i] * 4.0 + a[i] - b[i] - 1.0));
+
+    REQUIRE(a + b == vtx::vector<double, 6>(7.0));
+    REQUIRE(vtx::vector<double, 6>(a + b).sum() == Catch::Approx(42.0));
+}
+
+TEST_CASE("Element-wise matrix chains", "[matrix][expression]") {
+    vtx::matrix<int, 2, 3> a = {1, 2, 3, 4, 5, 6};
+    vtx::matrix<int, 2, 3> b = {6, 5, 4, 3, 2, 1};
+
+    vtx::matrix<int, 2, 3> r = a * 2 - b + -a;
+    REQUIRE(r == vtx::matrix<int, 2, 3>({-5, -3, -1, 1, 3, 5}));
+
+    r = (a + b) / 7;
+    REQUIRE(r == vtx::matrix<int, 2, 3>(1));
+
+    // Matrix products stay eager
+    const vtx::matrix<int, 3, 2> t = vtx::matrix<int, 2, 3>(a + b).transpose();
+    REQUIRE((a * t) == vtx::matrix<int, 2, 2>({42, 42, 105, 105}));
+}
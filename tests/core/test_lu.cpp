@@ -0,0 +1,127 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+
+#include "vectrix/core/vectrix_core.h"
+#include "vectrix/math/solvers.h"
+
+namespace {
+    // Matrix with known determinant: unit lower * upper (diagonal 1..N), rows rotated by one
+    template<typename T, size_t N>
+    vtx::matrix<T, N, N> knownMatrix( T &det ) {
+        vtx::matrix<T, N, N> l, u, a;
+        for (size_t i = 0; i < N; ++i)
+            for (size_t j = 0; j < N; ++j) {
+                l[i][j] = j < i ? T((i * 3 + j) % 5) - T(2) : (i == j ? T(1) : T(0));
+                u[i][j] = j > i ? T((i + j * 2) % 7) - T(3) : (i == j ? T(i + 1) : T(0));
+            }
+        const vtx::matrix<T, N, N> lu = l * u;
+
+        det = T(1);
+        for (size_t i = 0; i < N; ++i) {
+            det *= T(i + 1);
+            for (size_t j = 0; j < N; ++j)
+                a[i][j] = lu[(i + 1) % N][j];
+        }
+        // Cyclic shift of N rows has sign (-1)^(N-1)
+        if (N % 2 == 0)
+            det = -det;
+        return a;
+    }
+
+    template<typename T, size_t M, size_t N>
+    void requireNear( const vtx::matrix<T, M, N> &a, const vtx::matrix<T, M, N> &b, const T eps ) {
+        for (size_t i = 0; i < M; ++i)
+            for (size_t j = 0; j < N; ++j)
+                REQUIRE(a[i][j] == Catch::Approx(b[i][j]).margin(eps));
+    }
+
+    constexpr vtx::matrix<double, 5, 5> blockMatrix( ) {
+        vtx::matrix<double, 5, 5> a;
+        a(0, 0) = 2;
+        a(0, 4) = a(4, 0) = a(4, 4) = 1;
+        a(1, 1) = 3;
+        a(2, 3) = 4;
+        a(3, 2) = 5;
+        return a;
+    }
+}
+
+TEST_CASE("LU factors reproduce the permuted matrix", "[matrix][lu]") {
+    double det;
+    const auto a = knownMatrix<double, 7>(det);
+    const vtx::lu<double, 7> f(a);
+
+    REQUIRE_FALSE(f.singular());
+    REQUIRE(f.rank() == 7);
+
+    const vtx::matrix<double, 7, 7> prod = f.lower() * f.upper();
+    for (size_t i = 0; i < 7; ++i)
+        for (size_t j = 0; j < 7; ++j)
+            REQUIRE(prod[i][j] == Catch::Approx(a[f.pivot(i)][j]).margin(1e-12));
+}
+
+TEST_CASE("LU determinant and inverse of large matrices", "[matrix][lu]") {
+    double det;
+    const auto a = knownMatrix<double, 9>(det);
+    REQUIRE(a.determinant() == Catch::Approx(det));
+    requireNear(a * a.inverse(), vtx::matrix<double, 9, 9>::identity(), 1e-9);
+
+    float detf;
+    const auto af = knownMatrix<float, 6>(detf);
+    REQUIRE(af.determinant() == Catch::Approx(detf));
+    requireNear(af.inverse() * af, vtx::matrix<float, 6, 6>::identity(), 1e-3f);
+
+    // Integral determinants stay exact
+    int deti;
+    const auto ai = knownMatrix<int, 8>(deti);
+    REQUIRE(ai.determinant() == deti);
+
+    // Singular input (repeated row): zero determinant, identity inverse
+    auto s = a;
+    for (size_t j = 0; j < 9; ++j)
+        s[4][j] = s[1][j];
+    const vtx::lu<double, 9> fs(s);
+    REQUIRE(fs.singular());
+    REQUIRE(fs.rank() == 8);
+    REQUIRE(s.determinant() == Catch::Approx(0.0).margin(1e-9));
+    REQUIRE(fs.inverse() == vtx::matrix<double, 9, 9>::identity());
+}
+
+TEST_CASE("LU solves many right-hand sides", "[matrix][lu]") {
+    double det;
+    const auto a = knownMatrix<double, 5>(det);
+    const vtx::lu<double, 5> f(a);
+
+    vtx::matrix<double, 5, 3> x;
+    for (size_t i = 0; i < 5; ++i)
+        for (size_t c = 0; c < 3; ++c)
+            x[i][c] = double(i) - double(c) * 0.5;
+    requireNear(f.solve(a * x), x, 1e-10);
+
+    vtx::vector<double, 5> v(1.0, -2.0, 3.0, 0.5, 4.0);
+    const vtx::vector<double, 5> sol = f.solve(a * v);
+    for (size_t i = 0; i < 5; ++i)
+        REQUIRE(sol[i] == Catch::Approx(v[i]));
+
+    // Augmented system through the solver
+    vtx::matrix<double, 5, 6> m;
+    const vtx::vector<double, 5> rhs = a * v;
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 5; ++j)
+            m[i][j] = a[i][j];
+        m[i][5] = rhs[i];
+    }
+    const auto res = vtx::solver::linSystem(m);
+    REQUIRE(res.kind == vtx::solver::solution_kind::unique);
+    for (size_t i = 0; i < 5; ++i)
+        REQUIRE(res.x[i][0] == Catch::Approx(v[i]));
+}
+
+TEST_CASE("LU in constant expressions", "[matrix][lu]") {
+    // Block diagonal: {2 1; 1 1} (det 1), 3, swapped {0 4; 5 0} (det -20)
+    constexpr double det = vtx::lu<double, 5>(blockMatrix()).determinant();
+    STATIC_REQUIRE(det == -60.0);
+}
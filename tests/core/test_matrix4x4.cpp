@@ -428,3 +428,110 @@ TEST_CASE("Frustum projection", "[matrix3x3]") {
     REQUIRE(transformed[1] == Catch::Approx(0.0f));
     REQUIRE(transformed[2] == Catch::Approx(0.0f).margin(0.011f));
 }
+
+TEST_CASE("Batch transforms match single transforms", "[matrix4x4]") {
+    // Interleaved vertex layout: position, normal, uv
+    struct Vertex {
+        float pos[3];
+        float normal[3];
+        float uv[2];
+    };
+
+    const auto m = vtx::mat4x4<float>::frustum(-1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 50.0f) *
+                   vtx::mat4x4<float>{
+                       0.8f, 0.1f, 0.0f, 0.0f,
+                       -0.2f, 1.5f, 0.3f, 0.0f,
+                       0.0f, 0.4f, 2.0f, 0.0f,
+                       1.0f, -2.0f, -10.0f, 1.0f
+                   };
+
+    std::vector<Vertex> verts(53);
+    for (size_t i = 0; i < verts.size(); ++i) {
+        const float f = static_cast<float>(i);
+        verts[i] = Vertex{{f * 0.1f, 1.0f - f * 0.05f, -f * 0.2f}, {0.0f, 1.0f, f * 0.01f}, {f, f}};
+    }
+
+    const vtx::simd::backend backends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+    for (const auto be : backends) {
+        if (!vtx::simd::force(be))
+            continue;
+        INFO("backend " << vtx::simd::name(be));
+
+        std::vector<Vertex> out = verts;
+        std::vector<vtx::vector<float, 3>> points(verts.size());
+        const size_t stride = sizeof(Vertex);
+
+        m.transformNormal(&verts[0].normal[0], stride, &out[0].normal[0], stride, out.size());
+        m.transformPoint(&out[0].pos[0], stride, &out[0].pos[0], stride, out.size(), vtx::parallel::policy::par);
+        m.transform4x4(&verts[0].pos[0], stride, &points[0][0], sizeof(points[0]), points.size());
+
+        for (size_t i = 0; i < verts.size(); ++i) {
+            const vtx::vector<float, 3> p(verts[i].pos[0], verts[i].pos[1], verts[i].pos[2]);
+            const vtx::vector<float, 3> n(verts[i].normal[0], verts[i].normal[1], verts[i].normal[2]);
+            const auto tp = m.transformPoint(p), tn = m.transformNormal(n), tq = m.transform4x4(p);
+
+            for (size_t k = 0; k < 3; ++k) {
+                REQUIRE(out[i].pos[k] == Catch::Approx(tp[k]).epsilon(1e-5).margin(1e-5));
+                REQUIRE(out[i].normal[k] == Catch::Approx(tn[k]).epsilon(1e-5).margin(1e-5));
+                REQUIRE(points[i][k] == Catch::Approx(tq[k]).epsilon(1e-5).margin(1e-5));
+            }
+            REQUIRE(out[i].uv[0] == verts[i].uv[0]);
+        }
+
+        // Packed arrays, in place
+        std::vector<vtx::vector<float, 3>> dirs(7, vtx::vector<float, 3>(1.0f, 2.0f, 3.0f));
+        m.transformVector(dirs.data(), dirs.data(), dirs.size());
+        const auto td = m.transformVector(vtx::vector<float, 3>(1.0f, 2.0f, 3.0f));
+        for (const auto &d : dirs)
+            for (size_t k = 0; k < 3; ++k)
+                REQUIRE(d[k] == Catch::Approx(td[k]));
+    }
+    vtx::simd::reset();
+}
+
+TEST_CASE("Matrix 4x4 rigid and affine inverse", "[matrix4x4]") {
+    using mat = vtx::mat4x4<double>;
+    const vtx::vector<double, 3> axis = vtx::vector<double, 3>(0.3, -1.0, 0.6).normalized(), t(1.5, -2.0, 4.0);
+    const mat rigid = mat::rotate(axis, 37.0) * mat::rotateX(-20.0) * mat::translate(t);
+    const mat affine = mat::scale({2.0, 0.5, -3.0}) * mat::rotate(axis, 37.0) * mat::translate(t);
+    const mat general = mat::frustum(-1.0, 1.0, -1.0, 1.0, 1.0, 50.0) * rigid;
+
+    REQUIRE(rigid.kind() == vtx::transform_kind::rigid);
+    REQUIRE(affine.kind() == vtx::transform_kind::affine);
+    REQUIRE(general.kind() == vtx::transform_kind::general);
+    const mat view = mat::view({1.0, 2.0, 3.0}, {0.0, 0.0, 0.0}, {0.0, 1.0, 0.0});
+    REQUIRE(view.kind() == vtx::transform_kind::rigid);
+
+    const auto check = [](const mat &a, const mat &b) {
+        for (size_t r = 0; r < 4; ++r)
+            for (size_t c = 0; c < 4; ++c)
+                REQUIRE(a(r, c) == Catch::Approx(b(r, c)).margin(1e-12));
+    };
+
+    check(rigid.inverseRigid(), rigid.inverse());
+    check(rigid.inverseAffine(), rigid.inverse());
+    check(affine.inverseAffine(), affine.inverse());
+    check(affine.inverse(vtx::transform_kind::affine), affine.inverse());
+    check(general.inverse(vtx::transform_kind::general), general.inverse());
+    check(rigid.normalMatrix(vtx::transform_kind::rigid), rigid.normalMatrix());
+    check(affine.normalMatrix(vtx::transform_kind::affine), affine.normalMatrix());
+
+    REQUIRE(mat::scale({1.0, 0.0, 1.0}).inverseAffine() == mat::identity());
+
+    const vtx::vector<double, 3> n(0.2, 0.9, -0.4);
+    const auto tn = affine.transformNormal(n), tk = affine.transformNormal(n, vtx::transform_kind::affine);
+    std::vector<vtx::vector<double, 3>> normals(9, n);
+    affine.transformNormal(normals.data(), normals.data(), normals.size(), vtx::transform_kind::affine);
+    for (size_t k = 0; k < 3; ++k) {
+        REQUIRE(tk[k] == Catch::Approx(tn[k]));
+        REQUIRE(rigid.transformNormal(n, vtx::transform_kind::rigid)[k] ==
+                Catch::Approx(rigid.transformNormal(n)[k]));
+        for (const auto &v : normals)
+            REQUIRE(v[k] == Catch::Approx(tn[k]));
+    }
+}
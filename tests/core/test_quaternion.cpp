@@ -0,0 +1,67 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/core/matrix4x4.h"
+#include "vectrix/core/quaternion.h"
+
+#include <cmath>
+
+namespace {
+    // Rotation around the unit axis by angle in radians
+    vtx::quaternion<double> axisAngle( const vtx::vector<double, 3> &axis, const double angle ) {
+        const double s = std::sin(angle / 2);
+        return vtx::quaternion<double>(axis[0] * s, axis[1] * s, axis[2] * s, std::cos(angle / 2));
+    }
+
+    void requireClose( const vtx::quaternion<double> &a, const vtx::quaternion<double> &b,
+                       const double tol ) {
+        for (size_t k = 0; k < 4; ++k)
+            REQUIRE(a[k] == Catch::Approx(b[k]).margin(tol));
+    }
+}
+
+TEST_CASE("Quaternion operations", "[quaternion]") {
+    using quat = vtx::quaternion<double>;
+    const vtx::vector<double, 3> axis = vtx::vector<double, 3>(0.3, -1.0, 0.6).normalized();
+
+    SECTION("Named components") {
+        const quat q(1.0, 2.0, 3.0, 4.0);
+        REQUIRE(q.X == 1.0);
+        REQUIRE(q.Y == 2.0);
+        REQUIRE(q.Z == 3.0);
+        REQUIRE(q.W == 4.0);
+        REQUIRE(q.Vec[2] == 3.0);
+    }
+
+    SECTION("Vector rotation matches the rotation matrix") {
+        const quat q = axisAngle(axis, 1.1), r = axisAngle({0.0, 0.0, 1.0}, 0.4);
+        const vtx::vector<double, 3> v(0.2, 0.9, -0.4);
+        const auto m = q.rotateMatr();
+        for (size_t k = 0; k < 3; ++k) {
+            REQUIRE(q.rotateVector(v)[k] == Catch::Approx(m.transformVector(v)[k]));
+            REQUIRE((q * r).rotateVector(v)[k] == Catch::Approx(q.rotateVector(r.rotateVector(v))[k]));
+        }
+        REQUIRE(axisAngle({0.0, 0.0, 1.0}, vtx::math::PI / 2).rotateVector({1.0, 0.0, 0.0})[1] ==
+                Catch::Approx(1.0));
+    }
+
+    SECTION("Slerp and nlerp") {
+        const quat a = axisAngle(axis, 0.3), b = axisAngle(axis, 1.9);
+        requireClose(a.slerp(b, 0.0), a, 1e-12);
+        requireClose(a.slerp(b, 1.0), b, 1e-12);
+        requireClose(a.slerp(b, 0.25), axisAngle(axis, 0.7), 1e-12);
+
+        // The shortest arc: -b is the same rotation
+        requireClose(a.slerp(-b, 0.25), axisAngle(axis, 0.7), 1e-12);
+        requireClose(a.nlerp(-b, 0.5), axisAngle(axis, 1.1), 1e-12);
+        REQUIRE(a.nlerp(b, 0.25).length() == Catch::Approx(1.0));
+
+        // Close and equal quaternions take nlerp instead of dividing by sin(0)
+        const quat c = axisAngle(axis, 0.3 + 1e-9);
+        requireClose(a.slerp(c, 0.5), axisAngle(axis, 0.3 + 5e-10), 1e-12);
+        requireClose(a.slerp(a, 0.7), a, 1e-15);
+        REQUIRE_FALSE(std::isnan(a.slerp(a, 0.7).W));
+    }
+}
@@ -0,0 +1,215 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/core/skinning.h"
+
+#include <random>
+
+namespace {
+    const vtx::simd::backend skinBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    // Random mesh: vertices, k influences per vertex with normalized weights, palette of rigid bones
+    // and one of general affine bones
+    template<typename T>
+    struct mesh {
+        std::vector<vtx::dual_quaternion<T>> palette;
+        std::vector<vtx::mat4x4<T>> matrices;
+        std::vector<std::uint32_t> bones;
+        std::vector<T> weights;
+        std::vector<vtx::vector<T, 3>> positions, normals;
+
+        mesh( const size_t n, const size_t k, const unsigned seed ) {
+            std::mt19937 gen(seed);
+            std::uniform_real_distribution<T> dist(T(-1), T(1));
+            palette.resize(13);
+            for (auto &b : palette) {
+                const vtx::quaternion<T> q(dist(gen), dist(gen), dist(gen), dist(gen));
+                const vtx::vector<T, 3> t(dist(gen), dist(gen), dist(gen));
+                b = vtx::dual_quaternion<T>(q.normalized(), t);
+            }
+            matrices.resize(palette.size());
+            for (auto &b : matrices) {
+                b = vtx::mat4x4<T>::identity() * T(2);
+                for (size_t r = 0; r < 4; ++r)
+                    for (size_t c = 0; c < 3; ++c)
+                        b(r, c) += dist(gen);
+                b(3, 3) = T(1);
+            }
+            bones.resize(n * k);
+            weights.resize(n * k);
+            for (size_t v = 0; v < n; ++v) {
+                T sum = T(0);
+                for (size_t j = 0; j < k; ++j) {
+                    bones[v * k + j] = std::uint32_t(gen() % palette.size());
+                    weights[v * k + j] = T(0.1) + dist(gen) * dist(gen);
+                    sum += weights[v * k + j];
+                }
+                for (size_t j = 0; j < k; ++j)
+                    weights[v * k + j] /= sum;
+            }
+            positions.resize(n);
+            normals.resize(n);
+            for (size_t v = 0; v < n; ++v) {
+                positions[v] = vtx::vector<T, 3>(dist(gen), dist(gen), dist(gen)) * T(5);
+                normals[v] = vtx::vector<T, 3>(dist(gen), dist(gen), T(2)).normalized();
+            }
+        }
+
+        // Per-vertex blend with the dual_quaternion operators
+        vtx::dual_quaternion<T> blend( const size_t v, const size_t k ) const {
+            const auto &first = palette[bones[v * k]];
+            vtx::dual_quaternion<T> s = first * weights[v * k];
+            for (size_t j = 1; j < k; ++j) {
+                const auto &b = palette[bones[v * k + j]];
+                const T d = first.real.X * b.real.X + first.real.Y * b.real.Y + first.real.Z * b.real.Z +
+                            first.real.W * b.real.W;
+                s = s + b * (d < T(0) ? -weights[v * k + j] : weights[v * k + j]);
+            }
+            return s.normalized();
+        }
+
+        // Per-vertex weighted sum of the bone matrices
+        vtx::mat4x4<T> blendMatrix( const size_t v, const size_t k ) const {
+            vtx::mat4x4<T> s = matrices[bones[v * k]] * weights[v * k];
+            for (size_t j = 1; j < k; ++j)
+                s = s + matrices[bones[v * k + j]] * weights[v * k + j];
+            return s;
+        }
+    };
+
+    template<typename T>
+    void checkDualQuaternion( const size_t k, const double tol ) {
+        const size_t n = 53;
+        const mesh<T> m(n, k, unsigned(k));
+        const vtx::soa_vector<T, 3> pos(m.positions.data(), n), nrm(m.normals.data(), n);
+
+        for (const auto be : skinBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+
+            vtx::soa_vector<T, 3> outPos, outNrm;
+            vtx::skinning::dualQuaternion(m.palette.data(), m.bones.data(), m.weights.data(), k, pos, nrm,
+                                          outPos, outNrm);
+            for (size_t v = 0; v < n; ++v) {
+                INFO("vertex " << v);
+                const auto b = m.blend(v, k);
+                const auto p = b.transformPoint(m.positions[v]), nr = b.transformVector(m.normals[v]);
+                for (size_t c = 0; c < 3; ++c) {
+                    REQUIRE(outPos.get(v)[c] == Catch::Approx(p[c]).margin(tol));
+                    REQUIRE(outNrm.get(v)[c] == Catch::Approx(nr[c]).margin(tol));
+                }
+            }
+        }
+        vtx::simd::reset();
+    }
+
+    template<typename T>
+    void checkLinear( const size_t k, const double tol ) {
+        const size_t n = 53;
+        const mesh<T> m(n, k, unsigned(k) + 10);
+        const vtx::soa_vector<T, 3> pos(m.positions.data(), n), nrm(m.normals.data(), n);
+        std::vector<vtx::affine3<T>> affine;
+        for (const auto &b : m.matrices)
+            affine.emplace_back(b);
+
+        for (const auto be : skinBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+
+            vtx::soa_vector<T, 3> outPos, outNrm, affinePos, affineNrm;
+            vtx::skinning::linear(m.matrices.data(), m.bones.data(), m.weights.data(), k, pos, nrm, outPos,
+                                  outNrm);
+            vtx::skinning::linear(affine.data(), m.bones.data(), m.weights.data(), k, pos, nrm, affinePos,
+                                  affineNrm);
+            for (size_t v = 0; v < n; ++v) {
+                INFO("vertex " << v);
+                const auto b = m.blendMatrix(v, k);
+                const auto p = b.transformPoint(m.positions[v]);
+                const auto nr = b.transformNormal(m.normals[v]).normalized();
+                for (size_t c = 0; c < 3; ++c) {
+                    REQUIRE(outPos.get(v)[c] == Catch::Approx(p[c]).margin(tol));
+                    REQUIRE(outNrm.get(v)[c] == Catch::Approx(nr[c]).margin(tol));
+                    REQUIRE(affinePos.get(v)[c] == Catch::Approx(p[c]).margin(tol));
+                    REQUIRE(affineNrm.get(v)[c] == Catch::Approx(nr[c]).margin(tol));
+                }
+            }
+        }
+        vtx::simd::reset();
+    }
+}
+
+TEST_CASE("Dual quaternion skinning", "[skinning]") {
+    SECTION("float, 1, 4 and 8 influences") {
+        checkDualQuaternion<float>(1, 1e-4);
+        checkDualQuaternion<float>(4, 1e-4);
+        checkDualQuaternion<float>(8, 1e-4);
+    }
+
+    SECTION("double, 3 influences") {
+        checkDualQuaternion<double>(3, 1e-12);
+    }
+
+    SECTION("Rigid bones, in place and parallel") {
+        // A single bone at full weight moves vertices rigidly
+        const mesh<double> m(20001, 2, 5);
+        std::vector<double> weights(m.weights.size());
+        for (size_t v = 0; v < weights.size(); v += 2)
+            weights[v] = 1.0;
+
+        vtx::soa_vector<double, 3> pos(m.positions.data(), m.positions.size()), par;
+        vtx::skinning::dualQuaternion(m.palette.data(), m.bones.data(), m.weights.data(), 2, pos, par,
+                                      vtx::parallel::policy::par);
+        vtx::soa_vector<double, 3> seq = pos;
+        vtx::skinning::dualQuaternion(m.palette.data(), m.bones.data(), m.weights.data(), 2, seq, seq);
+        REQUIRE(seq.toAoS() == par.toAoS());
+
+        vtx::skinning::dualQuaternion(m.palette.data(), m.bones.data(), weights.data(), 2, pos, pos);
+        for (size_t v = 0; v < 100; ++v) {
+            const auto p = m.palette[m.bones[v * 2]].transformPoint(m.positions[v]);
+            for (size_t c = 0; c < 3; ++c)
+                REQUIRE(pos.get(v)[c] == Catch::Approx(p[c]).margin(1e-12));
+        }
+    }
+}
+
+TEST_CASE("Linear blend skinning", "[skinning]") {
+    SECTION("float, 1, 4 and 8 influences") {
+        checkLinear<float>(1, 1e-4);
+        checkLinear<float>(4, 1e-4);
+        checkLinear<float>(8, 1e-4);
+    }
+
+    SECTION("double, 3 influences") {
+        checkLinear<double>(3, 1e-12);
+    }
+
+    SECTION("Mirroring bone, in place and parallel") {
+        const mesh<double> m(20001, 3, 7);
+        vtx::soa_vector<double, 3> pos(m.positions.data(), m.positions.size()), par;
+        vtx::skinning::linear(m.matrices.data(), m.bones.data(), m.weights.data(), 3, pos, par,
+                              vtx::parallel::policy::par);
+        vtx::soa_vector<double, 3> seq = pos;
+        vtx::skinning::linear(m.matrices.data(), m.bones.data(), m.weights.data(), 3, seq, seq);
+        REQUIRE(seq.toAoS() == par.toAoS());
+
+        // Normals stay on the outside of a mirrored (negative determinant) blend
+        const vtx::mat4x4<double> mirror = vtx::mat4x4<double>::scale({-1.0, 2.0, 1.0});
+        const std::uint32_t bones[] = {0};
+        const double weights[] = {1.0};
+        vtx::soa_vector<double, 3> p(1), nr(1);
+        nr.set(0, {0.0, 0.6, 0.8});
+        vtx::skinning::linear(&mirror, bones, weights, 1, p, nr, p, nr);
+        REQUIRE(nr.get(0)[0] == Catch::Approx(0.0).margin(1e-12));
+        REQUIRE(nr.get(0)[1] == Catch::Approx(0.3 / std::sqrt(0.73)));
+        REQUIRE(nr.get(0)[2] == Catch::Approx(0.8 / std::sqrt(0.73)));
+    }
+}
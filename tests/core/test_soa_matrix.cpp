@@ -0,0 +1,131 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/core/soa_matrix.h"
+
+#include <limits>
+#include <random>
+
+namespace {
+    const vtx::simd::backend soaMatrixBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    // Random matrices with N added to the diagonal; every 5th one singular (zero last row)
+    template<typename T, size_t N>
+    std::vector<vtx::matrix<T, N, N>> randomMatrices( const size_t n, const unsigned seed ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> dist(T(-1), T(1));
+        std::vector<vtx::matrix<T, N, N>> v(n);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t r = 0; r < N; ++r)
+                for (size_t c = 0; c < N; ++c)
+                    v[i](r, c) = dist(gen) + (r == c ? T(N) : T(0));
+            if (i % 5 == 3)
+                for (size_t c = 0; c < N; ++c)
+                    v[i](N - 1, c) = T(0);
+        }
+        return v;
+    }
+
+    template<typename T, size_t N>
+    void checkBatch( const double tol ) {
+        const size_t n = 45;
+        const auto aos = randomMatrices<T, N>(n, 11);
+        const vtx::soa_matrix<T, N, N> s(aos.data(), n);
+        const auto ident = vtx::matrix<T, N, N>::identity();
+
+        for (const auto be : soaMatrixBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+
+            const auto det = s.determinant();
+            std::vector<std::uint8_t> singular;
+            const auto inv = s.inverse(singular);
+
+            vtx::soa_matrix<T, N, N> out;
+            REQUIRE(s.inverse(out) == n / 5);
+
+            for (size_t i = 0; i < n; ++i) {
+                INFO("matrix " << i);
+                REQUIRE(det[i] == Catch::Approx(aos[i].determinant()).epsilon(tol).margin(tol));
+                REQUIRE(bool(singular[i]) == (i % 5 == 3));
+                REQUIRE(out.get(i) == inv.get(i));
+                if (singular[i]) {
+                    REQUIRE(inv.get(i) == ident);
+                    continue;
+                }
+                const auto p = aos[i] * inv.get(i);
+                for (size_t r = 0; r < N; ++r)
+                    for (size_t c = 0; c < N; ++c)
+                        REQUIRE(p(r, c) == Catch::Approx(ident(r, c)).margin(tol));
+            }
+        }
+        vtx::simd::reset();
+    }
+}
+
+TEST_CASE("SoA matrix container", "[soa_matrix]") {
+    const vtx::mat3x3<float> a(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 10.0f);
+    vtx::soa_mat3<float> s(3, a);
+    REQUIRE(s.size() == 3);
+    REQUIRE(s.get(2) == a);
+    REQUIRE(s.data(1, 2)[0] == 6.0f);
+    REQUIRE(reinterpret_cast<uintptr_t>(s.data(2, 2)) % vtx::CACHE_LINE == 0);
+
+    s.set(1, a.transpose());
+    s.push_back(vtx::mat3x3<float>::identity());
+    REQUIRE(s.size() == 4);
+    const auto aos = s.toAoS();
+    REQUIRE(aos[1] == a.transpose());
+    REQUIRE(aos[3] == vtx::mat3x3<float>::identity());
+}
+
+TEST_CASE("SoA matrix batch determinant and inverse", "[soa_matrix]") {
+    SECTION("3x3 float") {
+        checkBatch<float, 3>(1e-4);
+    }
+
+    SECTION("3x3 double") {
+        checkBatch<double, 3>(1e-10);
+    }
+
+    SECTION("4x4 float") {
+        checkBatch<float, 4>(1e-4);
+    }
+
+    SECTION("4x4 double") {
+        checkBatch<double, 4>(1e-10);
+    }
+
+    SECTION("Tolerance, NaN and in place") {
+        vtx::soa_mat4<double> s = {
+            vtx::mat4x4<double>::scale({1e-3, 1e-3, 1e-3}),
+            vtx::mat4x4<double>(std::numeric_limits<double>::quiet_NaN()),
+            vtx::mat4x4<double>::translate({1.0, 2.0, 3.0})
+        };
+        std::uint8_t singular[3];
+        REQUIRE(s.inverse(s, singular, 1e-6) == 2);
+        REQUIRE(singular[0] == 1);
+        REQUIRE(singular[1] == 1);
+        REQUIRE(singular[2] == 0);
+        REQUIRE(s.get(0) == vtx::mat4x4<double>::identity());
+        REQUIRE(s.get(2)(3, 0) == Catch::Approx(-1.0));
+    }
+
+    SECTION("Parallel matches sequential") {
+        const auto aos = randomMatrices<float, 4>(20001, 12);
+        const vtx::soa_mat4<float> s(aos.data(), aos.size());
+        std::vector<std::uint8_t> seqMask, parMask;
+        const auto seq = s.inverse(seqMask), par = s.inverse(parMask, 0.0f, vtx::parallel::policy::par);
+        REQUIRE(seqMask == parMask);
+        REQUIRE(seq.toAoS() == par.toAoS());
+        REQUIRE(s.determinant(vtx::parallel::policy::par) == s.determinant());
+    }
+}
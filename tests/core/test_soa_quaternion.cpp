@@ -0,0 +1,129 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/core/soa_quaternion.h"
+
+#include <cmath>
+#include <random>
+
+namespace {
+    const vtx::simd::backend soaQuatBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    // Random unit quaternions; every 4th b[i] is a tiny rotation of a[i] (nlerp lanes)
+    template<typename T>
+    void randomPairs( const size_t n, const unsigned seed,
+                      std::vector<vtx::quaternion<T>> &a, std::vector<vtx::quaternion<T>> &b ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> dist(T(-1), T(1));
+        a.resize(n);
+        b.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = vtx::quaternion<T>(dist(gen), dist(gen), dist(gen), dist(gen)).normalized();
+            b[i] = vtx::quaternion<T>(dist(gen), dist(gen), dist(gen), dist(gen)).normalized();
+            if (i % 4 == 1) {
+                const vtx::quaternion<T> d(dist(gen), dist(gen), dist(gen), T(0));
+                b[i] = (a[i] + d * T(1e-3)).normalized();
+            }
+        }
+    }
+
+    template<typename T>
+    void requireNear( const vtx::quaternion<T> &a, const vtx::quaternion<T> &b, const double tol ) {
+        for (size_t k = 0; k < 4; ++k)
+            REQUIRE(a[k] == Catch::Approx(b[k]).margin(tol));
+    }
+
+    template<typename T>
+    void checkBatch( const double tol ) {
+        const size_t n = 45;
+        std::vector<vtx::quaternion<T>> a, b;
+        randomPairs<T>(n, 7, a, b);
+        std::vector<T> t(n);
+        std::vector<vtx::vector<T, 3>> v(n);
+        for (size_t i = 0; i < n; ++i) {
+            t[i] = T(i) / T(n - 1);
+            v[i] = vtx::vector<T, 3>(T(i) * T(0.1), T(1), T(-2));
+        }
+
+        const vtx::soa_quaternion<T> sa(a.data(), n), sb(b.data(), n);
+        const vtx::soa_vector<T, 3> sv(v.data(), n);
+
+        for (const auto be : soaQuatBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+
+            const auto prod = sa.multiply(sb), nl = sa.nlerp(sb, T(0.3)), sl = sa.slerp(sb, T(0.3));
+            const auto rot = sa.rotate(sv);
+            vtx::soa_quaternion<T> slPer, nlPer;
+            sa.slerp(sb, t.data(), slPer);
+            sa.nlerp(sb, t.data(), nlPer);
+
+            for (size_t i = 0; i < n; ++i) {
+                INFO("quaternion " << i);
+                requireNear(prod.get(i), a[i] * b[i], tol);
+                requireNear(nl.get(i), a[i].nlerp(b[i], T(0.3)), tol);
+                requireNear(sl.get(i), a[i].slerp(b[i], T(0.3)), tol);
+                requireNear(slPer.get(i), a[i].slerp(b[i], t[i]), tol);
+                requireNear(nlPer.get(i), a[i].nlerp(b[i], t[i]), tol);
+                for (size_t k = 0; k < 3; ++k)
+                    REQUIRE(rot.get(i)[k] == Catch::Approx(a[i].rotateVector(v[i])[k]).margin(tol * 10));
+            }
+        }
+        vtx::simd::reset();
+    }
+}
+
+TEST_CASE("SoA quaternion container", "[soa_quaternion]") {
+    const vtx::quaternion<float> q(0.5f, -0.5f, 0.5f, 0.5f);
+    vtx::soa_quaternion<float> s(3);
+    REQUIRE(s.size() == 3);
+    REQUIRE(s.get(1) == vtx::quaternion<float>(0.0f, 0.0f, 0.0f, 1.0f));
+    REQUIRE(reinterpret_cast<uintptr_t>(s.data(3)) % vtx::CACHE_LINE == 0);
+
+    s.set(2, q);
+    s.push_back(q * 2.0f);
+    REQUIRE(s.data(1)[2] == -0.5f);
+    s.normalize();
+    const auto aos = s.toAoS();
+    REQUIRE(aos.size() == 4);
+    REQUIRE(aos[3] == q);
+}
+
+TEST_CASE("SoA quaternion batch kernels", "[soa_quaternion]") {
+    SECTION("float") {
+        checkBatch<float>(1e-5);
+    }
+
+    SECTION("double") {
+        checkBatch<double>(1e-12);
+    }
+
+    SECTION("Equal, opposite and in place") {
+        const vtx::quaternion<double> a(0.0, 0.0, std::sin(0.2), std::cos(0.2));
+        vtx::soa_quaternion<double> s = {a, a, -a, a};
+        const vtx::soa_quaternion<double> b = {a, -a, a, a.slerp(a, 0.0)};
+        s.slerp(b, 0.4, s);
+        for (size_t i = 0; i < 4; ++i) {
+            INFO("quaternion " << i);
+            REQUIRE_FALSE(std::isnan(s.get(i).W));
+            requireNear(s.get(i) * (s.get(i).W < 0 ? -1.0 : 1.0), a, 1e-15);
+        }
+    }
+
+    SECTION("Parallel matches sequential") {
+        std::vector<vtx::quaternion<float>> a, b;
+        randomPairs<float>(40001, 9, a, b);
+        const vtx::soa_quaternion<float> sa(a.data(), a.size()), sb(b.data(), b.size());
+        const auto seq = sa.slerp(sb, 0.6f), par = sa.slerp(sb, 0.6f, vtx::parallel::policy::par);
+        REQUIRE(seq.toAoS() == par.toAoS());
+        REQUIRE(sa.multiply(sb).toAoS() == sa.multiply(sb, vtx::parallel::policy::par).toAoS());
+    }
+}
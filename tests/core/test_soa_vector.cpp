@@ -0,0 +1,149 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/core/soa_vector.h"
+
+#include <random>
+
+namespace {
+    const vtx::simd::backend soaBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    // Random AoS data; odd count to exercise the loop tails of every backend
+    template<typename T, size_t N>
+    std::vector<vtx::vector<T, N>> randomVectors( const size_t n, const unsigned seed ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> dist(T(-10), T(10));
+        std::vector<vtx::vector<T, N>> v(n);
+        for (auto &e : v)
+            for (size_t k = 0; k < N; ++k)
+                e[k] = dist(gen);
+        return v;
+    }
+
+    template<typename T, size_t N>
+    void requireNear( const vtx::vector<T, N> &a, const vtx::vector<T, N> &b ) {
+        for (size_t k = 0; k < N; ++k)
+            REQUIRE(a[k] == Catch::Approx(b[k]).epsilon(1e-5).margin(1e-5));
+    }
+
+    template<typename T>
+    void checkBulk3( ) {
+        const size_t n = 37;
+        const auto a = randomVectors<T, 3>(n, 1), b = randomVectors<T, 3>(n, 2);
+        const vtx::vec3<T> dir(T(1), T(-2), T(0.5));
+
+        for (const auto be : soaBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+
+            const vtx::soa3<T> sa(a.data(), n), sb(b.data(), n);
+            const auto dots = sa.dot(sb), dotsDir = sa.dot(dir), lens = sa.squaredLength();
+            const vtx::soa3<T> norm = sa.normalized(), lerp = sa.lerp(sb, T(0.25));
+            const vtx::soa3<T> mn = sa.minV(sb), mx = sa.maxV(sb), cr = sa.cross(sb);
+
+            for (size_t i = 0; i < n; ++i) {
+                REQUIRE(dots[i] == Catch::Approx(a[i].dot(b[i])).epsilon(1e-5));
+                REQUIRE(dotsDir[i] == Catch::Approx(a[i].dot(dir)).epsilon(1e-5).margin(1e-5));
+                REQUIRE(lens[i] == Catch::Approx(a[i].squaredLength()).epsilon(1e-5));
+                requireNear(norm.get(i), a[i].normalized());
+                requireNear(lerp.get(i), a[i].lerp(b[i], T(0.25)));
+                REQUIRE(mn.get(i) == a[i].minV(b[i]));
+                REQUIRE(mx.get(i) == a[i].maxV(b[i]));
+                requireNear(cr.get(i), a[i].cross(b[i]));
+            }
+        }
+        vtx::simd::reset();
+    }
+}
+
+TEST_CASE("SoA vector container", "[soa_vector]") {
+    SECTION("Construction and element proxies") {
+        vtx::soa3<float> s(4, vtx::vec3<float>(1.0f, 2.0f, 3.0f));
+        REQUIRE(s.size() == 4);
+        REQUIRE(s[2] == vtx::vec3<float>(1.0f, 2.0f, 3.0f));
+
+        s[1] = vtx::vec3<float>(4.0f, 5.0f, 6.0f);
+        s[1][2] = 7.0f;
+        s[3] += vtx::vec3<float>(1.0f, 1.0f, 1.0f);
+        s[0] *= 2.0f;
+        REQUIRE(s.get(1) == vtx::vec3<float>(4.0f, 5.0f, 7.0f));
+        REQUIRE(s.get(3) == vtx::vec3<float>(2.0f, 3.0f, 4.0f));
+        REQUIRE(s.get(0) == vtx::vec3<float>(2.0f, 4.0f, 6.0f));
+
+        const vtx::vec3<float> v = s[1];
+        REQUIRE(v.Z == 7.0f);
+        REQUIRE(s[1].dot(vtx::vec3<float>(1.0f, 0.0f, 0.0f)) == 4.0f);
+
+        s.push_back(vtx::vec3<float>(9.0f, 9.0f, 9.0f));
+        REQUIRE(s.size() == 5);
+        REQUIRE(s.data(0)[4] == 9.0f);
+        s.pop_back();
+        REQUIRE(s.size() == 4);
+    }
+
+    SECTION("Streams are cache line aligned") {
+        vtx::soa4<double> s(13);
+        for (size_t k = 0; k < 4; ++k)
+            REQUIRE(reinterpret_cast<uintptr_t>(s.data(k)) % vtx::CACHE_LINE == 0);
+    }
+
+    SECTION("AoS round trip") {
+        const auto aos = randomVectors<float, 4>(300, 3);
+        const vtx::soa4<float> s(aos.data(), aos.size());
+        REQUIRE(s.size() == aos.size());
+        REQUIRE(s.data(2)[157] == aos[157][2]);
+        REQUIRE(s.toAoS() == aos);
+    }
+
+    SECTION("Integer components use the scalar kernels") {
+        const vtx::soa2<int> a = {vtx::vector<int, 2>(1, 2), vtx::vector<int, 2>(3, 4)};
+        const auto d = a.dot(vtx::vector<int, 2>(2, 1));
+        REQUIRE(d[0] == 4);
+        REQUIRE(d[1] == 10);
+    }
+
+    SECTION("In-place normalize") {
+        vtx::soa3<float> s = {vtx::vec3<float>(3.0f, 0.0f, 4.0f), vtx::vec3<float>(0.0f, 2.0f, 0.0f)};
+        s.normalize();
+        requireNear(s.get(0), vtx::vec3<float>(0.6f, 0.0f, 0.8f));
+        requireNear(s.get(1), vtx::vec3<float>(0.0f, 1.0f, 0.0f));
+    }
+}
+
+TEST_CASE("SoA bulk operations match vector", "[soa_vector]") {
+    SECTION("float") {
+        checkBulk3<float>();
+    }
+
+    SECTION("double") {
+        checkBulk3<double>();
+    }
+}
+
+TEST_CASE("SoA parallel operations match sequential", "[soa_vector][parallel]") {
+    const size_t n = 70001;
+    const auto a = randomVectors<float, 3>(n, 4), b = randomVectors<float, 3>(n, 5);
+    const vtx::soa3<float> sa(a.data(), n), sb(b.data(), n);
+    const auto par = vtx::parallel::policy::par;
+
+    REQUIRE(sa.dot(sb, par) == sa.dot(sb));
+    REQUIRE(sa.dot(vtx::vec3<float>(1.0f, 2.0f, 3.0f), par) == sa.dot(vtx::vec3<float>(1.0f, 2.0f, 3.0f)));
+    REQUIRE(sa.squaredLength(par) == sa.squaredLength());
+    REQUIRE(sa.normalized(par).toAoS() == sa.normalized().toAoS());
+    REQUIRE(sa.lerp(sb, 0.3f, par).toAoS() == sa.lerp(sb, 0.3f).toAoS());
+    REQUIRE(sa.minV(sb, par).toAoS() == sa.minV(sb).toAoS());
+    REQUIRE(sa.maxV(sb, par).toAoS() == sa.maxV(sb).toAoS());
+    REQUIRE(sa.cross(sb, par).toAoS() == sa.cross(sb).toAoS());
+
+    vtx::soa3<float> inPlace = sa;
+    inPlace.normalize(par);
+    REQUIRE(inPlace.toAoS() == sa.normalized().toAoS());
+}
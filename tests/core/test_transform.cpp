@@ -0,0 +1,89 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/core/transform.h"
+
+#include <thread>
+
+namespace {
+    void requireClose( const vtx::mat4x4<double> &a, const vtx::mat4x4<double> &b ) {
+        for (size_t r = 0; r < 4; ++r)
+            for (size_t c = 0; c < 4; ++c)
+                REQUIRE(a(r, c) == Catch::Approx(b(r, c)).margin(1e-12));
+    }
+}
+
+TEST_CASE("Transform cache", "[transform]") {
+    using mat = vtx::mat4x4<double>;
+    const vtx::vector<double, 3> axis = vtx::vector<double, 3>(0.3, -1.0, 0.6).normalized();
+    const mat rigidM = mat::rotate(axis, 37.0) * mat::translate({1.5, -2.0, 4.0});
+    const mat affineM = mat::scale({2.0, 0.5, -3.0}) * rigidM;
+
+    SECTION("Lazy inverse, normal matrix and determinant sign") {
+        const vtx::transform<double> t(affineM, vtx::transform_kind::affine);
+        REQUIRE(t.dirty());
+        requireClose(t.inverse(), affineM.inverse());
+        REQUIRE_FALSE(t.dirty());
+        requireClose(t.normalMatrix(), affineM.normalMatrix());
+        REQUIRE(t.determinantSign() == -1);
+        REQUIRE(&t.inverse() == &t.inverse());
+
+        const vtx::vector<double, 3> v(0.2, 0.9, -0.4);
+        for (size_t k = 0; k < 3; ++k) {
+            REQUIRE(t.transformNormal(v)[k] == Catch::Approx(affineM.transformNormal(v)[k]));
+            REQUIRE(t.inverseTransformPoint(t.transformPoint(v))[k] == Catch::Approx(v[k]));
+            REQUIRE(t.inverseTransformVector(t.transformVector(v))[k] == Catch::Approx(v[k]));
+        }
+
+        std::vector<vtx::vector<double, 3>> normals(9, v);
+        t.transformNormal(normals.data(), normals.data(), normals.size());
+        for (const auto &n : normals)
+            for (size_t k = 0; k < 3; ++k)
+                REQUIRE(n[k] == Catch::Approx(affineM.transformNormal(v)[k]));
+    }
+
+    SECTION("Changes invalidate the cache") {
+        vtx::transform<double> t;
+        REQUIRE(t.kind() == vtx::transform_kind::rigid);
+        REQUIRE(t.inverse() == mat::identity());
+        REQUIRE(t.determinantSign() == 1);
+
+        t.set(rigidM, vtx::transform_kind::rigid);
+        REQUIRE(t.dirty());
+        requireClose(t.inverse(), rigidM.inverse());
+        requireClose(t.normalMatrix(), rigidM.normalMatrix());
+
+        const vtx::transform<double> copy = t;
+        REQUIRE_FALSE(copy.dirty());
+        requireClose(copy.inverse(), rigidM.inverse());
+
+        t *= vtx::transform<double>(mat::scale({1.0, 2.0, 1.0}), vtx::transform_kind::affine);
+        REQUIRE(t.kind() == vtx::transform_kind::affine);
+        REQUIRE(t.dirty());
+        requireClose(t.inverse(), (rigidM * mat::scale({1.0, 2.0, 1.0})).inverse());
+        REQUIRE((t * vtx::transform<double>(mat::frustum(-1.0, 1.0, -1.0, 1.0, 1.0, 5.0))).kind() ==
+                vtx::transform_kind::general);
+
+        t.set(mat::scale({1.0, 0.0, 1.0}));
+        REQUIRE(t.determinantSign() == 0);
+        REQUIRE(t.inverse() == mat::identity());
+    }
+
+    SECTION("Concurrent first queries") {
+        const vtx::transform<double> t(affineM);
+        const mat expected = affineM.normalMatrix();
+        std::vector<int> ok(8, 0);
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < ok.size(); ++i)
+            threads.emplace_back([&t, &expected, &ok, i] {
+                const mat &n = t.normalMatrix();
+                ok[i] = n == expected && t.determinantSign() == -1;
+            });
+        for (auto &th : threads)
+            th.join();
+        for (const int o : ok)
+            REQUIRE(o == 1);
+    }
+}
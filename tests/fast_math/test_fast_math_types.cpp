@@ -0,0 +1,51 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+// Built as its own executable (VTXFastMathTests) with VTX_FAST_MATH, so no other test sees
+// the approximations: types other than float and double keep the std:: paths
+#ifndef VTX_FAST_MATH
+#define VTX_FAST_MATH
+#endif // VTX_FAST_MATH
+
+#include "../tests_common.h"
+#include "vectrix/core/matrix4x4.h"
+#include "vectrix/core/quaternion.h"
+
+TEST_CASE("Fast math policy with other types", "[fast]") {
+    SECTION("Normalization of integer and long double vectors") {
+        REQUIRE(vtx::vector<int, 3>(3, 4, 0).normalized() == vtx::vector<int, 3>(0, 0, 0));
+        REQUIRE(vtx::vector<int, 3>(0, 5, 0).normalized() == vtx::vector<int, 3>(0, 1, 0));
+        REQUIRE(vtx::vector<int, 2>(0, -7).normalized() == vtx::vector<int, 2>(0, -1));
+        REQUIRE(vtx::vector<int, 4>(0, 0, 0, 9).normalized() == vtx::vector<int, 4>(0, 0, 0, 1));
+        REQUIRE(vtx::vector<int, 5>(0, 0, 2, 0, 0).normalized() == vtx::vector<int, 5>(0, 0, 1, 0, 0));
+
+        vtx::vector<long double, 3> v(3.0L, 4.0L, 0.0L);
+        v.normalize();
+        REQUIRE(v[0] == 0.6L);
+        REQUIRE(v[1] == 0.8L);
+        REQUIRE(v[2] == 0.0L);
+        const vtx::vector<long double, 4> w(0.0L, 0.0L, 2.0L, 0.0L);
+        REQUIRE(w.normalized() == vtx::vector<long double, 4>(0.0L, 0.0L, 1.0L, 0.0L));
+    }
+
+    SECTION("Rotations of integer and long double matrices") {
+        const auto ri = vtx::mat4x4<int>::rotateZ(90);
+        REQUIRE(ri.transformVector(vtx::vector<int, 3>(1, 0, 0)) == vtx::vector<int, 3>(0, 1, 0));
+        REQUIRE(vtx::mat4x4<int>::rotateX(180).transformVector(vtx::vector<int, 3>(0, 1, 0)) ==
+                vtx::vector<int, 3>(0, -1, 0));
+
+        const auto rl = vtx::mat4x4<long double>::rotate(vtx::vector<long double, 3>(0.0L, 0.0L, 1.0L), 90.0L);
+        const auto v = rl.transformVector(vtx::vector<long double, 3>(1.0L, 0.0L, 0.0L));
+        REQUIRE(double(v[0]) == Catch::Approx(0.0).margin(1e-15));
+        REQUIRE(double(v[1]) == Catch::Approx(1.0));
+    }
+
+    SECTION("Slerp of long double quaternions") {
+        using quat = vtx::quaternion<long double>;
+        const quat a(0.0L, 0.0L, 0.0L, 1.0L), b(0.0L, 0.0L, 1.0L, 0.0L);
+        const quat m = a.slerp(b, 0.5L);
+        REQUIRE(double(m.Z) == Catch::Approx(std::sqrt(0.5)));
+        REQUIRE(double(m.W) == Catch::Approx(std::sqrt(0.5)));
+    }
+}
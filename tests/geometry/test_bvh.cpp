@@ -0,0 +1,185 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/geometry/bvh.h"
+
+#include <random>
+
+namespace {
+    const vtx::simd::backend bvhBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    // Random triangle soup in a [-10, 10] cube: small triangles, some of them clustered
+    template<typename T>
+    std::vector<vtx::vector<T, 3>> randomTriangles( const size_t n, const unsigned seed ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> pos(T(-10), T(10)), off(T(-1), T(1));
+        std::vector<vtx::vector<T, 3>> v;
+        for (size_t k = 0; k < n; ++k) {
+            const T s = k % 3 == 0 ? T(0.2) : T(1);
+            const vtx::vector<T, 3> c = k % 3 == 0 ? vtx::vector<T, 3>(off(gen), off(gen), off(gen)) :
+                                        vtx::vector<T, 3>(pos(gen), pos(gen), pos(gen));
+            for (size_t i = 0; i < 3; ++i)
+                v.push_back(c + vtx::vector<T, 3>(off(gen), off(gen), off(gen)) * s);
+        }
+        return v;
+    }
+
+    // Rays from a point outside the cube towards random targets inside
+    template<typename T>
+    std::vector<vtx::ray<T>> randomRays( const size_t n, const unsigned seed ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> pos(T(-10), T(10));
+        std::vector<vtx::ray<T>> rays(n);
+        const vtx::vector<T, 3> eye(T(3), T(-4), T(-30));
+        for (auto &r : rays)
+            r = vtx::ray<T>(eye, vtx::vector<T, 3>(pos(gen), pos(gen), pos(gen)) - eye);
+        return rays;
+    }
+
+    // Closest hit over all triangles
+    template<typename T>
+    vtx::ray_hit<T> bruteForce( const std::vector<vtx::vector<T, 3>> &v, const vtx::ray<T> &r ) {
+        vtx::ray_hit<T> h;
+        for (size_t k = 0; k < v.size() / 3; ++k) {
+            T t, u, w;
+            if (r.intersect(v[3 * k], v[3 * k + 1], v[3 * k + 2], t, u, w) && t < h.t) {
+                h.t = t;
+                h.u = u;
+                h.v = w;
+                h.primitive = std::uint32_t(k);
+            }
+        }
+        return h;
+    }
+
+    // Every triangle in exactly one leaf, children inside their parents
+    template<typename T>
+    void checkStructure( const vtx::bvh<T> &b ) {
+        const auto &nodes = b.nodes();
+        std::vector<int> seen(b.size(), 0);
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            const auto &n = nodes[i];
+            if (n.leaf()) {
+                REQUIRE(n.count <= vtx::bvh<T>::MAX_LEAF);
+                for (size_t k = n.offset; k < n.offset + n.count; ++k) {
+                    ++seen[b.primitives()[k]];
+                    const auto &tri = b.triangles()[k];
+                    REQUIRE(n.bounds.contains(tri.v0));
+                }
+            } else {
+                REQUIRE(n.bounds.contains(nodes[i + 1].bounds));
+                REQUIRE(n.bounds.contains(nodes[n.offset].bounds));
+            }
+        }
+        for (const int s : seen)
+            REQUIRE(s == 1);
+    }
+
+    template<typename T>
+    void checkHits( const size_t triangles, const double tol ) {
+        const auto v = randomTriangles<T>(triangles, unsigned(triangles));
+        const auto rays = randomRays<T>(333, 7);
+        const vtx::bvh<T> b(v.data(), nullptr, triangles);
+        checkStructure(b);
+
+        std::vector<vtx::ray_hit<T>> ref(rays.size());
+        size_t hits = 0;
+        for (size_t i = 0; i < rays.size(); ++i) {
+            ref[i] = bruteForce(v, rays[i]);
+            hits += ref[i].hit();
+
+            vtx::ray_hit<T> h;
+            REQUIRE(b.intersect(rays[i], h) == ref[i].hit());
+            REQUIRE(h.primitive == ref[i].primitive);
+            REQUIRE(h.t == Catch::Approx(ref[i].t).epsilon(tol));
+        }
+        if (triangles > 100)
+            REQUIRE(hits > rays.size() / 10);
+
+        const vtx::parallel::policy policies[] = {vtx::parallel::policy::seq, vtx::parallel::policy::par};
+        for (const auto be : bvhBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+            for (const auto pol : policies) {
+                std::vector<vtx::ray_hit<T>> out(rays.size());
+                b.intersect(rays.data(), out.data(), rays.size(), pol);
+                for (size_t i = 0; i < rays.size(); ++i) {
+                    INFO("ray " << i);
+                    REQUIRE(out[i].primitive == ref[i].primitive);
+                    if (!ref[i].hit())
+                        continue;
+                    REQUIRE(out[i].t == Catch::Approx(ref[i].t).epsilon(tol));
+                    REQUIRE(out[i].u == Catch::Approx(ref[i].u).margin(tol));
+                    REQUIRE(out[i].v == Catch::Approx(ref[i].v).margin(tol));
+                }
+            }
+        }
+        vtx::simd::reset();
+    }
+}
+
+TEST_CASE("Bounding volume hierarchy", "[geometry][bvh]") {
+    SECTION("Ray hits against brute force") {
+        checkHits<float>(3000, 1e-4);
+        checkHits<double>(500, 1e-10);
+        checkHits<float>(1, 1e-4);
+    }
+
+    SECTION("Indexed mesh, parallel build and limits") {
+        // Two unit quads facing -z at z = 0 and z = 1, shared vertices
+        using vec = vtx::vector<float, 3>;
+        const vec v[] = {vec(0.0f, 0.0f, 0.0f), vec(1.0f, 0.0f, 0.0f), vec(1.0f, 1.0f, 0.0f),
+                         vec(0.0f, 1.0f, 0.0f), vec(0.0f, 0.0f, 1.0f), vec(1.0f, 0.0f, 1.0f),
+                         vec(1.0f, 1.0f, 1.0f), vec(0.0f, 1.0f, 1.0f)};
+        const std::uint32_t idx[] = {0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7};
+        const vtx::bvh<float> b(v, idx, 4);
+        REQUIRE(b.bounds() == vtx::aabb<float>(vec(0.0f), vec(1.0f)));
+
+        vtx::ray_hit<float> h;
+        const vtx::ray<float> r(vec(0.75f, 0.25f, -1.0f), vec(0.0f, 0.0f, 1.0f));
+        REQUIRE(b.intersect(r, h));
+        REQUIRE(h.primitive == 0);
+        REQUIRE(h.t == Catch::Approx(1.0f));
+        REQUIRE(r.at(h.t)[0] == Catch::Approx(0.75f));
+
+        // The limit on input skips farther hits
+        vtx::ray_hit<float> limited;
+        limited.t = 0.5f;
+        REQUIRE_FALSE(b.intersect(r, limited));
+        REQUIRE(limited.t == 0.5f);
+        REQUIRE_FALSE(limited.hit());
+        REQUIRE_FALSE(b.intersect(vtx::ray<float>(vec(2.0f, 0.5f, -1.0f), vec(0.0f, 0.0f, 1.0f)), h));
+
+        const vtx::bvh<float> empty;
+        REQUIRE_FALSE(empty.intersect(r, h));
+
+        // Coincident centroids fall back to median splits
+        std::vector<vec> same;
+        for (size_t k = 0; k < 100; ++k) {
+            same.push_back(vec(0.0f, 0.0f, 0.0f));
+            same.push_back(vec(1.0f, 0.0f, float(k) * 1e-3f));
+            same.push_back(vec(0.0f, 1.0f, -float(k) * 1e-3f));
+        }
+        const vtx::bvh<float> stacked(same.data(), nullptr, 100);
+        checkStructure(stacked);
+
+        // The parallel build gives the same hierarchy
+        const auto soup = randomTriangles<float>(20000, 3);
+        const vtx::bvh<float> seq(soup.data(), nullptr, 20000), par(soup.data(), nullptr, 20000,
+                                                                     vtx::parallel::policy::par);
+        REQUIRE(seq.nodes().size() == par.nodes().size());
+        REQUIRE(seq.primitives() == par.primitives());
+        for (size_t i = 0; i < seq.nodes().size(); ++i) {
+            REQUIRE(seq.nodes()[i].bounds == par.nodes()[i].bounds);
+            REQUIRE(seq.nodes()[i].offset == par.nodes()[i].offset);
+        }
+    }
+}
@@ -0,0 +1,280 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/geometry/dynamic_aabb_tree.h"
+
+#include <algorithm>
+#include <random>
+
+namespace {
+    using pair_list = std::vector<vtx::dynamic_aabb_tree<float>::proxy_pair>;
+
+    // Random small boxes in a [-10, 10] cube
+    template<typename T>
+    std::vector<vtx::aabb<T>> randomBoxes( const size_t n, const unsigned seed ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> pos(T(-10), T(10)), size(T(0.05), T(1));
+        std::vector<vtx::aabb<T>> boxes(n);
+        for (auto &b : boxes) {
+            const vtx::vector<T, 3> c(pos(gen), pos(gen), pos(gen));
+            b = vtx::aabb<T>::fromCenter(c, vtx::vector<T, 3>(size(gen), size(gen), size(gen)));
+        }
+        return boxes;
+    }
+
+    // Parent links, heights, boxes containing the children, proxy count
+    template<typename T>
+    void checkStructure( const vtx::dynamic_aabb_tree<T> &tree ) {
+        using tree_t = vtx::dynamic_aabb_tree<T>;
+        const auto &nodes = tree.nodes();
+        if (tree.root() == tree_t::NULL_NODE) {
+            REQUIRE(tree.empty());
+            return;
+        }
+        REQUIRE(nodes[tree.root()].parent == tree_t::NULL_NODE);
+        size_t leaves = 0;
+        std::vector<std::uint32_t> stack{tree.root()};
+        while (!stack.empty()) {
+            const std::uint32_t id = stack.back();
+            stack.pop_back();
+            const auto &n = nodes[id];
+            if (n.leaf()) {
+                REQUIRE(n.height == 0);
+                ++leaves;
+                continue;
+            }
+            const auto &a = nodes[n.child[0]], &b = nodes[n.child[1]];
+            REQUIRE(a.parent == id);
+            REQUIRE(b.parent == id);
+            REQUIRE(n.height == 1 + std::max(a.height, b.height));
+            REQUIRE(n.box.contains(a.box));
+            REQUIRE(n.box.contains(b.box));
+            stack.push_back(n.child[0]);
+            stack.push_back(n.child[1]);
+        }
+        REQUIRE(leaves == tree.size());
+    }
+
+    // Overlapping fat boxes over all pairs of live proxies
+    template<typename T>
+    pair_list bruteForcePairs( const vtx::dynamic_aabb_tree<T> &tree,
+                               const std::vector<std::uint32_t> &ids ) {
+        pair_list pairs;
+        for (size_t i = 0; i < ids.size(); ++i)
+            for (size_t j = i + 1; j < ids.size(); ++j)
+                if (tree.fatBounds(ids[i]).intersects(tree.fatBounds(ids[j])))
+                    pairs.emplace_back(std::min(ids[i], ids[j]), std::max(ids[i], ids[j]));
+        std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    }
+
+    template<typename T>
+    void checkPairs( const vtx::dynamic_aabb_tree<T> &tree, const std::vector<std::uint32_t> &ids ) {
+        const pair_list ref = bruteForcePairs(tree, ids);
+        pair_list seq, par;
+        tree.pairs(seq);
+        tree.pairs(par, vtx::parallel::policy::par);
+        REQUIRE(seq == par);
+        for (const auto &p : seq) REQUIRE(p.first < p.second);
+        std::sort(seq.begin(), seq.end());
+        REQUIRE(seq == ref);
+    }
+
+    template<typename T>
+    void checkQueries( const vtx::dynamic_aabb_tree<T> &tree, const std::vector<std::uint32_t> &ids ) {
+        const auto probes = randomBoxes<T>(50, 7);
+        for (const auto &box : probes) {
+            std::vector<std::uint32_t> found, ref;
+            tree.query(box, [&]( const std::uint32_t id ) {
+                found.push_back(id);
+                return true;
+            });
+            for (const std::uint32_t id : ids)
+                if (tree.fatBounds(id).intersects(box)) ref.push_back(id);
+            std::sort(found.begin(), found.end());
+            std::sort(ref.begin(), ref.end());
+            REQUIRE(found == ref);
+        }
+
+        // Nearest fat box along rays: the callback clips the ray to the closest entry
+        std::mt19937 gen(11);
+        std::uniform_real_distribution<T> pos(T(-10), T(10));
+        const vtx::vector<T, 3> eye(T(1), T(-2), T(-30));
+        for (int k = 0; k < 50; ++k) {
+            const vtx::ray<T> r(eye, vtx::vector<T, 3>(pos(gen), pos(gen), pos(gen)) - eye);
+            T best = std::numeric_limits<T>::infinity(), ref = best;
+            tree.raycast(r, best, [&]( const std::uint32_t id, const T ) {
+                T t0, t1;
+                r.intersect(tree.fatBounds(id), t0, t1);
+                best = std::min(best, t0);
+                return best;
+            });
+            for (const std::uint32_t id : ids) {
+                T t0, t1;
+                if (r.intersect(tree.fatBounds(id), t0, t1)) ref = std::min(ref, t0);
+            }
+            REQUIRE(best == ref);
+        }
+    }
+
+    template<typename T>
+    void checkTree() {
+        const size_t n = 1500;
+        const auto boxes = randomBoxes<T>(n, 3);
+        vtx::dynamic_aabb_tree<T> tree(T(0.1));
+        std::vector<std::uint32_t> ids(n);
+        for (size_t i = 0; i < n; ++i) {
+            ids[i] = tree.insert(boxes[i], std::uint32_t(i));
+            REQUIRE(tree.fatBounds(ids[i]).contains(boxes[i]));
+        }
+        REQUIRE(tree.size() == n);
+        for (size_t i = 0; i < n; ++i) REQUIRE(tree.data(ids[i]) == i);
+        // Balanced: far below the height of a list
+        REQUIRE(tree.height() < 24);
+        checkStructure(tree);
+        checkPairs(tree, ids);
+        checkQueries(tree, ids);
+
+        // Small motion stays inside the fat box, large motion reinserts
+        std::mt19937 gen(5);
+        std::uniform_real_distribution<T> step(T(-3), T(3));
+        vtx::aabb<T> shifted = boxes[0];
+        shifted.min += vtx::vector<T, 3>(T(0.05));
+        shifted.max += vtx::vector<T, 3>(T(0.05));
+        REQUIRE_FALSE(tree.move(ids[0], shifted));
+        for (size_t i = 0; i < n; i += 2) {
+            const vtx::vector<T, 3> d(step(gen), step(gen), step(gen));
+            const vtx::aabb<T> moved(boxes[i].min + d, boxes[i].max + d);
+            REQUIRE(tree.move(ids[i], moved, d));
+            REQUIRE(tree.fatBounds(ids[i]).contains(moved));
+            // Fat box extended along the displacement
+            REQUIRE(tree.fatBounds(ids[i]).contains(vtx::aabb<T>(moved.min + d, moved.max + d)));
+        }
+        checkStructure(tree);
+        checkPairs(tree, ids);
+
+        // Remove half, the rest still found
+        std::vector<std::uint32_t> kept;
+        for (size_t i = 0; i < n; ++i)
+            if (i % 3 == 0)
+                tree.remove(ids[i]);
+            else
+                kept.push_back(ids[i]);
+        REQUIRE(tree.size() == kept.size());
+        checkStructure(tree);
+        checkPairs(tree, kept);
+        checkQueries(tree, kept);
+
+        for (const std::uint32_t id : kept) tree.remove(id);
+        REQUIRE(tree.empty());
+        REQUIRE(tree.root() == vtx::dynamic_aabb_tree<T>::NULL_NODE);
+        checkStructure(tree);
+    }
+
+    template<typename T>
+    void checkRefit( const size_t n ) {
+        const auto boxes = randomBoxes<T>(n, 9);
+        vtx::dynamic_aabb_tree<T> seq(T(0.2)), par(T(0.2));
+        std::vector<std::uint32_t> ids(n);
+        for (size_t i = 0; i < n; ++i) {
+            ids[i] = seq.insert(boxes[i]);
+            REQUIRE(par.insert(boxes[i]) == ids[i]);
+        }
+
+        // Unchanged boxes refit nothing
+        REQUIRE(seq.refit(ids.data(), boxes.data(), n) == 0);
+
+        std::mt19937 gen(13);
+        std::uniform_real_distribution<T> step(T(-0.5), T(0.5));
+        std::vector<vtx::aabb<T>> moved(n);
+        size_t escaped = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const vtx::vector<T, 3> d(step(gen), step(gen), step(gen));
+            moved[i] = vtx::aabb<T>(boxes[i].min + d, boxes[i].max + d);
+            escaped += seq.fatBounds(ids[i]).contains(moved[i]) ? 0 : 1;
+        }
+        REQUIRE(seq.refit(ids.data(), moved.data(), n) == escaped);
+        REQUIRE(par.refit(ids.data(), moved.data(), n, vtx::parallel::policy::par) == escaped);
+        for (size_t i = 0; i < n; ++i) {
+            REQUIRE(seq.fatBounds(ids[i]).contains(moved[i]));
+            REQUIRE(seq.fatBounds(ids[i]) == par.fatBounds(ids[i]));
+        }
+        for (size_t i = 0; i < seq.nodes().size(); ++i) REQUIRE(seq.nodes()[i].box == par.nodes()[i].box);
+        checkStructure(par);
+        checkPairs(par, ids);
+
+        // Structural changes after a refit are picked up by the next one
+        for (size_t i = 0; i < n; i += 4) par.remove(ids[i]);
+        std::vector<std::uint32_t> kept;
+        std::vector<vtx::aabb<T>> keptBoxes;
+        for (size_t i = 0; i < n; ++i)
+            if (i % 4 != 0) {
+                kept.push_back(ids[i]);
+                keptBoxes.push_back(boxes[i]);
+            }
+        par.refit(kept.data(), keptBoxes.data(), kept.size(), vtx::parallel::policy::par);
+        checkStructure(par);
+        checkPairs(par, kept);
+    }
+}
+
+TEST_CASE("Dynamic AABB tree", "[geometry][dynamic_aabb_tree]") {
+    SECTION("insert, move, remove, queries") {
+        checkTree<float>();
+        checkTree<double>();
+    }
+
+    SECTION("Batch refit") {
+        checkRefit<float>(300);
+        checkRefit<float>(20000);
+        checkRefit<double>(9000);
+    }
+
+    SECTION("Sorted inserts stay balanced") {
+        // Boxes along a line in order: a list without rotations
+        vtx::dynamic_aabb_tree<float> tree(0.f);
+        for (int i = 0; i < 4096; ++i)
+            tree.insert(vtx::aabb<float>(vtx::vector<float, 3>(float(i), 0.f, 0.f),
+                                         vtx::vector<float, 3>(float(i) + 0.5f, 1.f, 1.f)));
+        checkStructure(tree);
+        REQUIRE(tree.height() <= 24);
+    }
+
+    SECTION("Pooled nodes") {
+        const auto boxes = randomBoxes<float>(1000, 17);
+        vtx::dynamic_aabb_tree<float> tree;
+        tree.reserve(boxes.size());
+        const auto *storage = tree.nodes().data();
+        std::vector<std::uint32_t> ids;
+        for (const auto &b : boxes) ids.push_back(tree.insert(b));
+        for (int round = 0; round < 5; ++round) {
+            for (size_t i = 0; i < ids.size(); i += 2) tree.remove(ids[i]);
+            for (size_t i = 0; i < ids.size(); i += 2)
+                ids[i] = tree.insert(boxes[(i + round) % boxes.size()]);
+            checkStructure(tree);
+        }
+        // No reallocation: removed nodes are reused
+        REQUIRE(tree.nodes().data() == storage);
+        REQUIRE(tree.nodes().size() == 2 * boxes.size() - 1);
+
+        tree.clear();
+        REQUIRE(tree.empty());
+        REQUIRE(tree.insert(boxes[0]) == 0);
+    }
+
+    SECTION("Early exit") {
+        const auto boxes = randomBoxes<float>(200, 19);
+        vtx::dynamic_aabb_tree<float> tree;
+        for (const auto &b : boxes) tree.insert(b);
+        size_t calls = 0;
+        tree.query(vtx::aabb<float>(vtx::vector<float, 3>(-20.f), vtx::vector<float, 3>(20.f)),
+                   [&]( std::uint32_t ) { return ++calls < 3; });
+        REQUIRE(calls == 3);
+        calls = 0;
+        const vtx::ray<float> r(vtx::vector<float, 3>(0.f, 0.f, -30.f), vtx::vector<float, 3>(0.f, 0.f, 1.f));
+        tree.raycast(r, 100.f, [&]( std::uint32_t, float ) { return ++calls, 0.f; });
+        REQUIRE(calls <= 1);
+    }
+}
@@ -0,0 +1,112 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/geometry/frustum.h"
+
+#include <random>
+
+namespace {
+    const vtx::simd::backend cullBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    // Batch culling of random boxes and spheres against the scalar tests, every layout and policy
+    template<typename T>
+    void checkCulling( const size_t n ) {
+        using vec = vtx::vector<T, 3>;
+        const vtx::frustum<T> f(vtx::mat4x4<T>::view(vec(1, 2, 10), vec(0), vec(0, 1, 0)) *
+                                vtx::mat4x4<T>::frustum(T(-1), T(1), T(0.75), T(-0.75), T(1), T(30)));
+
+        std::mt19937 gen(static_cast<unsigned>(n));
+        std::uniform_real_distribution<T> pos(T(-25), T(25)), size(T(0), T(3));
+        std::vector<vtx::aabb<T>> boxes(n);
+        std::vector<vtx::sphere<T>> spheres(n);
+        std::vector<T> radii(n);
+        std::vector<std::uint32_t> boxRef, sphereRef;
+        for (size_t i = 0; i < n; ++i) {
+            const vec c(pos(gen), pos(gen), pos(gen));
+            boxes[i] = vtx::aabb<T>::fromCenter(c, vec(size(gen), size(gen), size(gen)));
+            spheres[i] = vtx::sphere<T>(c, radii[i] = size(gen));
+            if (f.intersects(boxes[i]))
+                boxRef.push_back(std::uint32_t(i));
+            if (f.intersects(spheres[i]))
+                sphereRef.push_back(std::uint32_t(i));
+        }
+        if (n > 100) {
+            REQUIRE(!boxRef.empty());
+            REQUIRE(boxRef.size() < n / 2);
+        }
+
+        vtx::soa_vector<T, 3> mins(n), maxs(n), centers(n);
+        for (size_t i = 0; i < n; ++i) {
+            mins.set(i, boxes[i].min);
+            maxs.set(i, boxes[i].max);
+            centers.set(i, spheres[i].center);
+        }
+
+        const vtx::parallel::policy policies[] = {vtx::parallel::policy::seq, vtx::parallel::policy::par};
+        for (const auto be : cullBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+            for (const auto pol : policies) {
+                std::vector<std::uint32_t> visible(n);
+                const auto result = [&]( const size_t count ) {
+                    return std::vector<std::uint32_t>(visible.begin(), visible.begin() + count);
+                };
+                REQUIRE(result(f.cull(mins, maxs, visible.data(), pol)) == boxRef);
+                REQUIRE(result(f.cull(boxes.data(), n, visible.data(), pol)) == boxRef);
+                REQUIRE(result(f.cull(centers, radii.data(), visible.data(), pol)) == sphereRef);
+                REQUIRE(result(f.cull(spheres.data(), n, visible.data(), pol)) == sphereRef);
+            }
+        }
+        vtx::simd::reset();
+    }
+}
+
+TEST_CASE("View frustum", "[geometry][frustum]") {
+    using vec = vtx::vector<double, 3>;
+    using mat = vtx::mat4x4<double>;
+
+    SECTION("Planes of a perspective projection") {
+        const vtx::frustum<double> f(mat::frustum(-1.0, 1.0, 1.0, -1.0, 1.0, 100.0));
+        for (const auto &p : f.planes)
+            REQUIRE(p.normal.length() == Catch::Approx(1.0));
+        REQUIRE(f.planes[4].distance(vec(0.0, 0.0, -1.0)) == Catch::Approx(0.0).margin(1e-12));
+        REQUIRE(f.planes[5].distance(vec(0.0, 0.0, -100.0)) == Catch::Approx(0.0).margin(1e-9));
+
+        REQUIRE(f.contains(vec(0.0, 0.0, -5.0)));
+        REQUIRE(f.contains(vec(4.9, -4.9, -5.0)));
+        REQUIRE_FALSE(f.contains(vec(0.0, 0.0, -0.5)));
+        REQUIRE_FALSE(f.contains(vec(0.0, 0.0, -101.0)));
+        REQUIRE_FALSE(f.contains(vec(5.1, 0.0, -5.0)));
+        REQUIRE_FALSE(f.contains(vec(0.0, 0.0, 5.0)));
+
+        REQUIRE(f.intersects(vtx::sphere<double>(vec(0.0, 0.0, 1.0), 2.5)));
+        REQUIRE_FALSE(f.intersects(vtx::sphere<double>(vec(0.0, 0.0, 1.0), 1.5)));
+        REQUIRE(f.intersects(vtx::aabb<double>(vec(5.5, -1.0, -6.0), vec(7.0, 1.0, -5.0))));
+        REQUIRE_FALSE(f.intersects(vtx::aabb<double>(vec(6.5, -1.0, -6.0), vec(7.0, 1.0, -5.0))));
+    }
+
+    SECTION("Orthographic projection after a view transform") {
+        const mat view = mat::view(vec(0.0, 0.0, 5.0), vec(0.0), vec(0.0, 1.0, 0.0));
+        const vtx::frustum<double> f(view * mat::ortho(-2.0, 2.0, -1.0, 1.0, 1.0, 10.0));
+        REQUIRE(f.contains(vec(1.9, 0.9, 0.0)));
+        REQUIRE(f.contains(vec(0.0, 0.0, -4.9)));
+        REQUIRE_FALSE(f.contains(vec(2.1, 0.0, 0.0)));
+        REQUIRE_FALSE(f.contains(vec(0.0, 0.0, 4.5)));
+        REQUIRE_FALSE(f.contains(vec(0.0, 0.0, -5.5)));
+        REQUIRE(f.intersects(vtx::aabb<double>(vec(-3.0, -3.0, -1.0), vec(-1.5, -0.5, 1.0))));
+    }
+
+    SECTION("Batch culling") {
+        checkCulling<float>(50001);
+        checkCulling<double>(1000);
+        checkCulling<float>(7);
+    }
+}
@@ -0,0 +1,178 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/geometry/kd_tree.h"
+
+#include <algorithm>
+#include <random>
+
+namespace {
+    const vtx::simd::backend kdBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    // Random cloud in a [-10, 10] cube with a dense cluster and duplicated points
+    template<typename T>
+    std::vector<vtx::vector<T, 3>> randomCloud( const size_t n, const unsigned seed ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> pos(T(-10), T(10)), off(T(-0.1), T(0.1));
+        std::vector<vtx::vector<T, 3>> points(n);
+        for (size_t i = 0; i < n; ++i) {
+            if (i % 5 == 1)
+                points[i] = vtx::vector<T, 3>(off(gen), off(gen), off(gen));
+            else if (i % 13 == 7)
+                points[i] = points[i - 1];
+            else
+                points[i] = vtx::vector<T, 3>(pos(gen), pos(gen), pos(gen));
+        }
+        return points;
+    }
+
+    // Sorted squared distances of all points to q
+    template<typename T>
+    std::vector<T> distances( const std::vector<vtx::vector<T, 3>> &points, const vtx::vector<T, 3> &q ) {
+        std::vector<T> d(points.size());
+        for (size_t i = 0; i < points.size(); ++i)
+            d[i] = (points[i] - q).squaredLength();
+        std::sort(d.begin(), d.end());
+        return d;
+    }
+
+    // Rows of a kNN result against the sorted distances 'ref': the k smallest distances, each of
+    // them the distance of its point (up to the rounding of fused multiply-adds in the SIMD backends)
+    template<typename T>
+    void checkRow( const std::vector<vtx::vector<T, 3>> &points, const vtx::vector<T, 3> &q,
+                   const std::vector<T> &ref, const size_t k, const std::uint32_t *ids, const T *dist2 ) {
+        for (size_t j = 0; j < k; ++j) {
+            if (j >= points.size()) {
+                REQUIRE(ids[j] == vtx::kd_tree<T>::NO_POINT);
+                REQUIRE(dist2[j] == std::numeric_limits<T>::infinity());
+                continue;
+            }
+            REQUIRE(dist2[j] == Catch::Approx(ref[j]).epsilon(1e-5));
+            REQUIRE(ids[j] < points.size());
+            REQUIRE((points[ids[j]] - q).squaredLength() == Catch::Approx(dist2[j]).epsilon(1e-5));
+            if (j > 0) REQUIRE(ids[j] != ids[j - 1]);
+        }
+    }
+
+    template<typename T>
+    std::vector<std::uint32_t> bruteRadius( const std::vector<vtx::vector<T, 3>> &points,
+                                            const vtx::vector<T, 3> &q, const T r ) {
+        std::vector<std::uint32_t> ids;
+        for (size_t i = 0; i < points.size(); ++i)
+            if ((points[i] - q).squaredLength() <= r * r) ids.push_back(std::uint32_t(i));
+        return ids;
+    }
+
+    template<typename T>
+    void checkQueries( const size_t n ) {
+        const auto points = randomCloud<T>(n, static_cast<unsigned>(n));
+        const auto queries = randomCloud<T>(300, 77);
+        const vtx::kd_tree<T> tree(points.data(), n), par(points.data(), n, vtx::parallel::policy::par);
+        REQUIRE(tree.size() == n);
+        REQUIRE(tree.order() == par.order());
+        std::vector<std::uint32_t> seen(tree.order());
+        std::sort(seen.begin(), seen.end());
+        for (size_t i = 0; i < n; ++i) REQUIRE(seen[i] == i);
+
+        vtx::soa_vector<T, 3> soa(n);
+        for (size_t i = 0; i < n; ++i) soa.set(i, points[i]);
+        REQUIRE(vtx::kd_tree<T>(soa).order() == tree.order());
+
+        std::vector<std::vector<T>> refs(queries.size());
+        for (size_t i = 0; i < queries.size(); ++i) refs[i] = distances(points, queries[i]);
+
+        const vtx::parallel::policy policies[] = {vtx::parallel::policy::seq, vtx::parallel::policy::par};
+        const size_t ks[] = {1, 5, 40};
+        for (const auto be : kdBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+            for (const size_t k : ks)
+                for (const auto pol : policies) {
+                    std::vector<std::uint32_t> ids(queries.size() * k);
+                    std::vector<T> dist2(queries.size() * k);
+                    tree.nearest(queries.data(), queries.size(), k, ids.data(), dist2.data(), pol);
+                    for (size_t i = 0; i < queries.size(); ++i)
+                        checkRow(points, queries[i], refs[i], k, ids.data() + i * k, dist2.data() + i * k);
+                }
+
+            for (const auto pol : policies) {
+                std::vector<std::uint32_t> ids;
+                std::vector<size_t> offsets;
+                tree.radius(queries.data(), queries.size(), T(1.5), ids, offsets, pol);
+                REQUIRE(offsets.size() == queries.size() + 1);
+                REQUIRE(offsets.back() == ids.size());
+                for (size_t i = 0; i < queries.size(); ++i) {
+                    std::vector<std::uint32_t> found(ids.begin() + offsets[i], ids.begin() + offsets[i + 1]);
+                    std::sort(found.begin(), found.end());
+                    REQUIRE(found == bruteRadius(points, queries[i], T(1.5)));
+                }
+            }
+
+            // Single queries
+            for (size_t i = 0; i < 20; ++i) {
+                T d;
+                const std::uint32_t id = tree.nearest(queries[i], &d);
+                REQUIRE(d == Catch::Approx(refs[i][0]).epsilon(1e-5));
+                REQUIRE((points[id] - queries[i]).squaredLength() == Catch::Approx(d).epsilon(1e-5));
+                std::vector<std::uint32_t> found{12345u};
+                const size_t count = tree.radius(queries[i], T(3), found);
+                REQUIRE(count == found.size() - 1);
+                std::sort(found.begin() + 1, found.end());
+                REQUIRE(std::vector<std::uint32_t>(found.begin() + 1, found.end()) ==
+                        bruteRadius(points, queries[i], T(3)));
+            }
+        }
+        vtx::simd::reset();
+    }
+}
+
+TEST_CASE("k-d tree", "[geometry][kd_tree]") {
+    SECTION("Queries against brute force") {
+        checkQueries<float>(7);
+        checkQueries<float>(33);
+        checkQueries<float>(5000);
+        checkQueries<float>(40000);
+        checkQueries<double>(3000);
+    }
+
+    SECTION("Depth and leaf size") {
+        const auto points = randomCloud<float>(1000, 3);
+        const vtx::kd_tree<float> tree(points.data(), points.size());
+        // ceil(1000 / 2^5) = 32 points per leaf
+        REQUIRE(tree.depth() == 5);
+        REQUIRE(vtx::kd_tree<float>(points.data(), 32).depth() == 0);
+        REQUIRE(vtx::kd_tree<float>(points.data(), 33).depth() == 1);
+    }
+
+    SECTION("Empty tree") {
+        const vtx::kd_tree<float> tree;
+        float d;
+        REQUIRE(tree.nearest(vtx::vector<float, 3>(0.f), &d) == vtx::kd_tree<float>::NO_POINT);
+        REQUIRE(d == std::numeric_limits<float>::infinity());
+        std::vector<std::uint32_t> found;
+        REQUIRE(tree.radius(vtx::vector<float, 3>(0.f), 1.f, found) == 0);
+        std::uint32_t ids[3];
+        float dist2[3];
+        REQUIRE(tree.nearest(vtx::vector<float, 3>(0.f), 3, ids, dist2) == 0);
+        REQUIRE(ids[2] == vtx::kd_tree<float>::NO_POINT);
+    }
+
+    SECTION("All points equal") {
+        const std::vector<vtx::vector<float, 3>> points(500, vtx::vector<float, 3>(1.f, 2.f, 3.f));
+        const vtx::kd_tree<float> tree(points.data(), points.size(), vtx::parallel::policy::par);
+        std::vector<std::uint32_t> found;
+        REQUIRE(tree.radius(vtx::vector<float, 3>(1.f, 2.f, 3.f), 0.f, found) == 500);
+        std::uint32_t ids[4];
+        float dist2[4];
+        REQUIRE(tree.nearest(vtx::vector<float, 3>(0.f), 4, ids, dist2) == 4);
+        REQUIRE(dist2[3] == 14.f);
+    }
+}
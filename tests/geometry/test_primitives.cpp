@@ -0,0 +1,124 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/geometry/aabb.h"
+#include "vectrix/geometry/plane.h"
+#include "vectrix/geometry/ray.h"
+#include "vectrix/geometry/sphere.h"
+
+TEST_CASE("Axis-aligned bounding box", "[geometry]") {
+    using vec = vtx::vector<double, 3>;
+    using box = vtx::aabb<double>;
+    const box b(vec(-1.0, 0.0, 2.0), vec(3.0, 2.0, 4.0));
+
+    SECTION("Empty box and growth") {
+        box e;
+        REQUIRE(e.empty());
+        REQUIRE(e.volume() == 0.0);
+        REQUIRE_FALSE(e.contains(vec(0.0)));
+        REQUIRE_FALSE(b.contains(e));
+        e.expand(vec(1.0, 1.0, 3.0));
+        REQUIRE_FALSE(e.empty());
+        e.expand(b);
+        REQUIRE(e == b);
+
+        const vec points[] = {vec(1.0, -2.0, 0.5), vec(-3.0, 4.0, 1.0), vec(0.0, 0.0, 2.0)};
+        REQUIRE(box(points, 3) == box(vec(-3.0, -2.0, 0.5), vec(1.0, 4.0, 2.0)));
+    }
+
+    SECTION("Measures and tests") {
+        REQUIRE(b.center() == vec(1.0, 1.0, 3.0));
+        REQUIRE(b.extent() == vec(2.0, 1.0, 1.0));
+        REQUIRE(box::fromCenter(b.center(), b.extent()) == b);
+        REQUIRE(b.surfaceArea() == Catch::Approx(2 * (8.0 + 4.0 + 8.0)));
+        REQUIRE(b.volume() == Catch::Approx(16.0));
+
+        REQUIRE(b.contains(vec(3.0, 2.0, 4.0)));
+        REQUIRE_FALSE(b.contains(vec(3.5, 1.0, 3.0)));
+        REQUIRE(b.contains(box(vec(0.0, 0.5, 2.5), vec(1.0, 1.0, 3.0))));
+        REQUIRE(b.intersects(box(vec(3.0, 2.0, 4.0), vec(5.0))));
+        REQUIRE_FALSE(b.intersects(box(vec(3.1, 0.0, 2.0), vec(5.0))));
+        REQUIRE(b.intersection(box(vec(2.0, 1.0, 0.0), vec(5.0))) ==
+                box(vec(2.0, 1.0, 2.0), vec(3.0, 2.0, 4.0)));
+        REQUIRE(b.intersection(box(vec(4.0), vec(5.0))).empty());
+        REQUIRE(b.squaredDistance(vec(5.0, 1.0, 5.0)) == Catch::Approx(5.0));
+        REQUIRE(b.merged(box(vec(5.0), vec(6.0))) == box(vec(-1.0, 0.0, 2.0), vec(6.0)));
+    }
+
+    SECTION("Transformed box bounds the transformed corners") {
+        const auto m = vtx::mat4x4<double>::rotate(vec(1.0, 2.0, -0.5).normalized(), 40.0) *
+                       vtx::mat4x4<double>::translate({1.0, -2.0, 0.5});
+        const box t = b.transformed(m);
+        box corners;
+        for (size_t k = 0; k < 8; ++k)
+            corners.expand(m.transformPoint(vec(k & 1 ? b.max[0] : b.min[0], k & 2 ? b.max[1] : b.min[1],
+                                                k & 4 ? b.max[2] : b.min[2])));
+        for (size_t c = 0; c < 3; ++c) {
+            REQUIRE(t.min[c] == Catch::Approx(corners.min[c]));
+            REQUIRE(t.max[c] == Catch::Approx(corners.max[c]));
+        }
+    }
+}
+
+TEST_CASE("Sphere, plane and ray", "[geometry]") {
+    using vec = vtx::vector<double, 3>;
+    const vtx::sphere<double> s(vec(1.0, 2.0, 3.0), 2.0);
+    const vtx::aabb<double> b(vec(-1.0), vec(1.0));
+
+    SECTION("Sphere") {
+        REQUIRE(s.contains(vec(1.0, 2.0, 5.0)));
+        REQUIRE_FALSE(s.contains(vec(1.0, 2.0, 5.1)));
+        REQUIRE(s.intersects(vtx::sphere<double>(vec(1.0, 5.0, 3.0), 1.0)));
+        REQUIRE_FALSE(s.intersects(vtx::sphere<double>(vec(1.0, 5.1, 3.0), 1.0)));
+        REQUIRE(s.intersects(vtx::aabb<double>(vec(0.0), vec(1.0, 1.0, 1.5))));
+        REQUIRE_FALSE(s.intersects(b));
+        REQUIRE_FALSE(vtx::sphere<double>(vec(2.0), 1.7).intersects(b));
+        REQUIRE(s.bounds() == vtx::aabb<double>(vec(-1.0, 0.0, 1.0), vec(3.0, 4.0, 5.0)));
+        const vtx::sphere<double> around(b);
+        REQUIRE(around.radius == Catch::Approx(std::sqrt(3.0)));
+    }
+
+    SECTION("Plane") {
+        const vtx::plane<double> p(vec(0.0, 0.0, 1.0), vec(5.0, 5.0, 2.0));
+        REQUIRE(p.distance(vec(1.0, 1.0, 5.0)) == Catch::Approx(3.0));
+        REQUIRE(p.project(vec(1.0, 1.0, 5.0)) == vec(1.0, 1.0, 2.0));
+        REQUIRE(p.flipped().distance(vec(0.0)) == Catch::Approx(2.0));
+
+        const vtx::plane<double> q(vec(0.0, 0.0, 2.0), vec(1.0, 0.0, 2.0), vec(0.0, 1.0, 2.0));
+        REQUIRE(q.normal == p.normal);
+        REQUIRE(q.d == Catch::Approx(p.d));
+
+        const vtx::plane<double> n = vtx::plane<double>(vec(0.0, 3.0, 4.0), 10.0).normalized();
+        REQUIRE(n.normal.length() == Catch::Approx(1.0));
+        REQUIRE(n.d == Catch::Approx(2.0));
+    }
+
+    SECTION("Ray hits") {
+        double t0, t1;
+        const vtx::ray<double> r(vec(-3.0, 0.5, 0.0), vec(2.0, 0.0, 0.0));
+        REQUIRE(r.intersect(b, t0, t1));
+        REQUIRE(t0 == Catch::Approx(1.0));
+        REQUIRE(t1 == Catch::Approx(2.0));
+        REQUIRE(r.at(t0) == vec(-1.0, 0.5, 0.0));
+        REQUIRE_FALSE(vtx::ray<double>(vec(-3.0, 1.5, 0.0), vec(1.0, 0.0, 0.0)).intersects(b));
+        REQUIRE_FALSE(vtx::ray<double>(vec(3.0, 0.0, 0.0), vec(1.0, 0.0, 0.0)).intersects(b));
+        REQUIRE(vtx::ray<double>(vec(0.0), vec(0.0, 0.0, 1.0)).intersect(b, t0, t1));
+        REQUIRE(t0 == 0.0);
+        REQUIRE(t1 == Catch::Approx(1.0));
+
+        double t;
+        REQUIRE(vtx::ray<double>(vec(1.0, 2.0, -3.0), vec(0.0, 0.0, 1.0)).intersect(s, t));
+        REQUIRE(t == Catch::Approx(4.0));
+        REQUIRE(vtx::ray<double>(s.center, vec(0.0, 1.0, 0.0)).intersect(s, t));
+        REQUIRE(t == Catch::Approx(2.0));
+        REQUIRE_FALSE(vtx::ray<double>(vec(1.0, 2.0, 6.0), vec(0.0, 0.0, 1.0)).intersect(s, t));
+
+        const vtx::plane<double> p(vec(0.0, 1.0, 0.0), 0.0);
+        REQUIRE(vtx::ray<double>(vec(0.0, 4.0, 0.0), vec(0.0, -2.0, 0.0)).intersect(p, t));
+        REQUIRE(t == Catch::Approx(2.0));
+        REQUIRE_FALSE(vtx::ray<double>(vec(0.0, 4.0, 0.0), vec(1.0, 0.0, 0.0)).intersect(p, t));
+        REQUIRE_FALSE(vtx::ray<double>(vec(0.0, 4.0, 0.0), vec(0.0, 1.0, 0.0)).intersect(p, t));
+    }
+}
@@ -0,0 +1,202 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/geometry/spatial_hash.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace {
+    using proxy_pair = vtx::spatial_hash<float>::proxy_pair;
+
+    const vtx::simd::backend hashBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    // Random particles in a cube of the given size around the origin, a fifth of them in a dense
+    // cluster and some duplicated
+    template<typename T>
+    std::vector<vtx::vector<T, 3>> randomParticles( const size_t n, const T extent, const unsigned seed ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> pos(-extent / 2, extent / 2), off(T(-0.3), T(0.3));
+        std::vector<vtx::vector<T, 3>> points(n);
+        for (size_t i = 0; i < n; ++i) {
+            if (i % 5 == 1)
+                points[i] = vtx::vector<T, 3>(off(gen) + T(1), off(gen), off(gen));
+            else if (i % 17 == 9)
+                points[i] = points[i - 1];
+            else
+                points[i] = vtx::vector<T, 3>(pos(gen), pos(gen), pos(gen));
+        }
+        return points;
+    }
+
+    // The same squared distance as the SIMD backends up to fused multiply-adds: pairs within r,
+    // leaving out those within the rounding of the boundary
+    template<typename T>
+    bool within( const vtx::vector<T, 3> &a, const vtx::vector<T, 3> &b, const T r ) {
+        return (a - b).squaredLength() <= r * r;
+    }
+
+    template<typename T>
+    bool nearBoundary( const vtx::vector<T, 3> &a, const vtx::vector<T, 3> &b, const T r ) {
+        return std::abs((a - b).squaredLength() - r * r) <= T(1e-5) * r * r;
+    }
+
+    template<typename T>
+    std::vector<proxy_pair> brutePairs( const std::vector<vtx::vector<T, 3>> &points, const T r ) {
+        std::vector<proxy_pair> pairs;
+        for (size_t i = 0; i < points.size(); ++i)
+            for (size_t j = i + 1; j < points.size(); ++j)
+                if (within(points[i], points[j], r) && !nearBoundary(points[i], points[j], r))
+                    pairs.emplace_back(std::uint32_t(i), std::uint32_t(j));
+        return pairs;
+    }
+
+    // Sorted pairs against brute force, pairs on the boundary left out
+    template<typename T>
+    void checkPairs( const std::vector<vtx::vector<T, 3>> &points, const T r, std::vector<proxy_pair> found,
+                     const std::vector<proxy_pair> &ref ) {
+        REQUIRE(std::all_of(found.begin(), found.end(), []( const proxy_pair &p ) {
+            return p.first < p.second;
+        }));
+        found.erase(std::remove_if(found.begin(), found.end(), [&]( const proxy_pair &p ) {
+            return nearBoundary(points[p.first], points[p.second], r);
+        }), found.end());
+        std::sort(found.begin(), found.end());
+        REQUIRE(std::adjacent_find(found.begin(), found.end()) == found.end());
+        REQUIRE(found == ref);
+    }
+
+    template<typename T>
+    void checkGrid( const size_t n, const T extent, const T cell ) {
+        const auto points = randomParticles<T>(n, extent, static_cast<unsigned>(n));
+        vtx::spatial_hash<T> grid(cell), par(cell), soaGrid(cell);
+        grid.build(points.data(), n);
+        par.build(points.data(), n, vtx::parallel::policy::par);
+        vtx::soa_vector<T, 3> soa(n);
+        for (size_t i = 0; i < n; ++i) soa.set(i, points[i]);
+        soaGrid.build(soa, vtx::parallel::policy::par);
+        REQUIRE(grid.size() == n);
+        REQUIRE(par.order() == grid.order());
+        REQUIRE(par.cellStarts() == grid.cellStarts());
+        REQUIRE(soaGrid.order() == grid.order());
+
+        // Cells hold their particles, in ascending index
+        const auto &starts = grid.cellStarts();
+        REQUIRE(starts.size() == (size_t(1) << 3 * grid.bits()) + 1);
+        REQUIRE(starts.front() == 0);
+        REQUIRE(starts.back() == n);
+        for (size_t k = 0; k + 1 < starts.size(); ++k) {
+            REQUIRE(starts[k] <= starts[k + 1]);
+            for (size_t i = starts[k]; i < starts[k + 1]; ++i) {
+                REQUIRE(grid.key(points[grid.order()[i]]) == k);
+                if (i > starts[k]) REQUIRE(grid.order()[i - 1] < grid.order()[i]);
+            }
+        }
+
+        const T radii[] = {cell, cell / 2};
+        const vtx::parallel::policy policies[] = {vtx::parallel::policy::seq, vtx::parallel::policy::par};
+        const auto queries = randomParticles<T>(200, extent, 99);
+        for (const T r : radii) {
+            const auto ref = brutePairs(points, r);
+            for (const auto be : hashBackends) {
+                if (!vtx::simd::force(be))
+                    continue;
+                INFO("backend " << vtx::simd::name(be) << ", radius " << r);
+                std::vector<proxy_pair> seqPairs(ref.size() + 64), parPairs(ref.size() + 64);
+                const size_t count = grid.pairs(r, seqPairs.data(), seqPairs.size());
+                REQUIRE(count <= seqPairs.size());
+                seqPairs.resize(count);
+                checkPairs(points, r, seqPairs, ref);
+                REQUIRE(grid.pairs(r, parPairs.data(), parPairs.size(), vtx::parallel::policy::par) == count);
+                parPairs.resize(count);
+                REQUIRE(parPairs == seqPairs);
+
+                // A short buffer gets the first pairs and the full count
+                std::vector<proxy_pair> head(count / 3);
+                for (const auto pol : policies) {
+                    REQUIRE(grid.pairs(r, head.data(), head.size(), pol) == count);
+                    REQUIRE(std::equal(head.begin(), head.end(), seqPairs.begin()));
+                }
+
+                for (const auto pol : policies) {
+                    std::vector<std::uint32_t> found;
+                    std::vector<size_t> offsets;
+                    grid.radius(queries.data(), queries.size(), r, found, offsets, pol);
+                    REQUIRE(offsets.size() == queries.size() + 1);
+                    REQUIRE(offsets.back() == found.size());
+                    for (size_t i = 0; i < queries.size(); ++i) {
+                        std::vector<std::uint32_t> ids, ref;
+                        for (size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                            if (!nearBoundary(points[found[k]], queries[i], r)) ids.push_back(found[k]);
+                        for (std::uint32_t j = 0; j < n; ++j)
+                            if (within(points[j], queries[i], r) && !nearBoundary(points[j], queries[i], r))
+                                ref.push_back(j);
+                        std::sort(ids.begin(), ids.end());
+                        REQUIRE(ids == ref);
+                    }
+                }
+            }
+            vtx::simd::reset();
+        }
+    }
+}
+
+TEST_CASE("Spatial hash grid", "[geometry][spatial_hash]") {
+    SECTION("Morton keys of wrapped cells") {
+        vtx::spatial_hash<float> grid(0.5f);
+        const std::vector<vtx::vector<float, 3>> none;
+        grid.build(none.data(), 0);
+        REQUIRE(grid.bits() == vtx::spatial_hash<float>::MIN_BITS);
+        REQUIRE(grid.key(vtx::vector<float, 3>(0.1f, 0.2f, 0.3f)) == 0);
+        REQUIRE(grid.key(vtx::vector<float, 3>(0.6f, 0.f, 0.f)) == 1);
+        REQUIRE(grid.key(vtx::vector<float, 3>(0.f, 0.6f, 0.f)) == 2);
+        REQUIRE(grid.key(vtx::vector<float, 3>(0.f, 0.f, 0.6f)) == 4);
+        REQUIRE(grid.key(vtx::vector<float, 3>(1.1f, 0.f, 0.f)) == 8);
+        REQUIRE(grid.key(vtx::vector<float, 3>(1.6f, 1.6f, 1.6f)) == 63);
+        // 4 cells per axis: cell -1 is cell 3, cell 4 is cell 0
+        REQUIRE(grid.key(vtx::vector<float, 3>(-0.1f, 0.f, 0.f)) == 9);
+        REQUIRE(grid.key(vtx::vector<float, 3>(2.1f, 2.1f, 2.1f)) == 0);
+        REQUIRE(grid.cellStarts() == std::vector<std::uint32_t>(65, 0));
+
+        std::vector<proxy_pair> pairs(4);
+        REQUIRE(grid.pairs(0.5f, pairs.data(), pairs.size()) == 0);
+        std::vector<std::uint32_t> found;
+        REQUIRE(grid.radius(vtx::vector<float, 3>(0.f), 0.5f, found) == 0);
+
+        std::vector<vtx::vector<float, 3>> many(100000, vtx::vector<float, 3>(0.f));
+        grid.build(many.data(), many.size());
+        REQUIRE(grid.bits() == 6);
+    }
+
+    SECTION("Pairs and radius queries against brute force") {
+        // Dense (about 30 particles within a cell size of each other), sparse, and spread over
+        // more cells than the table holds per axis
+        checkGrid<float>(3000, 6.f, 1.f);
+        checkGrid<float>(40, 6.f, 0.7f);
+        checkGrid<float>(2500, 40.f, 1.5f);
+        checkGrid<double>(2000, 5.0, 0.8);
+        checkGrid<float>(6000, 18.f, 1.f);
+    }
+
+    SECTION("Single queries and coincident particles") {
+        const std::vector<vtx::vector<float, 3>> points(300, vtx::vector<float, 3>(1.f, -2.f, 3.f));
+        vtx::spatial_hash<float> grid(0.25f);
+        grid.build(points.data(), points.size(), vtx::parallel::policy::par);
+        std::vector<proxy_pair> pairs(300 * 299 / 2);
+        REQUIRE(grid.pairs(0.f, pairs.data(), pairs.size()) == pairs.size());
+        REQUIRE(pairs.front() == proxy_pair(0, 1));
+        REQUIRE(pairs.back() == proxy_pair(298, 299));
+        std::vector<std::uint32_t> found{7u};
+        REQUIRE(grid.radius(vtx::vector<float, 3>(1.05f, -2.f, 3.f), 0.1f, found) == 300);
+        REQUIRE(found.size() == 301);
+        REQUIRE(grid.radius(vtx::vector<float, 3>(1.2f, -2.f, 3.f), 0.1f, found) == 0);
+    }
+}
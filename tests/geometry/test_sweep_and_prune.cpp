@@ -0,0 +1,175 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+#include "vectrix/geometry/aabb.h"
+#include "vectrix/geometry/sweep_and_prune.h"
+
+#include <algorithm>
+#include <random>
+
+namespace {
+    const vtx::simd::backend sweepBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    using pair_list = std::vector<vtx::sweep_and_prune<float>::proxy_pair>;
+
+    // Boxes spread along x (a track), some of them touching or with equal minima
+    template<typename T>
+    void randomBounds( vtx::soa_vector<T, 3> &min, vtx::soa_vector<T, 3> &max, const unsigned seed ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> x(T(-200), T(200)), yz(T(-4), T(4)), size(T(0.1), T(2));
+        for (size_t i = 0; i < min.size(); ++i) {
+            vtx::vector<T, 3> lo(x(gen), yz(gen), yz(gen));
+            if (i % 7 == 3) lo = min.get(i - 1);
+            if (i % 11 == 5) lo = vtx::vector<T, 3>(max.get(i - 1)[0], min.get(i - 1)[1], min.get(i - 1)[2]);
+            min.set(i, lo);
+            max.set(i, lo + vtx::vector<T, 3>(size(gen), size(gen), size(gen)));
+        }
+    }
+
+    template<typename T>
+    pair_list bruteForce( const vtx::soa_vector<T, 3> &min, const vtx::soa_vector<T, 3> &max ) {
+        pair_list pairs;
+        for (size_t i = 0; i < min.size(); ++i)
+            for (size_t j = i + 1; j < min.size(); ++j)
+                if (vtx::aabb<T>(min.get(i), max.get(i)).intersects(vtx::aabb<T>(min.get(j), max.get(j))))
+                    pairs.emplace_back(std::uint32_t(i), std::uint32_t(j));
+        return pairs;
+    }
+
+    // All pairs through a buffer grown to the returned count
+    template<typename T>
+    pair_list sweep( vtx::sweep_and_prune<T> &sap, const vtx::parallel::policy pol ) {
+        pair_list pairs(4);
+        const size_t count = sap.pairs(pairs.data(), pairs.size(), pol);
+        if (count > pairs.size()) {
+            const pair_list first = pairs;
+            pairs.resize(count);
+            REQUIRE(sap.pairs(pairs.data(), pairs.size(), pol) == count);
+            REQUIRE(std::equal(first.begin(), first.end(), pairs.begin()));
+        }
+        pairs.resize(count);
+        return pairs;
+    }
+
+    template<typename T>
+    void checkPairs( vtx::sweep_and_prune<T> &sap, const vtx::soa_vector<T, 3> &min,
+                     const vtx::soa_vector<T, 3> &max ) {
+        const pair_list ref = bruteForce(min, max);
+        for (size_t k = 1; k < sap.size(); ++k)
+            REQUIRE(min.get(sap.order()[k - 1])[sap.axis()] <= min.get(sap.order()[k])[sap.axis()]);
+
+        const vtx::parallel::policy policies[] = {vtx::parallel::policy::seq, vtx::parallel::policy::par};
+        pair_list first;
+        for (const auto be : sweepBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+            for (const auto pol : policies) {
+                pair_list pairs = sweep(sap, pol);
+                if (first.empty())
+                    first = pairs;
+                REQUIRE(pairs == first);
+                for (const auto &p : pairs) REQUIRE(p.first < p.second);
+                std::sort(pairs.begin(), pairs.end());
+                REQUIRE(pairs == ref);
+            }
+        }
+        vtx::simd::reset();
+    }
+
+    template<typename T>
+    void checkSweep( const size_t n, const size_t axis ) {
+        vtx::soa_vector<T, 3> min(n), max(n);
+        randomBounds(min, max, static_cast<unsigned>(n));
+        if (axis != 0)
+            for (size_t i = 0; i < n; ++i) {
+                vtx::vector<T, 3> lo = min.get(i), hi = max.get(i);
+                std::swap(lo[0], lo[axis]);
+                std::swap(hi[0], hi[axis]);
+                min.set(i, lo);
+                max.set(i, hi);
+            }
+
+        vtx::sweep_and_prune<T> sap(axis), par(axis);
+        REQUIRE(sap.update(min, max));
+        REQUIRE(par.update(min, max, vtx::parallel::policy::par));
+        REQUIRE(sap.order() == par.order());
+        checkPairs(sap, min, max);
+
+        // Small motion: repaired by insertion sort
+        std::mt19937 gen(3);
+        std::uniform_real_distribution<T> step(T(-0.5), T(0.5));
+        for (int frame = 0; frame < 3; ++frame) {
+            for (size_t i = 0; i < n; ++i) {
+                vtx::vector<T, 3> d(T(0));
+                d[axis] = step(gen);
+                min.set(i, min.get(i) + d);
+                max.set(i, max.get(i) + d);
+            }
+            REQUIRE_FALSE(sap.update(min, max));
+            checkPairs(sap, min, max);
+        }
+
+        // Reversed order: the insertion sort gives up, sorts from scratch
+        for (size_t i = 0; i < n; ++i) {
+            vtx::vector<T, 3> lo = min.get(i), hi = max.get(i);
+            const T w = hi[axis] - lo[axis];
+            lo[axis] = -lo[axis];
+            hi[axis] = lo[axis] + w;
+            min.set(i, lo);
+            max.set(i, hi);
+        }
+        REQUIRE(sap.update(min, max, vtx::parallel::policy::par));
+        checkPairs(sap, min, max);
+
+        // New box count
+        vtx::soa_vector<T, 3> fewer(n / 2), fewerMax(n / 2);
+        randomBounds(fewer, fewerMax, 9);
+        REQUIRE(sap.update(fewer, fewerMax));
+        REQUIRE(sap.size() == n / 2);
+        checkPairs(sap, fewer, fewerMax);
+    }
+}
+
+TEST_CASE("Sweep and prune", "[geometry][sweep_and_prune]") {
+    SECTION("Pairs against brute force") {
+        checkSweep<float>(37, 0);
+        checkSweep<float>(3000, 0);
+        checkSweep<float>(9000, 2);
+        checkSweep<double>(2500, 1);
+    }
+
+    SECTION("Empty and single") {
+        vtx::soa_vector<float, 3> min(0), max(0);
+        vtx::sweep_and_prune<float> sap;
+        sap.update(min, max);
+        REQUIRE(sap.pairs(nullptr, 0) == 0);
+        min.resize(1);
+        max.resize(1);
+        REQUIRE(sap.update(min, max));
+        REQUIRE(sap.pairs(nullptr, 0) == 0);
+    }
+
+    SECTION("Capacity limits the written pairs only") {
+        // Fully overlapping stack of boxes
+        const size_t n = 50;
+        vtx::soa_vector<float, 3> min(n), max(n);
+        for (size_t i = 0; i < n; ++i) {
+            min.set(i, vtx::vector<float, 3>(float(i) * 0.01f));
+            max.set(i, vtx::vector<float, 3>(1.f));
+        }
+        vtx::sweep_and_prune<float> sap;
+        sap.update(min, max);
+        pair_list pairs(10, {0u, 0u});
+        REQUIRE(sap.pairs(pairs.data(), 5) == n * (n - 1) / 2);
+        REQUIRE(pairs[4].second != 0);
+        REQUIRE(pairs[5] == std::make_pair(0u, 0u));
+    }
+}
@@ -0,0 +1,86 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+
+#include "vectrix/math/solvers.h"
+
+#include <random>
+#include <vector>
+
+namespace {
+    const vtx::simd::backend rootBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    // Random coefficients with degenerate rows mixed in; odd count for the loop tails
+    template<typename T>
+    std::vector<T> coefficients( const size_t n, const unsigned seed, const size_t zeroEvery ) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> dist(T(-10), T(10));
+        std::vector<T> v(n);
+        for (size_t i = 0; i < n; ++i)
+            v[i] = i % zeroEvery == 3 ? T(0) : dist(gen);
+        return v;
+    }
+
+    template<typename T, size_t K>
+    void requireRoots( const T *roots, const std::array<T, K> &expected, const size_t count,
+                       const T eps ) {
+        T scale = T(1);
+        for (size_t k = 0; k < count; ++k)
+            scale = std::max(scale, std::abs(expected[k]));
+        for (size_t k = 0; k < K; ++k)
+            REQUIRE(roots[k] == Catch::Approx(k < count ? expected[k] : T(0)).margin(eps * scale));
+    }
+
+    template<typename T>
+    void checkBatchRoots( const T eps ) {
+        const size_t n = 101;
+        auto a = coefficients<T>(n, 1, 7), b = coefficients<T>(n, 2, 11);
+        auto c = coefficients<T>(n, 3, 13), d = coefficients<T>(n, 4, 5);
+        // Exact double roots: x^2 + 2x + 1 and x^3 (with fused multiply-add, discriminants
+        // that are zero only after rounding can change sign, so other rows avoid them)
+        a[0] = T(1), b[0] = T(2), c[0] = T(1), d[0] = T(-1);
+        a[1] = T(1), b[1] = T(0), c[1] = T(0), d[1] = T(0);
+        // Constant equation
+        a[2] = b[2] = T(0), c[2] = T(5), d[2] = T(1);
+
+        std::vector<T> r0(n), r1(n), r2(n);
+        std::vector<std::uint8_t> count(n);
+        for (const auto be : rootBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+
+            vtx::solver::Square(a.data(), b.data(), c.data(), n, r0.data(), r1.data(), count.data());
+            for (size_t i = 0; i < n; ++i) {
+                INFO("square " << i);
+                const auto ref = vtx::solver::Square(a[i], b[i], c[i]);
+                REQUIRE(count[i] == ref.second);
+                const T roots[] = {r0[i], r1[i]};
+                requireRoots(roots, ref.first, ref.second, eps);
+            }
+
+            vtx::solver::Cubic(a.data(), b.data(), c.data(), d.data(), n,
+                               r0.data(), r1.data(), r2.data(), count.data());
+            for (size_t i = 0; i < n; ++i) {
+                INFO("cubic " << i);
+                const auto ref = vtx::solver::Cubic(a[i], b[i], c[i], d[i]);
+                REQUIRE(count[i] == ref.second);
+                const T roots[] = {r0[i], r1[i], r2[i]};
+                requireRoots(roots, ref.first, ref.second, eps);
+            }
+        }
+        vtx::simd::reset();
+    }
+}
+
+TEST_CASE("Batch square and cubic solvers match scalar ones", "[solver][simd]") {
+    checkBatchRoots<float>(2e-3f);
+    checkBatchRoots<double>(1e-9);
+}
@@ -0,0 +1,182 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+
+#include "vectrix/math/fast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+
+namespace {
+    using vtx::math::fast::accuracy;
+
+    // Distance to a long double reference in ulp of T at the reference
+    template<typename T>
+    double ulpError( const T value, const long double ref ) {
+        if (std::isinf(ref))
+            return value == ref ? 0.0 : std::numeric_limits<double>::infinity();
+        const T r = std::fabs(T(ref));
+        const long double ulp = r == T(0)
+                ? std::numeric_limits<T>::denorm_min()
+                : std::nextafter(r, std::numeric_limits<T>::infinity()) - r;
+        return double(std::fabs((long double)value - ref) / ulp);
+    }
+
+    // Linear and log-spaced sweep points
+    template<typename T>
+    T linear( const long double a, const long double b, const int i, const int n ) {
+        return T(a + (b - a) * i / n);
+    }
+
+    template<typename T>
+    T logSpaced( const long double e0, const long double e1, const int i, const int n ) {
+        return T(std::exp2(e0 + (e1 - e0) * i / n));
+    }
+
+    struct sweepResult {
+        double rsqrt = 0, sincos = 0, acos = 0, cbrt = 0, exp = 0, log = 0;
+    };
+
+    template<typename T, accuracy A>
+    sweepResult sweep() {
+        namespace fast = vtx::math::fast;
+        const bool single = sizeof(T) == 4;
+        const int n = 100000;
+        sweepResult m;
+        for (int i = 0; i <= n; ++i) {
+            T x = logSpaced<T>(-60, 60, i, n);
+            m.rsqrt = std::max(m.rsqrt, ulpError(fast::rsqrt<A>(x), 1.0L / std::sqrt((long double)x)));
+
+            x = linear<T>(-1e5L, 1e5L, i, n);
+            T s, c;
+            fast::sincos<A>(x, s, c);
+            m.sincos = std::max({m.sincos, ulpError(s, std::sin((long double)x)), ulpError(c, std::cos((long double)x))});
+
+            x = linear<T>(-1, 1, i, n);
+            m.acos = std::max(m.acos, ulpError(fast::acos<A>(x), std::acos((long double)x)));
+
+            x = logSpaced<T>(-60, 60, i, n) * (i % 2 ? T(-1) : T(1));
+            m.cbrt = std::max(m.cbrt, ulpError(fast::cbrt<A>(x), std::cbrt((long double)x)));
+
+            x = single ? linear<T>(-87, 88, i, n) : linear<T>(-708, 709, i, n);
+            m.exp = std::max(m.exp, ulpError(fast::exp<A>(x), std::exp((long double)x)));
+
+            x = logSpaced<T>(-100, 100, i, n);
+            m.log = std::max(m.log, ulpError(fast::log<A>(x), std::log((long double)x)));
+        }
+        return m;
+    }
+
+    template<typename T, accuracy A>
+    void checkSweep( const sweepResult &bound ) {
+        const auto m = sweep<T, A>();
+        INFO("ulp: rsqrt " << m.rsqrt << ", sincos " << m.sincos << ", acos " << m.acos
+             << ", cbrt " << m.cbrt << ", exp " << m.exp << ", log " << m.log);
+        CHECK(m.rsqrt <= bound.rsqrt);
+        CHECK(m.sincos <= bound.sincos);
+        CHECK(m.acos <= bound.acos);
+        CHECK(m.cbrt <= bound.cbrt);
+        CHECK(m.exp <= bound.exp);
+        CHECK(m.log <= bound.log);
+    }
+
+    template<typename T, accuracy A>
+    std::string reportLine( const char *name ) {
+        const auto m = sweep<T, A>();
+        std::ostringstream s;
+        s << name << ": rsqrt " << m.rsqrt << ", sincos " << m.sincos << ", acos " << m.acos
+          << ", cbrt " << m.cbrt << ", exp " << m.exp << ", log " << m.log;
+        return s.str();
+    }
+
+    sweepResult bounds( const double rsqrt, const double sincos, const double acos,
+                        const double cbrt, const double exp, const double log ) {
+        sweepResult b;
+        b.rsqrt = rsqrt;
+        b.sincos = sincos;
+        b.acos = acos;
+        b.cbrt = cbrt;
+        b.exp = exp;
+        b.log = log;
+        return b;
+    }
+}
+
+// Bounds of the table in vectrix/math/fast.h
+TEST_CASE("Fast math ULP sweep", "[fast]") {
+    SECTION("float") {
+        checkSweep<float, accuracy::low>(bounds(3e4, 700, 2e3, 300, 700, 3e3));
+        checkSweep<float, accuracy::medium>(bounds(80, 2, 2, 3, 2, 3));
+        checkSweep<float, accuracy::high>(bounds(2, 2, 2, 3, 2, 2));
+    }
+    SECTION("double") {
+        checkSweep<double, accuracy::low>(bounds(2e13, 4e11, 1e12, 2e11, 4e11, 2e12));
+        checkSweep<double, accuracy::medium>(bounds(3e5, 4e7, 5e7, 40, 1e7, 6e8));
+        checkSweep<double, accuracy::high>(bounds(2, 2, 2, 3, 2, 2));
+    }
+}
+
+// Measured maximum errors, run with: VTXTests "[fast-report]"
+TEST_CASE("Fast math ULP report", "[.][fast-report]") {
+    const std::string lines[] = {
+            reportLine<float, accuracy::low>("float low"),
+            reportLine<float, accuracy::medium>("float medium"),
+            reportLine<float, accuracy::high>("float high"),
+            reportLine<double, accuracy::low>("double low"),
+            reportLine<double, accuracy::medium>("double medium"),
+            reportLine<double, accuracy::high>("double high")
+    };
+    for (const auto &line : lines)
+        WARN(line);
+}
+
+TEST_CASE("Fast math special values", "[fast]") {
+    namespace fast = vtx::math::fast;
+    const double inf = std::numeric_limits<double>::infinity();
+
+    REQUIRE(fast::cbrt(0.0) == 0.0);
+    REQUIRE(fast::cbrt(-27.0) == Catch::Approx(-3.0));
+    REQUIRE(std::isinf(fast::cbrt(-inf)));
+    REQUIRE(fast::exp(0.0f) == 1.0f);
+    REQUIRE(fast::exp(1000.0) == inf);
+    REQUIRE(fast::exp(-1000.0) == 0.0);
+    REQUIRE(fast::exp(-745.0) > 0.0);
+    REQUIRE(fast::log(1.0) == 0.0);
+    REQUIRE(fast::log(0.0) == -inf);
+    REQUIRE(std::isnan(fast::log(-1.0f)));
+    REQUIRE(fast::log(inf) == inf);
+    REQUIRE(fast::log(std::numeric_limits<double>::denorm_min()) == Catch::Approx(-744.44007192138126));
+    REQUIRE(fast::acos(1.0f) == 0.0f);
+    REQUIRE(fast::acos(-1.0) == Catch::Approx(vtx::math::PI));
+
+    // Quadrants of huge and non-finite arguments saturate instead of overflowing the conversion
+    float sf, cf;
+    fast::sincos(1e30f, sf, cf);
+    double sd, cd;
+    fast::sincos(-3e300, sd, cd);
+    fast::sincos(inf, sd, cd);
+    REQUIRE(std::isnan(fast::sin(std::numeric_limits<float>::quiet_NaN())));
+}
+
+TEST_CASE("Math policy matches std without VTX_FAST_MATH", "[fast]") {
+    namespace policy = vtx::math::policy;
+    double s, c;
+    policy::sincos(0.7, s, c);
+#ifdef VTX_FAST_MATH
+    REQUIRE(s == Catch::Approx(std::sin(0.7)));
+    REQUIRE(c == Catch::Approx(std::cos(0.7)));
+    REQUIRE(policy::cbrt(10.0) == Catch::Approx(std::cbrt(10.0)));
+    REQUIRE(policy::acos(0.3f) == Catch::Approx(std::acos(0.3f)));
+#else
+    REQUIRE(s == std::sin(0.7));
+    REQUIRE(c == std::cos(0.7));
+    REQUIRE(policy::cbrt(10.0) == std::cbrt(10.0));
+    REQUIRE(policy::acos(0.3f) == std::acos(0.3f));
+#endif // VTX_FAST_MATH
+    REQUIRE(policy::rsqrt(4.0f) == Catch::Approx(0.5f));
+}
@@ -0,0 +1,107 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+
+#include "vectrix/core/vectrix_core.h"
+#include "vectrix/math/solvers.h"
+
+using vtx::solver::solution_kind;
+
+namespace {
+    template<typename T, size_t M, size_t N>
+    void requireZero( const vtx::matrix<T, M, N> &a, const T eps ) {
+        for (size_t i = 0; i < M; ++i)
+            for (size_t j = 0; j < N; ++j)
+                REQUIRE(a[i][j] == Catch::Approx(T(0)).margin(eps));
+    }
+}
+
+TEST_CASE("Linear system with many right-hand sides", "[solver][linsystem]") {
+    vtx::matrix<double, 6, 6> a;
+    vtx::matrix<double, 6, 3> x;
+    for (size_t i = 0; i < 6; ++i) {
+        for (size_t j = 0; j < 6; ++j)
+            a[i][j] = i == j ? 10.0 : double((i * 5 + j * 3) % 7) - 3.0;
+        for (size_t k = 0; k < 3; ++k)
+            x[i][k] = double(i) * 0.5 - double(k);
+    }
+
+    const auto res = vtx::solver::linSystem(a, a * x);
+    REQUIRE(res);
+    REQUIRE(res.kind == solution_kind::unique);
+    REQUIRE(res.rank == 6);
+    REQUIRE(res.nullity() == 0);
+    REQUIRE(res.condition >= 1.0);
+    REQUIRE(res.condition < 100.0);
+    const vtx::matrix<double, 6, 3> err = res.x - x;
+    requireZero(err, 1e-12);
+
+    // Augmented form with one column, small specialized sizes
+    const vtx::matrix<float, 2, 3> m = {
+            {2.0f, 1.0f, 5.0f},
+            {1.0f, 3.0f, 10.0f}
+    };
+    const auto small = vtx::solver::linSystem(m);
+    REQUIRE(small.kind == solution_kind::unique);
+    REQUIRE(small.solution()[0] == Catch::Approx(1.0f));
+    REQUIRE(small.solution()[1] == Catch::Approx(3.0f));
+}
+
+TEST_CASE("Rank deficient linear systems", "[solver][linsystem]") {
+    // Rank 2: row 2 = row 0 + row 1, row 3 = 2 * row 0
+    const vtx::matrix<double, 4, 4> a = {
+            {1.0, 2.0, 0.0, 1.0},
+            {0.0, 1.0, 1.0, -1.0},
+            {1.0, 3.0, 1.0, 0.0},
+            {2.0, 4.0, 0.0, 2.0}
+    };
+
+    SECTION("Consistent") {
+        const vtx::matrix<double, 4, 1> b = {1.0, 2.0, 3.0, 2.0};
+        const auto res = vtx::solver::linSystem(a, b);
+        REQUIRE(res.kind == solution_kind::infinite);
+        REQUIRE(res.rank == 2);
+        REQUIRE(res.nullity() == 2);
+        REQUIRE(res.condition == std::numeric_limits<double>::infinity());
+        const vtx::matrix<double, 4, 1> err = a * res.x - b;
+        requireZero(err, 1e-12);
+
+        for (size_t i = 0; i < res.nullity(); ++i) {
+            const vtx::vector<double, 4> n = res.basis(i);
+            REQUIRE(n.length() > 0.5);
+            const vtx::vector<double, 4> an = a * n;
+            for (size_t j = 0; j < 4; ++j)
+                REQUIRE(an[j] == Catch::Approx(0.0).margin(1e-12));
+        }
+    }
+
+    SECTION("Inconsistent") {
+        const vtx::matrix<double, 4, 1> b = {1.0, 2.0, 4.0, 2.0};
+        const auto res = vtx::solver::linSystem(a, b);
+        REQUIRE_FALSE(res);
+        REQUIRE(res.kind == solution_kind::none);
+        REQUIRE(res.rank == 2);
+    }
+
+    SECTION("Homogeneous") {
+        const auto res = vtx::solver::linSystem(a, vtx::matrix<double, 4, 1>(0.0));
+        REQUIRE(res.kind == solution_kind::infinite);
+        requireZero(res.x, 0.0);
+        REQUIRE(res.nullity() == 2);
+
+        // Basis vectors are independent: free unknowns form an identity block
+        const vtx::vector<double, 4> n0 = res.basis(0), n1 = res.basis(1);
+        REQUIRE(n0[2] == 1.0);
+        REQUIRE(n0[3] == 0.0);
+        REQUIRE(n1[2] == 0.0);
+        REQUIRE(n1[3] == 1.0);
+
+        const auto full = vtx::solver::linSystem(vtx::matrix<double, 5, 5>::identity(),
+                                                 vtx::matrix<double, 5, 1>(0.0));
+        REQUIRE(full.kind == solution_kind::unique);
+        REQUIRE(full.condition == 1.0);
+        requireZero(full.x, 0.0);
+    }
+}
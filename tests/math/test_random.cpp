@@ -0,0 +1,218 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+
+#include "vectrix/math/random.h"
+
+#include <cstring>
+#include <vector>
+
+namespace {
+    const vtx::simd::backend randomBackends[] = {
+        vtx::simd::backend::scalar,
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    template<typename T, size_t N>
+    void checkFill( const T min, const T max ) {
+        // Odd sizes: partial Philox blocks at both ends of every split
+        const size_t n = 1001;
+        std::vector<vtx::vector<T, N>> seq(n), par(n), parts(n);
+        vtx::random::fill(seq, min, max, 42, 7);
+        vtx::random::fill(par, min, max, 42, 7, vtx::parallel::policy::par);
+        vtx::random::fill(parts.data(), 333, min, max, 42, 7, 0);
+        vtx::random::fill(parts.data() + 333, n - 333, min, max, 42, 7, 333);
+
+        double mean = 0.0;
+        for (size_t i = 0; i < n; ++i)
+            for (size_t c = 0; c < N; ++c) {
+                REQUIRE(seq[i][c] == par[i][c]);
+                REQUIRE(seq[i][c] == parts[i][c]);
+                REQUIRE(seq[i][c] >= min);
+                REQUIRE(seq[i][c] < max);
+                mean += double(seq[i][c]);
+            }
+        REQUIRE(mean / double(n * N) == Catch::Approx((double(min) + double(max)) / 2).margin(0.05 * double(max - min)));
+
+        // Other seeds and streams give other values
+        std::vector<vtx::vector<T, N>> seed2(n), stream2(n);
+        vtx::random::fill(seed2, min, max, 43, 7);
+        vtx::random::fill(stream2, min, max, 42, 8);
+        REQUIRE(seed2[0][0] != seq[0][0]);
+        REQUIRE(stream2[0][0] != seq[0][0]);
+
+        // Same stream on every backend (up to fused multiply-add rounding)
+        for (const auto be : randomBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+            std::vector<vtx::vector<T, N>> other(n);
+            vtx::random::fill(other, min, max, 42, 7);
+            for (size_t i = 0; i < n; ++i)
+                for (size_t c = 0; c < N; ++c)
+                    REQUIRE(other[i][c] == Catch::Approx(seq[i][c]).margin(1e-6));
+        }
+        vtx::simd::reset();
+    }
+
+    // Unit values [0, 1) of fill against philox4x32 draws: one per float, two per double (low
+    // word first), converted by the exponent trick
+    float unitOf( vtx::random::philox4x32 &engine, float ) {
+        const std::uint32_t bits = engine() >> 9 | 0x3F800000u;
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f - 1.0f;
+    }
+
+    double unitOf( vtx::random::philox4x32 &engine, double ) {
+        const std::uint64_t lo = engine(), hi = engine();
+        const std::uint64_t bits = (hi << 32 | lo) >> 12 | 0x3FF0000000000000ull;
+        double f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f - 1.0;
+    }
+
+    template<typename T, size_t N>
+    void checkFillOrder( ) {
+        // Past one group of blocks, from an offset that starts inside a block
+        const size_t n = 300, first = 77;
+        std::vector<vtx::vector<T, N>> out(n);
+        vtx::random::philox4x32 engine(0x123456789ull, 5);
+        engine.discard(first * N * (sizeof(T) / 4));
+        for (const auto be : randomBackends) {
+            if (!vtx::simd::force(be))
+                continue;
+            INFO("backend " << vtx::simd::name(be));
+            vtx::random::fill(out.data(), n, T(0), T(1), 0x123456789ull, 5, first);
+            vtx::random::philox4x32 e = engine;
+            for (size_t i = 0; i < n; ++i)
+                for (size_t c = 0; c < N; ++c)
+                    REQUIRE(out[i][c] == unitOf(e, T()));
+        }
+        vtx::simd::reset();
+    }
+}
+
+TEST_CASE("Random engines reproduce reference sequences", "[random]") {
+    std::uint64_t state = 0;
+    REQUIRE(vtx::random::splitmix64(state) == 0xE220A8397B1DCDAFull);
+
+    // PCG32 demo sequence (seed 42, stream 54)
+    vtx::random::pcg32 pcg(42, 54);
+    const std::uint32_t pcgRef[] = {0xA15C02B7u, 0x7B47F409u, 0xBA1D3330u, 0x83D2F293u, 0xBFA4784Bu, 0xCBED606Eu};
+    for (const auto r : pcgRef)
+        REQUIRE(pcg() == r);
+
+    // Philox4x32-10 known answers
+    const std::uint32_t ctr[3][4] = {
+            {0u, 0u, 0u, 0u},
+            {0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu},
+            {0x243F6A88u, 0x85A308D3u, 0x13198A2Eu, 0x03707344u}
+    };
+    const std::uint32_t key[3][2] = {{0u, 0u}, {0xFFFFFFFFu, 0xFFFFFFFFu}, {0xA4093822u, 0x299F31D0u}};
+    const std::uint32_t philoxRef[3][4] = {
+            {0x6627E8D5u, 0xE169C58Du, 0xBC57AC4Cu, 0x9B00DBD8u},
+            {0x408F276Du, 0x41C83B0Eu, 0xA20BC7C6u, 0x6D5451FDu},
+            {0xD16CFE09u, 0x94FDCCEBu, 0x5001E420u, 0x24126EA1u}
+    };
+    for (size_t t = 0; t < 3; ++t) {
+        std::uint32_t out[4];
+        vtx::random::philox4x32::block(ctr[t], key[t], out);
+        for (size_t j = 0; j < 4; ++j)
+            REQUIRE(out[j] == philoxRef[t][j]);
+    }
+}
+
+TEST_CASE("Random engine skip ahead and streams", "[random]") {
+    SECTION("PCG32 advance") {
+        vtx::random::pcg32 a(5, 3), b(5, 3), other(5, 4);
+        for (int i = 0; i < 1000; ++i)
+            a();
+        b.advance(1000);
+        REQUIRE(a == b);
+        REQUIRE(a() == b());
+        // Advance by 2^64 - 1 steps back
+        b.advance(~std::uint64_t(0));
+        b();
+        REQUIRE(a == b);
+        REQUIRE(a != other);
+    }
+
+    SECTION("Philox discard and position") {
+        vtx::random::philox4x32 a(11, 2), b(11, 2);
+        std::vector<std::uint32_t> draws(23);
+        for (auto &d : draws)
+            d = a();
+        b.discard(13);
+        REQUIRE(b.position() == 13);
+        for (size_t i = 13; i < draws.size(); ++i)
+            REQUIRE(b() == draws[i]);
+        REQUIRE(a == b);
+        REQUIRE(vtx::random::philox4x32(11, 3)() != draws[0]);
+    }
+
+    SECTION("xoshiro256++ jumps") {
+        // Jumps are polynomials of the state transition, so they commute with draws
+        vtx::random::xoshiro256pp a(9), b(9);
+        a();
+        a.jump();
+        b.jump();
+        b();
+        REQUIRE(a == b);
+
+        vtx::random::xoshiro256pp c(9);
+        c.longJump();
+        REQUIRE(c != vtx::random::xoshiro256pp(9));
+        REQUIRE(a() == b());
+    }
+}
+
+TEST_CASE("Uniform random values and vectors", "[random]") {
+    vtx::random::pcg32 engine(1);
+    bool low = false, high = false;
+    for (int i = 0; i < 2000; ++i) {
+        const int v = vtx::random::uniform(engine, -3, 3);
+        REQUIRE(v >= -3);
+        REQUIRE(v <= 3);
+        low = low || v == -3;
+        high = high || v == 3;
+    }
+    REQUIRE(low);
+    REQUIRE(high);
+
+    double sum = 0.0;
+    vtx::random::xoshiro256pp x(2);
+    for (int i = 0; i < 10000; ++i) {
+        const auto v = vtx::random::vector<double, 3>(x, -1.0, 1.0);
+        for (size_t c = 0; c < 3; ++c) {
+            REQUIRE(v[c] >= -1.0);
+            REQUIRE(v[c] < 1.0);
+            sum += v[c];
+        }
+    }
+    REQUIRE(sum / 30000.0 == Catch::Approx(0.0).margin(0.02));
+
+    const auto f = vtx::random::vector<float, 4>(2.0f, 5.0f);
+    for (size_t c = 0; c < 4; ++c) {
+        REQUIRE(f[c] >= 2.0f);
+        REQUIRE(f[c] < 5.0f);
+    }
+    const auto n = vtx::random::vector<int, 2>(0, 1);
+    REQUIRE((n[0] == 0 || n[0] == 1));
+}
+
+TEST_CASE("Bulk random fill is reproducible", "[random][simd]") {
+    checkFill<float, 3>(-2.0f, 3.0f);
+    checkFill<float, 4>(0.0f, 1.0f);
+    checkFill<double, 3>(-1.0, 1.0);
+    checkFill<double, 2>(10.0, 20.0);
+}
+
+TEST_CASE("Bulk random fill follows the Philox engine", "[random][simd]") {
+    checkFillOrder<float, 3>();
+    checkFillOrder<double, 3>();
+}
@@ -0,0 +1,205 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+
+#include "vectrix/parallel/parallel_for.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Parallel for covers every index once", "[parallel]") {
+    vtx::parallel::thread_pool pool(3);
+    REQUIRE(pool.size() == 3);
+
+    SECTION("Large range") {
+        std::vector<int> hits(100000, 0);
+        vtx::parallel::parallel_for(0, hits.size(), 1000, [&]( const size_t b, const size_t e ) {
+            for (size_t i = b; i < e; ++i)
+                ++hits[i];
+        }, pool);
+        for (const int h : hits)
+            REQUIRE(h == 1);
+    }
+
+    SECTION("Range below grain runs in one call") {
+        std::atomic<int> calls{0};
+        vtx::parallel::parallel_for(10, 20, 100, [&]( const size_t b, const size_t e ) {
+            REQUIRE(b == 10);
+            REQUIRE(e == 20);
+            ++calls;
+        }, pool);
+        REQUIRE(calls == 1);
+    }
+
+    SECTION("Empty range") {
+        bool called = false;
+        vtx::parallel::parallel_for(5, 5, 1, [&]( size_t, size_t ) { called = true; }, pool);
+        REQUIRE_FALSE(called);
+    }
+
+    SECTION("Chunks are multiples of the grain") {
+        std::atomic<size_t> covered{0};
+        vtx::parallel::parallel_for(0, 100003, 64, [&]( const size_t b, const size_t e ) {
+            REQUIRE(b % 64 == 0);
+            if (e != 100003)
+                REQUIRE((e - b) % 64 == 0);
+            covered += e - b;
+        }, pool);
+        REQUIRE(covered == 100003);
+    }
+
+    SECTION("Nested calls") {
+        std::atomic<size_t> sum{0};
+        vtx::parallel::parallel_for(0, 64, 4, [&]( const size_t b, const size_t e ) {
+            vtx::parallel::parallel_for(b * 10, e * 10, 1, [&]( const size_t ib, const size_t ie ) {
+                for (size_t i = ib; i < ie; ++i)
+                    sum += i;
+            }, pool);
+        }, pool);
+        REQUIRE(sum == 639 * 640 / 2);
+    }
+}
+
+TEST_CASE("Parallel for rethrows exceptions of its chunks", "[parallel]") {
+    vtx::parallel::thread_pool pool(3);
+
+    SECTION("Exception of one chunk stops the others") {
+        std::atomic<size_t> covered{0};
+        REQUIRE_THROWS_AS(vtx::parallel::parallel_for(0, 1000000, 100, [&]( const size_t b, const size_t e ) {
+            if (b <= 5000 && 5000 < e) throw std::runtime_error("chunk");
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            covered += e - b;
+        }, pool), std::runtime_error);
+        REQUIRE(covered < 1000000);
+    }
+
+    SECTION("Every chunk throws, on the workers too") {
+        for (int run = 0; run < 20; ++run)
+            REQUIRE_THROWS_AS(vtx::parallel::parallel_for(0, 64, 1, []( const size_t, const size_t ) {
+                std::this_thread::sleep_for(std::chrono::microseconds(20));
+                throw std::logic_error("every");
+            }, pool), std::logic_error);
+    }
+
+    SECTION("Nested calls and reductions") {
+        REQUIRE_THROWS_AS(vtx::parallel::parallel_for(0, 8, 1, [&]( const size_t, const size_t ) {
+            vtx::parallel::parallel_for(0, 8, 1, []( const size_t b, const size_t ) {
+                if (b == 3) throw std::runtime_error("inner");
+            }, pool);
+        }, pool), std::runtime_error);
+        const auto map = []( const size_t b, const size_t e ) {
+            if (b <= 777 && 777 < e) throw std::runtime_error("map");
+            return double(e - b);
+        };
+        const auto add = []( const double a, const double b ) { return a + b; };
+        REQUIRE_THROWS_AS(vtx::parallel::parallel_reduce(0, 10000, 10, 0.0, map, add,
+                              vtx::parallel::reduction::fast, pool), std::runtime_error);
+        REQUIRE_THROWS_AS(vtx::parallel::parallel_reduce(0, 10000, 10, 0.0, map, add,
+                              vtx::parallel::reduction::deterministic, pool), std::runtime_error);
+    }
+
+    // The pool is still usable
+    std::atomic<size_t> count{0};
+    vtx::parallel::parallel_for(0, 1000, 1, [&]( const size_t b, const size_t e ) { count += e - b; }, pool);
+    REQUIRE(count == 1000);
+}
+
+TEST_CASE("Thread pool steals and helps waiting threads", "[parallel]") {
+    vtx::parallel::thread_pool pool(3);
+
+    SECTION("Tasks submitted from workers run on any thread") {
+        std::atomic<int> done{0};
+        std::mutex mutex;
+        std::set<std::thread::id> ids;
+        vtx::parallel::parallel_for(0, 4, 1, [&]( size_t, size_t ) {
+            for (int t = 0; t < 16; ++t) {
+                pool.submit([&] {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ids.insert(std::this_thread::get_id());
+                    ++done;
+                });
+            }
+        }, pool);
+        while (done < 64)
+            if (!pool.tryRunOne())
+                std::this_thread::yield();
+        REQUIRE(done == 64);
+        REQUIRE(ids.size() > 1);
+    }
+
+    SECTION("Deeply nested calls finish") {
+        std::atomic<size_t> leaves{0};
+        vtx::parallel::parallel_for(0, 8, 1, [&]( const size_t b, const size_t e ) {
+            for (size_t i = b; i < e; ++i)
+                vtx::parallel::parallel_for(0, 8, 1, [&]( const size_t ib, const size_t ie ) {
+                    for (size_t j = ib; j < ie; ++j)
+                        vtx::parallel::parallel_for(0, 8, [&]( const size_t lb, const size_t le ) {
+                            leaves += le - lb;
+                        }, pool);
+                }, pool);
+        }, pool);
+        REQUIRE(leaves == 512);
+    }
+
+    SECTION("Empty pool runs on the caller") {
+        vtx::parallel::thread_pool empty(0);
+        bool called = false;
+        empty.submit([&] { called = true; });
+        REQUIRE(called);
+        REQUIRE_FALSE(empty.tryRunOne());
+    }
+}
+
+TEST_CASE("Parallel reduce", "[parallel]") {
+    // Values of very different magnitudes: the float sum depends on the combination order
+    std::vector<float> values(200001);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = (i % 7 == 0 ? 1e6f : 0.37f) * (i % 2 ? 1.0f : -0.9f);
+    const auto map = [&]( const size_t b, const size_t e ) {
+        float s = 0;
+        for (size_t i = b; i < e; ++i)
+            s += values[i];
+        return s;
+    };
+    const auto plus = []( const float a, const float b ) { return a + b; };
+
+    double exact = 0;
+    for (const float v : values)
+        exact += v;
+
+    SECTION("Fast reduction") {
+        vtx::parallel::thread_pool pool(3);
+        const float s = vtx::parallel::parallel_reduce(0, values.size(), 1000, 0.0f, map, plus,
+                                                       vtx::parallel::reduction::fast, pool);
+        REQUIRE(s == Catch::Approx(exact).epsilon(1e-4));
+
+        const size_t count = vtx::parallel::parallel_reduce(size_t(5), size_t(5), 1, size_t(42),
+            []( size_t, size_t ) { return size_t(0); }, []( size_t a, size_t b ) { return a + b; });
+        REQUIRE(count == 42);
+    }
+
+    SECTION("Deterministic reduction does not depend on the thread count") {
+        float first = 0;
+        for (const size_t workers : {0, 1, 2, 3, 7}) {
+            vtx::parallel::thread_pool pool(workers);
+            for (int rep = 0; rep < 3; ++rep) {
+                const float s = vtx::parallel::parallel_reduce(0, values.size(), 1000, 0.0f, map, plus,
+                                                               vtx::parallel::reduction::deterministic, pool);
+                if (workers == 0 && rep == 0)
+                    first = s;
+                INFO("workers " << workers);
+                REQUIRE(std::memcmp(&s, &first, sizeof(float)) == 0);
+            }
+        }
+        REQUIRE(first == Catch::Approx(exact).epsilon(1e-4));
+    }
+}
@@ -0,0 +1,64 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+
+#include "vectrix/parallel/radix_sort.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+    // Sort of random keys against std::stable_sort, on the calling thread and split into chunks
+    template<typename K>
+    void checkRadixSort( const size_t n, const K range, vtx::parallel::thread_pool &pool ) {
+        std::mt19937_64 gen(n);
+        std::uniform_int_distribution<K> dist(0, range);
+        std::vector<K> keys(n);
+        std::vector<std::uint32_t> values(n);
+        for (size_t i = 0; i < n; ++i) {
+            keys[i] = dist(gen);
+            values[i] = std::uint32_t(i);
+        }
+
+        std::vector<std::uint32_t> ref = values;
+        std::stable_sort(ref.begin(), ref.end(), [&]( const std::uint32_t a, const std::uint32_t b ) {
+            return keys[a] < keys[b];
+        });
+
+        const size_t grains[] = {n, 1000, 77};
+        for (const size_t grain : grains) {
+            std::vector<K> k = keys, tmpKeys(n);
+            std::vector<std::uint32_t> v = values, tmpValues(n);
+            vtx::parallel::radix_sort(k.data(), v.data(), n, tmpKeys.data(), tmpValues.data(), grain, pool);
+            REQUIRE(v == ref);
+            for (size_t i = 0; i < n; ++i)
+                REQUIRE(k[i] == keys[v[i]]);
+        }
+    }
+}
+
+TEST_CASE("Parallel radix sort", "[parallel]") {
+    vtx::parallel::thread_pool pool(3);
+
+    SECTION("Stable against std::stable_sort") {
+        checkRadixSort<std::uint32_t>(20000, std::numeric_limits<std::uint32_t>::max(), pool);
+        checkRadixSort<std::uint32_t>(5000, 300, pool);
+        checkRadixSort<std::uint64_t>(8000, std::numeric_limits<std::uint64_t>::max(), pool);
+        checkRadixSort<std::uint64_t>(1, 5, pool);
+        checkRadixSort<std::uint32_t>(0, 5, pool);
+    }
+
+    SECTION("Floating-point keys keep the order of the values") {
+        const float f[] = {-std::numeric_limits<float>::infinity(), -1e30f, -2.5f, -1e-40f, -0.f, 0.f, 1e-40f,
+                           1.f, 3.f, std::numeric_limits<float>::max()};
+        for (size_t i = 1; i < std::size(f); ++i)
+            REQUIRE(vtx::parallel::radix_key(f[i - 1]) < vtx::parallel::radix_key(f[i]));
+        const double d[] = {-1e300, -1.0, -0.0, 0.0, 1e-310, 2.0, std::numeric_limits<double>::infinity()};
+        for (size_t i = 1; i < std::size(d); ++i)
+            REQUIRE(vtx::parallel::radix_key(d[i - 1]) < vtx::parallel::radix_key(d[i]));
+    }
+}
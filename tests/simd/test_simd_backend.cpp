@@ -0,0 +1,120 @@
+//
+// Created by Timmimin on 17.10.2026.
+//
+
+#include "../tests_common.h"
+
+#include "vectrix/core/matrix4x4.h"
+#include "vectrix/core/vector4.h"
+
+#include <random>
+
+namespace {
+    const vtx::simd::backend backends[] = {
+        vtx::simd::backend::sse2,
+        vtx::simd::backend::avx2,
+        vtx::simd::backend::avx512
+    };
+
+    template<typename T>
+    vtx::mat4x4<T> randomMatrix( std::mt19937 &gen ) {
+        std::uniform_real_distribution<T> dist(T(-10), T(10));
+        vtx::mat4x4<T> m;
+        for (size_t i = 0; i < 4; ++i)
+            for (size_t j = 0; j < 4; ++j)
+                m[i][j] = dist(gen);
+        return m;
+    }
+
+    template<typename T>
+    void requireNear( const vtx::mat4x4<T> &a, const vtx::mat4x4<T> &b, const T eps ) {
+        for (size_t i = 0; i < 4; ++i)
+            for (size_t j = 0; j < 4; ++j)
+                REQUIRE(a[i][j] == Catch::Approx(b[i][j]).epsilon(eps).margin(eps));
+    }
+
+    // Compare every supported backend with the scalar code on the same inputs
+    template<typename T>
+    void checkBackends( const T eps ) {
+        std::mt19937 gen(2303);
+
+        for (int iter = 0; iter < 64; ++iter) {
+            const vtx::mat4x4<T> a = randomMatrix<T>(gen), b = randomMatrix<T>(gen);
+            const vtx::vector<T, 4> v(a[0][0], a[1][1], b[2][2], b[3][3]);
+
+            REQUIRE(vtx::simd::force(vtx::simd::backend::scalar));
+            const vtx::mat4x4<T> mul = a * b, tr = a.transpose(), inv = a.inverse();
+            const vtx::vector<T, 4> mv = a * v;
+
+            for (const auto be : backends) {
+                if (!vtx::simd::force(be))
+                    continue;
+                INFO("backend " << vtx::simd::name(be));
+
+                requireNear(a * b, mul, eps);
+                requireNear(inv, a.inverse(), eps * 100);
+                REQUIRE(a.transpose() == tr);
+
+                const vtx::vector<T, 4> r = a * v;
+                for (size_t i = 0; i < 4; ++i)
+                    REQUIRE(r[i] == Catch::Approx(mv[i]).epsilon(eps).margin(eps));
+            }
+        }
+        vtx::simd::reset();
+    }
+}
+
+TEST_CASE("Backend detection", "[simd]") {
+    REQUIRE(vtx::simd::supported(vtx::simd::backend::scalar));
+    REQUIRE(vtx::simd::supported(vtx::simd::detected()));
+    REQUIRE(vtx::simd::active() == vtx::simd::detected());
+
+    REQUIRE(vtx::simd::force(vtx::simd::backend::scalar));
+    REQUIRE(vtx::simd::active() == vtx::simd::backend::scalar);
+    vtx::simd::reset();
+    REQUIRE(vtx::simd::active() == vtx::simd::detected());
+}
+
+TEST_CASE("Forced backends match scalar (float)", "[simd]") {
+    checkBackends<float>(1e-4f);
+}
+
+TEST_CASE("Forced backends match scalar (double)", "[simd]") {
+    checkBackends<double>(1e-10);
+}
+
+TEST_CASE("Singular matrix inverse on every backend", "[simd]") {
+    const vtx::mat4x4<float> a({{1, 2, 3, 4}, {2, 4, 6, 8}, {0, 1, 0, 1}, {5, 0, 0, 5}});
+
+    for (const auto be : backends) {
+        if (!vtx::simd::force(be))
+            continue;
+        REQUIRE(a.inverse() == vtx::mat4x4<float>::identity());
+    }
+    vtx::simd::reset();
+}
+
+TEST_CASE("Vector 4 operations match scalar", "[simd]") {
+    const vtx::vector<float, 4> a(1.5f, -2.0f, 3.25f, 4.0f), b(0.5f, 8.0f, -1.0f, 2.0f);
+
+    const vtx::vector<float, 4> sum = a + b, diff = a - b, prod = a * b, scaled = a * 3.0f;
+    for (size_t i = 0; i < 4; ++i) {
+        REQUIRE(sum[i] == a[i] + b[i]);
+        REQUIRE(diff[i] == a[i] - b[i]);
+        REQUIRE(prod[i] == a[i] * b[i]);
+        REQUIRE(scaled[i] == a[i] * 3.0f);
+    }
+    REQUIRE(a.dot(b) == Catch::Approx(a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3]));
+
+    const vtx::vector<double, 4> c(1.0, 2.0, 3.0, 4.0), d(4.0, 3.0, 2.0, 1.0);
+    REQUIRE((c + d) == vtx::vector<double, 4>(5.0));
+    REQUIRE((c & d) == 20.0);
+}
+
+#ifdef VTX_CPP20
+TEST_CASE("Constant evaluation keeps scalar path", "[simd]") {
+    constexpr vtx::mat4x4<float> t = vtx::mat4x4<float>::scale(2.0f).transpose();
+    STATIC_REQUIRE(t(1, 1) == 2.0f);
+    STATIC_REQUIRE(t(3, 3) == 1.0f);
+}
+#endif // VTX_CPP20